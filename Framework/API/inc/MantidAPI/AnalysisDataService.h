@@ -10,6 +10,7 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAPI/DllConfig.h"
+#include "MantidAPI/MemoryUsage.h"
 #include "MantidAPI/Workspace.h"
 #include "MantidKernel/DataService.h"
 #include "MantidKernel/SingletonHolder.h"
@@ -141,6 +142,10 @@ public:
 
   /// Return a lookup of the top level items
   std::map<std::string, Workspace_sptr> topLevelItems() const;
+  /// Return the memory used by the data of each workspace
+  std::map<std::string, MemoryUsage> memoryUsage() const;
+  /// Return the memory used by the distinct data of all workspaces
+  MemoryUsage totalMemoryUsage() const;
   void shutdown() override;
 
 private:
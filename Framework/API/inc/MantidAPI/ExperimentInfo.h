@@ -16,6 +16,7 @@
 #include "MantidKernel/V3D.h"
 #include "MantidKernel/cow_ptr.h"
 
+#include <atomic>
 #include <mutex>
 
 namespace Mantid {
@@ -39,6 +40,7 @@ class XMLInstrumentParameter;
 namespace API {
 class Run;
 class Sample;
+class SpectrumGeometryTable;
 class SpectrumInfo;
 
 /** This class is shared by a few Workspace types
@@ -160,6 +162,8 @@ public:
   const SpectrumInfo &spectrumInfo() const;
   SpectrumInfo &mutableSpectrumInfo();
 
+  const SpectrumGeometryTable &spectrumGeometryTable() const;
+
   const Geometry::ComponentInfo &componentInfo() const;
   Geometry::ComponentInfo &mutableComponentInfo();
 
@@ -212,6 +216,7 @@ private:
   mutable std::unordered_map<detid_t, size_t> m_det2group;
   void cacheDefaultDetectorGrouping() const; // Not thread-safe
   void invalidateAllSpectrumDefinitions();
+  void invalidateSpectrumGeometryTable() const;
   mutable std::once_flag m_defaultDetectorGroupingCached;
 
   mutable std::unique_ptr<Beamline::SpectrumInfo> m_spectrumInfo;
@@ -220,6 +225,12 @@ private:
   // This vector stores boolean flags but uses char to do so since
   // std::vector<bool> is not thread-safe.
   mutable std::vector<char> m_spectrumDefinitionNeedsUpdate;
+
+  mutable std::shared_ptr<const SpectrumGeometryTable> m_spectrumGeometryTable;
+  // Atomic since invalidation may happen concurrently from several threads,
+  // e.g., when modifying detector IDs of different spectra.
+  mutable std::atomic<bool> m_spectrumGeometryTableValid{false};
+  mutable std::mutex m_spectrumGeometryTableMutex;
 };
 
 /// Shared pointer to ExperimentInfo
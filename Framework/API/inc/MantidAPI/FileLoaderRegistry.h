@@ -18,7 +18,10 @@
 #endif
 
 #include <array>
+#include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 namespace Mantid {
@@ -65,6 +68,7 @@ public:
     // If the factory didn't throw then the name is valid
     m_names[format].insert(nameVersion);
     m_totalSize += 1;
+    clearCache();
     m_log.debug() << "Registered '" << nameVersion.first << "' version '"
                   << nameVersion.second << "' as file loader\n";
   }
@@ -78,6 +82,12 @@ public:
   /// Checks whether the given algorithm can load the file
   bool canLoad(const std::string &algorithmName,
                const std::string &filename) const;
+  /// Returns a descriptor of an HDF5 based NeXus file, shared while the file
+  /// is unchanged
+  std::shared_ptr<Kernel::NexusHDF5Descriptor>
+  nexusHDF5Descriptor(const std::string &filename) const;
+  /// Forget the descriptors and loaders of recently searched files
+  void clearCache() const;
 
 private:
   /// Friend so that CreateUsingNew
@@ -133,11 +143,32 @@ private:
   void removeAlgorithm(const std::string &name, const int version,
                        std::multimap<std::string, int> &typedLoaders);
 
+  /// Information kept about a recently searched file
+  struct RecentFile {
+    std::string filename;
+    int64_t lastModified;
+    uint64_t size;
+    std::shared_ptr<Kernel::NexusHDF5Descriptor> nexusHDF5Descriptor;
+    std::string loaderName;
+    int loaderVersion;
+  };
+  RecentFile &recentFile(const std::string &filename,
+                         const int64_t lastModified,
+                         const uint64_t size) const;
+  std::shared_ptr<IAlgorithm>
+  createRememberedLoader(const std::string &filename) const;
+  void rememberLoader(const std::string &filename,
+                      const IAlgorithm &loader) const;
+
   /// The list of names. The index pointed to by LoaderFormat defines a set for
   /// that format. The length is equal to the length of the LoaderFormat enum
   std::array<std::multimap<std::string, int>, 3> m_names;
   /// Total number of names registered
   size_t m_totalSize;
+  /// Recently searched files, most recent first
+  mutable std::list<RecentFile> m_recentFiles;
+  /// Mutex for m_recentFiles
+  mutable std::mutex m_recentFilesMutex;
 
   /// Reference to a logger
   mutable Kernel::Logger m_log;
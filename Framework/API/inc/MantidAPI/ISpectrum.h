@@ -22,6 +22,7 @@ class EventList;
 } // namespace DataObjects
 namespace API {
 class MatrixWorkspace;
+class MemoryUsage;
 
 /** A "spectrum" is an object that holds the data for a particular spectrum,
  * in particular:
@@ -68,6 +69,7 @@ public:
   virtual const MantidVec &readE() const;
 
   virtual size_t getMemorySize() const = 0;
+  virtual void addMemoryUsage(MemoryUsage &usage) const;
 
   virtual std::pair<double, double> getXDataRange() const;
   // ---------------------------------------------------------
@@ -108,6 +108,7 @@ public:
   virtual std::vector<size_t>
   getDetectorIDToWorkspaceIndexVector(detid_t &offset,
                                       bool throwIfMultipleDets = false) const;
+  std::vector<size_t> getDetectorIndexToWorkspaceIndexVector() const;
 
   virtual std::vector<size_t>
   getSpectrumToWorkspaceIndexVector(specnum_t &offset) const;
@@ -124,9 +125,14 @@ public:
   /// Returns true if the workspace is ragged (has differently sized spectra).
   virtual bool isRaggedWorkspace() const = 0;
 
+  /// Returns true if workspaces created from this one by WorkspaceFactory or
+  /// DataObjects::create are in-memory Workspace2D rather than of this type.
+  virtual bool childrenAreWorkspace2D() const { return false; }
+
   /// Get the footprint in memory in bytes.
   size_t getMemorySize() const override;
   virtual size_t getMemorySizeForXAxes() const;
+  void addMemoryUsage(MemoryUsage &usage) const override;
 
   // Section required for iteration
   /// Returns the number of single indexable items in the workspace
@@ -292,9 +298,7 @@ public:
     return getSpectrum(index).sharedDx();
   }
   void setSharedX(const size_t index,
-                  const Kernel::cow_ptr<HistogramData::HistogramX> &x) & {
-    getSpectrum(index).setSharedX(x);
-  }
+                  const Kernel::cow_ptr<HistogramData::HistogramX> &x) &;
   void setSharedDx(const size_t index,
                    const Kernel::cow_ptr<HistogramData::HistogramDx> &dx) & {
     getSpectrumWithoutInvalidation(index).setSharedDx(dx);
@@ -623,6 +627,9 @@ private:
   mutable std::atomic<bool> m_isCommonBinsFlagValid{false};
   /// Flag indicating whether the data has common bins
   mutable bool m_isCommonBinsFlag{false};
+  /// The X data referenced by all spectra if they share it, else nullptr
+  mutable std::atomic<const HistogramData::HistogramX *> m_commonBinsSharedX{
+      nullptr};
   /// A mutex protecting the update of m_isCommonBinsFlag.
   mutable std::mutex m_isCommonBinsMutex;
 
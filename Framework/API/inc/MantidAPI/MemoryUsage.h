@@ -0,0 +1,62 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidKernel/cow_ptr.h"
+
+#include <array>
+#include <unordered_set>
+
+namespace Mantid {
+namespace API {
+
+/** MemoryUsage accumulates the memory used by the data of workspaces, split
+  by the kind of data. Data referenced by more than one copy-on-write pointer,
+  e.g. X values shared by spectra or by workspaces, is counted as shared and
+  the rest as unique.
+
+  Each block of data is only counted the first time it is added, so filling a
+  single MemoryUsage from several workspaces gives the total of the distinct
+  data they hold.
+*/
+class MANTID_API_DLL MemoryUsage {
+public:
+  /// The kinds of data that are accounted for
+  enum class Data { X, Y, E, Dx, Events, Other };
+
+  void add(const Data data, const void *address, const size_t bytes,
+           const bool shared);
+
+  /**
+   * Add the data held by a copy-on-write pointer to a histogram vector
+   * @param data :: the kind of data
+   * @param ptr :: a copy of the pointer, e.g. as returned by
+   * Histogram::sharedX(). The copy itself is not counted as an owner.
+   */
+  template <class T>
+  void add(const Data data, const Kernel::cow_ptr<T> &ptr) {
+    if (ptr)
+      add(data, ptr.get(), ptr->size() * sizeof(double), ptr.use_count() > 2);
+  }
+
+  size_t unique(const Data data) const;
+  size_t shared(const Data data) const;
+  size_t unique() const;
+  size_t shared() const;
+  size_t total() const;
+
+private:
+  static constexpr size_t numberOfKinds = 6;
+  std::array<size_t, numberOfKinds> m_unique{};
+  std::array<size_t, numberOfKinds> m_shared{};
+  /// The addresses of the data added so far
+  std::unordered_set<const void *> m_counted;
+};
+
+} // namespace API
+} // namespace Mantid
@@ -0,0 +1,102 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidKernel/DeltaEMode.h"
+#include "MantidKernel/Unit.h"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class ExperimentInfo;
+
+/** SpectrumGeometryTable holds the per-spectrum geometry that unit conversion
+  and related algorithms need in their inner loops: L2, 2-theta, azimuthal
+  angle, uncalibrated DIFC and efixed, stored as contiguous arrays indexed by
+  workspace index.
+
+  SpectrumInfo computes these values on every call, averaging over all
+  detectors of a spectrum. The table is cached by ExperimentInfo, see
+  ExperimentInfo::spectrumGeometryTable(), and computes each column once (in
+  parallel) on first access, such that algorithms only pay for the columns
+  they use. It is invalidated by any non-const access to the instrument, the
+  run, or the spectrum-detector mapping.
+
+  Values that are undefined for a given spectrum are NaN: all values for
+  spectra without detectors, all values but L2 for monitors, and efixed for
+  elastic workspaces or if no efixed is available.
+*/
+class MANTID_API_DLL SpectrumGeometryTable {
+public:
+  explicit SpectrumGeometryTable(const ExperimentInfo &experimentInfo);
+
+  size_t size() const;
+  Kernel::DeltaEMode::Type emode() const;
+  double l1() const;
+
+  bool hasDetectors(const size_t index) const;
+  bool isMonitor(const size_t index) const;
+  double l2(const size_t index) const;
+  double twoTheta(const size_t index) const;
+  double signedTwoTheta(const size_t index) const;
+  double azimuthal(const size_t index) const;
+  double difcUncalibrated(const size_t index) const;
+  double efixed(const size_t index) const;
+
+  const std::vector<double> &l2() const;
+  const std::vector<double> &twoTheta() const;
+  const std::vector<double> &signedTwoTheta() const;
+  const std::vector<double> &azimuthal() const;
+  const std::vector<double> &difcUncalibrated() const;
+  const std::vector<double> &efixed() const;
+  const std::vector<double> &efixed(const Kernel::DeltaEMode::Type emode) const;
+
+  void prepareDetectorValues(const Kernel::Unit &inputUnit,
+                             const Kernel::Unit &outputUnit,
+                             const Kernel::DeltaEMode::Type emode,
+                             const bool signedTheta,
+                             const bool lookUpEFixed) const;
+  void getDetectorValues(const Kernel::Unit &inputUnit,
+                         const Kernel::Unit &outputUnit,
+                         const Kernel::DeltaEMode::Type emode,
+                         const bool signedTheta, const size_t index,
+                         Kernel::UnitParametersMap &pmap) const;
+
+private:
+  struct Column {
+    std::once_flag computed;
+    std::vector<double> values;
+  };
+  static bool usesCalibration(const Kernel::Unit &inputUnit,
+                              const Kernel::Unit &outputUnit,
+                              const Kernel::DeltaEMode::Type emode);
+  const std::vector<double> &
+  column(Column &column, const bool includeMonitors,
+         const std::function<double(const size_t)> &value) const;
+
+  const ExperimentInfo &m_experimentInfo;
+  Kernel::DeltaEMode::Type m_emode;
+  double m_l1;
+  // char rather than bool such that flags can be written from several threads
+  std::vector<char> m_hasDetectors;
+  std::vector<char> m_isMonitor;
+  mutable Column m_l2;
+  mutable Column m_twoTheta;
+  mutable Column m_signedTwoTheta;
+  mutable Column m_azimuthal;
+  mutable Column m_difcUncalibrated;
+  mutable Column m_directEFixed;
+  mutable Column m_indirectEFixed;
+  mutable Column m_elasticEFixed;
+};
+
+} // namespace API
+} // namespace Mantid
@@ -20,6 +20,7 @@ class Logger;
 
 namespace API {
 class AnalysisDataServiceImpl;
+class MemoryUsage;
 class WorkspaceHistory;
 
 /** Base Workspace Abstract Class.
@@ -78,6 +79,10 @@ public:
   virtual size_t getMemorySize() const = 0;
   /// Returns the memory footprint in sensible units
   std::string getMemorySizeAsStr() const;
+  /// Add the memory used by the data, split into unique and shared data
+  virtual void addMemoryUsage(MemoryUsage &usage) const;
+  /// Returns the memory used by the data, split into unique and shared data
+  MemoryUsage getMemoryUsage() const;
 
   /// Returns a reference to the WorkspaceHistory
   WorkspaceHistory &history() { return *m_history; }
@@ -344,6 +344,42 @@ AnalysisDataServiceImpl::topLevelItems() const {
   return topLevel;
 }
 
+/**
+ * Return the memory used by the data of each workspace, including hidden
+ * ones. Groups are not listed as their members are.
+ * @return A map from workspace name to its memory usage. Data shared by
+ * workspaces is counted as shared in each of them.
+ */
+std::map<std::string, MemoryUsage>
+AnalysisDataServiceImpl::memoryUsage() const {
+  std::map<std::string, MemoryUsage> usage;
+  for (const auto &name : getObjectNames(Kernel::DataServiceSort::Unsorted,
+                                         Kernel::DataServiceHidden::Include)) {
+    try {
+      const auto ws = retrieve(name);
+      if (!ws->isGroup())
+        usage.emplace(name, ws->getMemoryUsage());
+    } catch (const Kernel::Exception::NotFoundError &) {
+      // removed since the names were listed
+    }
+  }
+  return usage;
+}
+
+/**
+ * Return the memory used by the data of all workspaces, including hidden
+ * ones. Data shared by several workspaces is counted once.
+ * @return The memory usage of the distinct data
+ */
+MemoryUsage AnalysisDataServiceImpl::totalMemoryUsage() const {
+  MemoryUsage usage;
+  for (const auto &ws : getObjects(Kernel::DataServiceHidden::Include)) {
+    if (!ws->isGroup())
+      ws->addMemoryUsage(usage);
+  }
+  return usage;
+}
+
 void AnalysisDataServiceImpl::shutdown() { clear(); }
 
 //-------------------------------------------------------------------------
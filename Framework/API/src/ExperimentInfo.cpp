@@ -10,6 +10,7 @@
 #include "MantidAPI/ResizeRectangularDetectorHelper.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/Sample.h"
+#include "MantidAPI/SpectrumGeometryTable.h"
 #include "MantidAPI/SpectrumInfo.h"
 
 #include "MantidGeometry/Crystal/OrientedLattice.h"
@@ -183,6 +184,7 @@ void checkDetectorInfoSize(const Instrument &instr,
  */
 void ExperimentInfo::setInstrument(const Instrument_const_sptr &instr) {
   m_spectrumInfoWrapper = nullptr;
+  invalidateSpectrumGeometryTable();
 
   // Detector IDs that were previously dropped because they were not part of the
   // instrument may now suddenly be valid, so we have to reinitialize the
@@ -221,6 +223,7 @@ Instrument_const_sptr ExperimentInfo::getInstrument() const {
  */
 Geometry::ParameterMap &ExperimentInfo::instrumentParameters() {
   populateIfNotLoaded();
+  invalidateSpectrumGeometryTable();
   return *m_parmap;
 }
 
@@ -456,6 +459,7 @@ void ExperimentInfo::setNumberOfDetectorGroups(const size_t count) const {
   m_spectrumDefinitionNeedsUpdate.resize(count, 1);
   m_spectrumInfo = std::make_unique<Beamline::SpectrumInfo>(count);
   m_spectrumInfoWrapper = nullptr;
+  invalidateSpectrumGeometryTable();
 }
 
 /** Returns the number of detector groups.
@@ -532,12 +536,14 @@ const Run &ExperimentInfo::run() const {
  */
 Run &ExperimentInfo::mutableRun() {
   populateIfNotLoaded();
+  invalidateSpectrumGeometryTable();
   return m_run.access();
 }
 
 /// Set the run object. Use in particular to clear run without copying old run.
 void ExperimentInfo::setSharedRun(Kernel::cow_ptr<Run> run) {
   m_run = std::move(run);
+  invalidateSpectrumGeometryTable();
 }
 
 /// Return the cow ptr of the run
@@ -823,6 +829,7 @@ const Geometry::DetectorInfo &ExperimentInfo::detectorInfo() const {
 /** Return a non-const reference to the DetectorInfo object. */
 Geometry::DetectorInfo &ExperimentInfo::mutableDetectorInfo() {
   populateIfNotLoaded();
+  invalidateSpectrumGeometryTable();
   return m_parmap->mutableDetectorInfo();
 }
 
@@ -880,6 +887,7 @@ const SpectrumInfo &ExperimentInfo::spectrumInfo() const {
 /** Return a non-const reference to the SpectrumInfo object. Not thread safe.
  */
 SpectrumInfo &ExperimentInfo::mutableSpectrumInfo() {
+  invalidateSpectrumGeometryTable();
   return const_cast<SpectrumInfo &>(
       static_cast<const ExperimentInfo &>(*this).spectrumInfo());
 }
@@ -889,6 +897,7 @@ const Geometry::ComponentInfo &ExperimentInfo::componentInfo() const {
 }
 
 ComponentInfo &ExperimentInfo::mutableComponentInfo() {
+  invalidateSpectrumGeometryTable();
   return m_parmap->mutableComponentInfo();
 }
 
@@ -906,6 +915,7 @@ void ExperimentInfo::setSpectrumDefinitions(
     invalidateAllSpectrumDefinitions();
   }
   m_spectrumInfoWrapper = nullptr;
+  invalidateSpectrumGeometryTable();
 }
 
 /** Notifies the ExperimentInfo that a spectrum definition has changed.
@@ -917,6 +927,7 @@ void ExperimentInfo::invalidateSpectrumDefinition(const size_t index) {
   // This uses a vector of char, such that flags for different indices can be
   // set from different threads (std::vector<bool> is not thread-safe).
   m_spectrumDefinitionNeedsUpdate.at(index) = 1;
+  invalidateSpectrumGeometryTable();
 }
 
 void ExperimentInfo::updateSpectrumDefinitionIfNecessary(
@@ -952,6 +963,30 @@ void ExperimentInfo::cacheDefaultDetectorGrouping() const {
 void ExperimentInfo::invalidateAllSpectrumDefinitions() {
   std::fill(m_spectrumDefinitionNeedsUpdate.begin(),
             m_spectrumDefinitionNeedsUpdate.end(), 1);
+  invalidateSpectrumGeometryTable();
+}
+
+/** Return a reference to the SpectrumGeometryTable, holding L2, 2-theta,
+ * azimuthal angle and efixed of all spectra as contiguous arrays.
+ *
+ * The table is created on first access and computes each column when it is
+ * first used. It is cached until the instrument, its parameters, the run or
+ * the spectrum-detector mapping are accessed for modification. As for
+ * SpectrumInfo, such modifications invalidate the returned reference.
+ */
+const SpectrumGeometryTable &ExperimentInfo::spectrumGeometryTable() const {
+  populateIfNotLoaded();
+  std::lock_guard<std::mutex> lock{m_spectrumGeometryTableMutex};
+  if (!m_spectrumGeometryTableValid || !m_spectrumGeometryTable) {
+    m_spectrumGeometryTable = std::make_shared<SpectrumGeometryTable>(*this);
+    m_spectrumGeometryTableValid = true;
+  }
+  return *m_spectrumGeometryTable;
+}
+
+/// Flags the SpectrumGeometryTable for recomputation on next access.
+void ExperimentInfo::invalidateSpectrumGeometryTable() const {
+  m_spectrumGeometryTableValid = false;
 }
 
 /** Save the object to an open NeXus file.
@@ -8,11 +8,36 @@
 #include "MantidAPI/IFileLoader.h"
 #include "MantidAPI/NexusFileLoader.h"
 
+#include <Poco/Exception.h>
 #include <Poco/File.h>
 
 namespace Mantid {
 namespace API {
 namespace {
+/// The number of recently searched files whose information is kept
+constexpr size_t MAX_RECENT_FILES = 16;
+/// The highest confidence a loader can return
+constexpr int MAX_CONFIDENCE = 100;
+
+/**
+ * Get the modification time and size identifying the version of a file
+ * @param filename A string giving a filename
+ * @param lastModified Output, the modification time in microseconds
+ * @param size Output, the size in bytes
+ * @return False if the file could not be inspected
+ */
+bool getFileStamp(const std::string &filename, int64_t &lastModified,
+                  uint64_t &size) {
+  try {
+    const Poco::File file(filename);
+    lastModified = file.getLastModified().epochMicroseconds();
+    size = file.getSize();
+    return true;
+  } catch (Poco::Exception &) {
+    return false;
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 // Anonymous namespace helpers
 //----------------------------------------------------------------------------------------------
@@ -42,7 +67,7 @@ template <> struct DescriptorSetter<Kernel::NexusHDF5Descriptor> {
 /// @endcond
 
 /**
- * @param filename A string giving a filename
+ * @param descriptor A descriptor of the file, shared by all loaders
  * @param names The collection of names to search through
  * @param logger A reference to a Mantid Logger object
  * @return  A string containing the name of an algorithm to load the file, or an
@@ -51,13 +76,12 @@ template <> struct DescriptorSetter<Kernel::NexusHDF5Descriptor> {
  */
 template <typename DescriptorType, typename FileLoaderType>
 const IAlgorithm_sptr
-searchForLoader(const std::string &filename,
+searchForLoader(std::shared_ptr<DescriptorType> descriptor,
                 const std::multimap<std::string, int> &names,
                 Kernel::Logger &logger) {
   const auto &factory = AlgorithmFactory::Instance();
   IAlgorithm_sptr bestLoader;
   int maxConfidence(0);
-  auto descriptor = std::make_shared<DescriptorType>(filename);
   DescriptorCallback<DescriptorType> callback;
   DescriptorSetter<DescriptorType> setdescriptor;
 
@@ -85,6 +109,9 @@ searchForLoader(const std::string &filename,
                        << exc.what() << "'. Loader skipped.\n";
     }
     callback.apply(descriptor);
+    // No other loader can be strictly more confident
+    if (maxConfidence >= MAX_CONFIDENCE)
+      break;
   }
 
   auto nxsLoader = std::dynamic_pointer_cast<NexusFileLoader>(bestLoader);
@@ -111,12 +138,14 @@ void FileLoaderRegistryImpl::unsubscribe(const std::string &name,
   for (auto it = m_names.begin(); it != iend; ++it) {
     removeAlgorithm(name, version, *it);
   }
+  clearCache();
 }
 
 /**
  * Queries each registered algorithm and asks it how confident it is that it can
  * load the given file. The name of the one with the highest confidence is
- * returned.
+ * returned. The choice is remembered for recently searched files, it is reused
+ * as long as the modification time and size of the file do not change.
  * @param filename A full file path pointing to an existing file
  * @return A string containing the name of an algorithm to load the file
  * @throws Exception::NotFoundError if an algorithm cannot be found
@@ -128,7 +157,12 @@ FileLoaderRegistryImpl::chooseLoader(const std::string &filename) const {
   using Kernel::NexusHDF5Descriptor;
   m_log.debug() << "Trying to find loader for '" << filename << "'\n";
 
-  IAlgorithm_sptr bestLoader;
+  IAlgorithm_sptr bestLoader = createRememberedLoader(filename);
+  if (bestLoader) {
+    m_log.debug() << "Using loader " << bestLoader->name()
+                  << " found previously for file '" << filename << "'\n";
+    return bestLoader;
+  }
   if (NexusDescriptor::isReadable(filename)) {
     m_log.debug()
         << filename
@@ -139,7 +173,7 @@ FileLoaderRegistryImpl::chooseLoader(const std::string &filename) const {
       try {
         bestLoader = searchForLoader<NexusHDF5Descriptor,
                                      IFileLoader<NexusHDF5Descriptor>>(
-            filename, m_names[NexusHDF5], m_log);
+            nexusHDF5Descriptor(filename), m_names[NexusHDF5], m_log);
       } catch (const std::invalid_argument &e) {
         m_log.debug() << "Error in looking for HDF5 based NeXus files: "
                       << e.what() << '\n';
@@ -150,12 +184,13 @@ FileLoaderRegistryImpl::chooseLoader(const std::string &filename) const {
     if (!bestLoader) {
       bestLoader =
           searchForLoader<NexusDescriptor, IFileLoader<NexusDescriptor>>(
-              filename, m_names[Nexus], m_log);
+              std::make_shared<NexusDescriptor>(filename), m_names[Nexus],
+              m_log);
     }
   } else {
     m_log.debug() << "Checking registered non-HDF loaders\n";
     bestLoader = searchForLoader<FileDescriptor, IFileLoader<FileDescriptor>>(
-        filename, m_names[Generic], m_log);
+        std::make_shared<FileDescriptor>(filename), m_names[Generic], m_log);
   }
 
   if (!bestLoader) {
@@ -163,6 +198,7 @@ FileLoaderRegistryImpl::chooseLoader(const std::string &filename) const {
   }
   m_log.debug() << "Found loader " << bestLoader->name() << " for file '"
                 << filename << "'\n";
+  rememberLoader(filename, *bestLoader);
   return bestLoader;
 }
 
@@ -197,14 +233,14 @@ bool FileLoaderRegistryImpl::canLoad(const std::string &algorithmName,
   if (nexus) {
     if (NexusDescriptor::isReadable(filename)) {
       loader = searchForLoader<NexusDescriptor, IFileLoader<NexusDescriptor>>(
-          filename, names, m_log);
+          std::make_shared<NexusDescriptor>(filename), names, m_log);
     }
   } else if (nexusHDF5) {
     if (NexusHDF5Descriptor::isReadable(filename)) {
       try {
         loader = searchForLoader<NexusHDF5Descriptor,
                                  IFileLoader<NexusHDF5Descriptor>>(
-            filename, names, m_log);
+            nexusHDF5Descriptor(filename), names, m_log);
       } catch (const std::invalid_argument &e) {
         m_log.debug() << "Error in looking for HDF5 based NeXus files: "
                       << e.what() << '\n';
@@ -212,11 +248,48 @@ bool FileLoaderRegistryImpl::canLoad(const std::string &algorithmName,
     }
   } else if (nonHDF) {
     loader = searchForLoader<FileDescriptor, IFileLoader<FileDescriptor>>(
-        filename, names, m_log);
+        std::make_shared<FileDescriptor>(filename), names, m_log);
   }
   return static_cast<bool>(loader);
 }
 
+/**
+ * Describing an HDF5 based NeXus file walks all of its entries, which is slow
+ * for large files. The descriptors of recently searched files are kept and
+ * shared by the loader search and the chosen loader until the modification
+ * time or size of the file change.
+ * @param filename A full file path pointing to an existing file
+ * @return A descriptor of the file
+ * @throws std::invalid_argument if the file is not an HDF5 file
+ */
+std::shared_ptr<Kernel::NexusHDF5Descriptor>
+FileLoaderRegistryImpl::nexusHDF5Descriptor(const std::string &filename) const {
+  int64_t lastModified(0);
+  uint64_t size(0);
+  if (!getFileStamp(filename, lastModified, size))
+    return std::make_shared<Kernel::NexusHDF5Descriptor>(filename);
+  {
+    std::lock_guard<std::mutex> lock(m_recentFilesMutex);
+    const auto &recent = recentFile(filename, lastModified, size);
+    if (recent.nexusHDF5Descriptor)
+      return recent.nexusHDF5Descriptor;
+  }
+  // Not holding the lock while reading the file
+  auto descriptor = std::make_shared<Kernel::NexusHDF5Descriptor>(filename);
+  std::lock_guard<std::mutex> lock(m_recentFilesMutex);
+  recentFile(filename, lastModified, size).nexusHDF5Descriptor = descriptor;
+  return descriptor;
+}
+
+/**
+ * Forget the descriptors and chosen loaders of all recently searched files.
+ * Called when loaders are subscribed or unsubscribed.
+ */
+void FileLoaderRegistryImpl::clearCache() const {
+  std::lock_guard<std::mutex> lock(m_recentFilesMutex);
+  m_recentFiles.clear();
+}
+
 //----------------------------------------------------------------------------------------------
 // Private members
 //----------------------------------------------------------------------------------------------
@@ -253,5 +326,83 @@ void FileLoaderRegistryImpl::removeAlgorithm(
   }
 }
 
+/**
+ * Find the information about a recently searched file and move it to the front
+ * of the list. Outdated information is replaced. m_recentFilesMutex must be
+ * locked.
+ * @param filename A full file path
+ * @param lastModified The current modification time of the file
+ * @param size The current size of the file
+ * @return The information about the file, empty if it was not searched before
+ */
+FileLoaderRegistryImpl::RecentFile &
+FileLoaderRegistryImpl::recentFile(const std::string &filename,
+                                   const int64_t lastModified,
+                                   const uint64_t size) const {
+  auto it = std::find_if(
+      m_recentFiles.begin(), m_recentFiles.end(),
+      [&filename](const auto &recent) { return recent.filename == filename; });
+  if (it != m_recentFiles.end()) {
+    if (it->lastModified == lastModified && it->size == size) {
+      m_recentFiles.splice(m_recentFiles.begin(), m_recentFiles, it);
+      return m_recentFiles.front();
+    }
+    m_recentFiles.erase(it);
+  }
+  m_recentFiles.push_front(
+      RecentFile{filename, lastModified, size, nullptr, "", -1});
+  if (m_recentFiles.size() > MAX_RECENT_FILES)
+    m_recentFiles.pop_back();
+  return m_recentFiles.front();
+}
+
+/**
+ * Create the loader chosen when the unchanged file was last searched
+ * @param filename A full file path
+ * @return The loader, or null if the file was not searched before
+ */
+IAlgorithm_sptr
+FileLoaderRegistryImpl::createRememberedLoader(
+    const std::string &filename) const {
+  int64_t lastModified(0);
+  uint64_t size(0);
+  if (!getFileStamp(filename, lastModified, size))
+    return nullptr;
+  std::string name;
+  int version(-1);
+  std::shared_ptr<Kernel::NexusHDF5Descriptor> descriptor;
+  {
+    std::lock_guard<std::mutex> lock(m_recentFilesMutex);
+    const auto &recent = recentFile(filename, lastModified, size);
+    if (recent.loaderName.empty())
+      return nullptr;
+    name = recent.loaderName;
+    version = recent.loaderVersion;
+    descriptor = recent.nexusHDF5Descriptor;
+  }
+  auto loader = AlgorithmFactory::Instance().create(name, version);
+  auto nxsLoader = std::dynamic_pointer_cast<NexusFileLoader>(loader);
+  if (nxsLoader && descriptor)
+    nxsLoader->setFileInfo(descriptor);
+  return loader;
+}
+
+/**
+ * Remember the loader chosen for a file
+ * @param filename A full file path
+ * @param loader The loader chosen for the file
+ */
+void FileLoaderRegistryImpl::rememberLoader(const std::string &filename,
+                                            const IAlgorithm &loader) const {
+  int64_t lastModified(0);
+  uint64_t size(0);
+  if (!getFileStamp(filename, lastModified, size))
+    return;
+  std::lock_guard<std::mutex> lock(m_recentFilesMutex);
+  auto &recent = recentFile(filename, lastModified, size);
+  recent.loaderName = loader.name();
+  recent.loaderVersion = loader.version();
+}
+
 } // namespace API
 } // namespace Mantid
@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/ISpectrum.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/MemoryUsage.h"
 #include "MantidHistogramData/Histogram.h"
 #include "MantidKernel/System.h"
 
@@ -29,6 +30,18 @@ void ISpectrum::copyInfoFrom(const ISpectrum &other) {
   invalidateSpectrumDefinition();
 }
 
+/**
+ * Add the memory used by the X, Y, E and Dx data of this spectrum
+ * @param usage :: the memory usage to add to
+ */
+void ISpectrum::addMemoryUsage(MemoryUsage &usage) const {
+  const auto &histogram = histogramRef();
+  usage.add(MemoryUsage::Data::X, histogram.sharedX());
+  usage.add(MemoryUsage::Data::Y, histogram.sharedY());
+  usage.add(MemoryUsage::Data::E, histogram.sharedE());
+  usage.add(MemoryUsage::Data::Dx, histogram.sharedDx());
+}
+
 /**
  * Return the min/max X values for this spectrum.
  * @returns A pair where the first is the minimum X value
@@ -8,6 +8,7 @@
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/BinEdgeAxis.h"
 #include "MantidAPI/MatrixWorkspaceMDIterator.h"
+#include "MantidAPI/MemoryUsage.h"
 #include "MantidAPI/NumericAxis.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/Sample.h"
@@ -65,6 +66,26 @@ namespace {
 Kernel::Logger g_log("MatrixWorkspace");
 constexpr const double EPSILON{1.0e-9};
 
+/** Whether two vectors of the same size hold exactly the same values. The
+ * values are compared in blocks without branches, allowing the compiler to
+ * vectorize the loop. NaN values are never equal.
+ */
+bool allEqual(const std::vector<double> &lhs, const std::vector<double> &rhs) {
+  constexpr size_t blockSize = 256;
+  const double *a = lhs.data();
+  const double *b = rhs.data();
+  const size_t size = lhs.size();
+  for (size_t start = 0; start < size; start += blockSize) {
+    const size_t end = std::min(size, start + blockSize);
+    int different = 0;
+    for (size_t i = start; i < end; ++i)
+      different |= a[i] != b[i];
+    if (different)
+      return false;
+  }
+  return true;
+}
+
 /** Append the x-unit of the workspace to the y-unit label as a denominator
  * E.g. if a workspace has y-unit label "Counts" and x-unit angstrom, the y-unit
  * label becomes "Counts per angstrom". Or if useLatex is true "Counts per
@@ -121,7 +142,9 @@ MatrixWorkspace::MatrixWorkspace(const MatrixWorkspace &other)
     : IMDWorkspace(other), ExperimentInfo(other),
       m_isInitialized(other.m_isInitialized), m_YUnit(other.m_YUnit),
       m_YUnitLabel(other.m_YUnitLabel),
-      m_isCommonBinsFlag(other.m_isCommonBinsFlag), m_masks(other.m_masks),
+      m_isCommonBinsFlag(other.m_isCommonBinsFlag),
+      m_commonBinsSharedX(other.m_commonBinsSharedX.load()),
+      m_masks(other.m_masks),
       m_indexInfoNeedsUpdate(false) {
   m_indexInfo = std::make_unique<Indexing::IndexInfo>(other.indexInfo());
   m_axes.resize(other.m_axes.size());
@@ -590,6 +613,36 @@ std::vector<size_t> MatrixWorkspace::getDetectorIDToWorkspaceIndexVector(
   return out;
 }
 
+/** Return a vector where:
+ *    The index into the vector = detector index in the DetectorInfo
+ *    The value at that index = the corresponding Workspace Index
+ *
+ *  Detectors without a spectrum map to std::numeric_limits<size_t>::max().
+ *  @returns :: vector set to above definition, empty if the mapping is not
+ *one-to-one, i.e., if a spectrum has more than one detector, a detector is in
+ *more than one spectrum, or the detectors are scanning
+ */
+std::vector<size_t>
+MatrixWorkspace::getDetectorIndexToWorkspaceIndexVector() const {
+  const auto &detInfo = detectorInfo();
+  if (detInfo.isScanning())
+    return {};
+  std::vector<size_t> out(detInfo.size(), std::numeric_limits<size_t>::max());
+  for (size_t workspaceIndex = 0; workspaceIndex < getNumberHistograms();
+       ++workspaceIndex) {
+    const auto &detList = getSpectrum(workspaceIndex).getDetectorIDs();
+    if (detList.empty())
+      continue;
+    if (detList.size() > 1)
+      return {};
+    auto &index = out[detInfo.indexOf(*detList.begin())];
+    if (index != std::numeric_limits<size_t>::max())
+      return {};
+    index = workspaceIndex;
+  }
+  return out;
+}
+
 /** Converts a list of spectrum numbers to the corresponding workspace indices.
  *  Not a very efficient operation, but unfortunately it's sometimes required.
  *
@@ -935,6 +988,26 @@ void MatrixWorkspace::replaceAxis(const std::size_t &axisIndex,
   m_axes[axisIndex] = std::move(newAxis);
 }
 
+/**
+ * Sets the X data of a spectrum. If all spectra share their X data and x is
+ * that data, the workspace keeps its common bins and the cached flag stays
+ * valid. Otherwise the flag is invalidated.
+ * @param index :: the workspace index of the spectrum
+ * @param x :: the new X data
+ */
+void MatrixWorkspace::setSharedX(
+    const size_t index, const Kernel::cow_ptr<HistogramData::HistogramX> &x) & {
+  // Only atomics are read so the fast path does not take the mutex
+  if (m_isCommonBinsFlagValid.load()) {
+    const auto *commonX = m_commonBinsSharedX.load();
+    if (commonX && commonX == x.get()) {
+      getSpectrumWithoutInvalidation(index).setSharedX(x);
+      return;
+    }
+  }
+  getSpectrum(index).setSharedX(x);
+}
+
 /**
  *  Whether the workspace contains common X bins with logarithmic spacing
  *  @return whether the workspace contains common X bins with log spacing
@@ -1087,10 +1160,13 @@ bool MatrixWorkspace::isHistogramDataByIndex(const std::size_t index) const {
  */
 bool MatrixWorkspace::isCommonBins() const {
   std::lock_guard<std::mutex> lock{m_isCommonBinsMutex};
-  const bool isFlagValid{m_isCommonBinsFlagValid.exchange(true)};
-  if (isFlagValid) {
+  if (m_isCommonBinsFlagValid.load()) {
     return m_isCommonBinsFlag;
   }
+  // Reset the shared X before the flag is marked valid so that setSharedX()
+  // never sees a valid flag with a stale pointer
+  m_commonBinsSharedX.store(nullptr);
+  m_isCommonBinsFlagValid.store(true);
   m_isCommonBinsFlag = true;
   const size_t numHist = this->getNumberHistograms();
   // there being only one or zero histograms is accepted as not being an error
@@ -1109,6 +1185,7 @@ bool MatrixWorkspace::isCommonBins() const {
 
   // If true, we may return here.
   if (m_isCommonBinsFlag) {
+    m_commonBinsSharedX.store(first);
     return m_isCommonBinsFlag;
   }
 
@@ -1128,6 +1205,9 @@ bool MatrixWorkspace::isCommonBins() const {
     for (size_t i = 0; i < lastSpec; ++i) {
       const auto &xi = x(i);
       const auto &xip1 = x(i + 1);
+      // Identical values need no further checks
+      if (&xi == &xip1 || allEqual(xi.rawData(), xip1.rawData()))
+        continue;
       for (size_t j = 0; j < numBins; ++j) {
         const double a = xi[j];
         const double b = xip1[j];
@@ -1144,6 +1224,8 @@ bool MatrixWorkspace::isCommonBins() const {
           break;
         }
       }
+      if (!m_isCommonBinsFlag)
+        break;
     }
   }
   return m_isCommonBinsFlag;
@@ -1311,6 +1393,16 @@ size_t MatrixWorkspace::getMemorySize() const {
   return 3 * size() * sizeof(double) + run().getMemorySize();
 }
 
+/**
+ * Add the memory used by the data of the spectra and the run
+ * @param usage :: the memory usage to add to
+ */
+void MatrixWorkspace::addMemoryUsage(MemoryUsage &usage) const {
+  for (size_t i = 0; i < getNumberHistograms(); ++i)
+    getSpectrum(i).addMemoryUsage(usage);
+  usage.add(MemoryUsage::Data::Other, &run(), run().getMemorySize(), false);
+}
+
 /** Returns the memory used (in bytes) by the X axes, handling ragged bins.
  * @return bytes used
  */
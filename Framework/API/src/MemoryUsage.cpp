@@ -0,0 +1,53 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/MemoryUsage.h"
+
+#include <numeric>
+
+namespace Mantid {
+namespace API {
+
+/**
+ * Add a block of data. Nothing is done if the block was added before.
+ * @param data :: the kind of data
+ * @param address :: the address identifying the block of data
+ * @param bytes :: the size of the data in bytes
+ * @param shared :: true if the data is shared with other owners
+ */
+void MemoryUsage::add(const Data data, const void *address,
+                      const size_t bytes, const bool shared) {
+  if (address && !m_counted.insert(address).second)
+    return;
+  auto &usage = shared ? m_shared : m_unique;
+  usage[static_cast<size_t>(data)] += bytes;
+}
+
+/// Returns the bytes of the given kind of data that are not shared
+size_t MemoryUsage::unique(const Data data) const {
+  return m_unique[static_cast<size_t>(data)];
+}
+
+/// Returns the bytes of the given kind of data that are shared
+size_t MemoryUsage::shared(const Data data) const {
+  return m_shared[static_cast<size_t>(data)];
+}
+
+/// Returns the bytes of all data that is not shared
+size_t MemoryUsage::unique() const {
+  return std::accumulate(m_unique.cbegin(), m_unique.cend(), size_t{0});
+}
+
+/// Returns the bytes of all data that is shared
+size_t MemoryUsage::shared() const {
+  return std::accumulate(m_shared.cbegin(), m_shared.cend(), size_t{0});
+}
+
+/// Returns the bytes of all data
+size_t MemoryUsage::total() const { return unique() + shared(); }
+
+} // namespace API
+} // namespace Mantid
@@ -5,15 +5,16 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/NexusFileLoader.h"
+#include "MantidAPI/FileLoaderRegistry.h"
 
 namespace Mantid::API {
 void NexusFileLoader::exec() {
-  // make sure the descriptor is initialized
+  // make sure the descriptor is initialized, reusing the one created when
+  // searching for a loader if the file is unchanged
   if (!m_fileInfo) {
     const std::string filename =
         this->getPropertyValue(this->getFilenamePropertyName());
-    m_fileInfo =
-        std::make_shared<Mantid::Kernel::NexusHDF5Descriptor>(filename);
+    m_fileInfo = FileLoaderRegistry::Instance().nexusHDF5Descriptor(filename);
   }
 
   // execute the algorithm as normal
@@ -0,0 +1,307 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/SpectrumGeometryTable.h"
+#include "MantidAPI/ExperimentInfo.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidGeometry/IComponent.h"
+#include "MantidGeometry/IDetector.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <cmath>
+#include <limits>
+#include <set>
+
+namespace Mantid {
+namespace API {
+
+namespace {
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+}
+
+/** Set up the table for the current state of `experimentInfo`. Only the
+ * spectrum flags and L1 are computed here, all other columns are computed on
+ * first access.
+ *
+ * @param experimentInfo :: the ExperimentInfo (typically a MatrixWorkspace)
+ * providing the instrument, the spectrum-detector mapping and the run logs.
+ * It must outlive the table.
+ */
+SpectrumGeometryTable::SpectrumGeometryTable(
+    const ExperimentInfo &experimentInfo)
+    : m_experimentInfo(experimentInfo), m_emode(experimentInfo.getEMode()),
+      m_l1(NaN) {
+  const auto &spectrumInfo = experimentInfo.spectrumInfo();
+  const auto nSpectra = spectrumInfo.size();
+  m_hasDetectors.resize(nSpectra, 0);
+  m_isMonitor.resize(nSpectra, 0);
+
+  try {
+    m_l1 = spectrumInfo.l1();
+  } catch (std::exception &) {
+    // Without source or sample there is no meaningful geometry
+    return;
+  }
+
+  const auto nSpectra_i = static_cast<int64_t>(nSpectra);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nSpectra_i; ++i) {
+    const auto index = static_cast<size_t>(i);
+    if (!spectrumInfo.hasDetectors(index))
+      continue;
+    m_hasDetectors[index] = 1;
+    m_isMonitor[index] = spectrumInfo.isMonitor(index) ? 1 : 0;
+  }
+}
+
+/// Returns the number of spectra in the table.
+size_t SpectrumGeometryTable::size() const { return m_hasDetectors.size(); }
+
+/// Returns the energy mode of the workspace, used by efixed().
+Kernel::DeltaEMode::Type SpectrumGeometryTable::emode() const {
+  return m_emode;
+}
+
+/// Returns L1 (distance from source to sample), NaN if undefined.
+double SpectrumGeometryTable::l1() const { return m_l1; }
+
+/// Returns true if the spectrum is associated with detectors in the
+/// instrument.
+bool SpectrumGeometryTable::hasDetectors(const size_t index) const {
+  return m_hasDetectors[index] != 0;
+}
+
+/// Returns true if the detector(s) associated with the spectrum are monitors.
+bool SpectrumGeometryTable::isMonitor(const size_t index) const {
+  return m_isMonitor[index] != 0;
+}
+
+/// Returns L2 (distance from sample to spectrum).
+double SpectrumGeometryTable::l2(const size_t index) const {
+  return l2()[index];
+}
+
+/// Returns the scattering angle 2-theta in radians.
+double SpectrumGeometryTable::twoTheta(const size_t index) const {
+  return twoTheta()[index];
+}
+
+/// Returns the signed scattering angle 2-theta in radians.
+double SpectrumGeometryTable::signedTwoTheta(const size_t index) const {
+  return signedTwoTheta()[index];
+}
+
+/// Returns the out-of-plane angle in radians.
+double SpectrumGeometryTable::azimuthal(const size_t index) const {
+  return azimuthal()[index];
+}
+
+/// Returns DIFC computed from L1, L2 and 2-theta, ignoring any calibration.
+double SpectrumGeometryTable::difcUncalibrated(const size_t index) const {
+  return difcUncalibrated()[index];
+}
+
+/// Returns efixed for the energy mode of the workspace.
+double SpectrumGeometryTable::efixed(const size_t index) const {
+  return efixed()[index];
+}
+
+/// Returns L2 for all spectra.
+const std::vector<double> &SpectrumGeometryTable::l2() const {
+  const auto &spectrumInfo = m_experimentInfo.spectrumInfo();
+  return column(m_l2, true,
+                [&](const size_t index) { return spectrumInfo.l2(index); });
+}
+
+/// Returns the scattering angle 2-theta for all spectra.
+const std::vector<double> &SpectrumGeometryTable::twoTheta() const {
+  const auto &spectrumInfo = m_experimentInfo.spectrumInfo();
+  return column(m_twoTheta, false, [&](const size_t index) {
+    return spectrumInfo.twoTheta(index);
+  });
+}
+
+/// Returns the signed scattering angle 2-theta for all spectra.
+const std::vector<double> &SpectrumGeometryTable::signedTwoTheta() const {
+  const auto &spectrumInfo = m_experimentInfo.spectrumInfo();
+  return column(m_signedTwoTheta, false, [&](const size_t index) {
+    return spectrumInfo.signedTwoTheta(index);
+  });
+}
+
+/// Returns the azimuthal angle for all spectra.
+const std::vector<double> &SpectrumGeometryTable::azimuthal() const {
+  const auto &spectrumInfo = m_experimentInfo.spectrumInfo();
+  return column(m_azimuthal, false, [&](const size_t index) {
+    return spectrumInfo.azimuthal(index);
+  });
+}
+
+/// Returns the uncalibrated DIFC for all spectra, computed from the average
+/// L2 and 2-theta as SpectrumInfo::difcUncalibrated() does.
+const std::vector<double> &SpectrumGeometryTable::difcUncalibrated() const {
+  // Compute the dependencies up front, not from within the parallel loop
+  const auto &l2s = l2();
+  const auto &twoThetas = twoTheta();
+  return column(m_difcUncalibrated, false, [&](const size_t index) {
+    return 1. / Kernel::Units::tofToDSpacingFactor(m_l1, l2s[index],
+                                                   twoThetas[index], 0.);
+  });
+}
+
+/// Returns efixed for all spectra for the energy mode of the workspace.
+const std::vector<double> &SpectrumGeometryTable::efixed() const {
+  return efixed(m_emode);
+}
+
+/** Returns efixed for all spectra for the given energy mode. For direct
+ * geometry this is the Ei from the run logs, for indirect geometry the
+ * per-detector Efixed parameter.
+ */
+const std::vector<double> &
+SpectrumGeometryTable::efixed(const Kernel::DeltaEMode::Type emode) const {
+  if (emode == Kernel::DeltaEMode::Direct) {
+    // Ei is the same for all spectra, only look it up (once) if the column
+    // still needs to be computed
+    struct {
+      std::once_flag lookedUp;
+      double value = NaN;
+    } ei;
+    return column(m_directEFixed, false, [this, &ei](const size_t) {
+      std::call_once(ei.lookedUp, [&]() {
+        try {
+          ei.value = m_experimentInfo.getEFixedGivenEMode(
+              nullptr, Kernel::DeltaEMode::Direct);
+        } catch (std::runtime_error &) {
+        }
+      });
+      return ei.value;
+    });
+  }
+  if (emode == Kernel::DeltaEMode::Indirect) {
+    const auto &spectrumInfo = m_experimentInfo.spectrumInfo();
+    return column(m_indirectEFixed, false, [&](const size_t index) {
+      std::shared_ptr<const Geometry::IDetector> det(
+          &spectrumInfo.detector(index), NoDeleting());
+      return m_experimentInfo.getEFixedGivenEMode(det, emode);
+    });
+  }
+  return column(m_elasticEFixed, false, [](const size_t) { return NaN; });
+}
+
+/** Compute the columns that getDetectorValues() needs for the given
+ * arguments. Call this before calling getDetectorValues() from a parallel
+ * loop, such that the columns are computed in parallel rather than by the
+ * first thread using them.
+ *
+ * @param inputUnit :: The input unit
+ * @param outputUnit :: The output unit
+ * @param emode :: The energy mode
+ * @param signedTheta :: Whether signed 2-theta will be requested
+ * @param lookUpEFixed :: Whether efixed will be requested rather than being
+ * supplied by the caller
+ */
+void SpectrumGeometryTable::prepareDetectorValues(
+    const Kernel::Unit &inputUnit, const Kernel::Unit &outputUnit,
+    const Kernel::DeltaEMode::Type emode, const bool signedTheta,
+    const bool lookUpEFixed) const {
+  if (usesCalibration(inputUnit, outputUnit, emode))
+    return;
+  if (signedTheta)
+    signedTwoTheta();
+  difcUncalibrated();
+  if (lookUpEFixed && emode != Kernel::DeltaEMode::Elastic)
+    efixed(emode);
+}
+
+/** Get the detector values relevant to unit conversion for a workspace index
+ * from the table. This is equivalent to SpectrumInfo::getDetectorValues(),
+ * which is used for monitors and for calibrated diffractometer constants.
+ * Values that cannot be determined are not added to `pmap`.
+ *
+ * @param inputUnit :: The input unit (Empty implies "all")
+ * @param outputUnit :: The output unit (Empty implies "all")
+ * @param emode :: The energy mode
+ * @param signedTheta :: Return twotheta with sign or without
+ * @param index :: The workspace index
+ * @param pmap :: a map containing values for conversion parameters that are
+ * required by unit classes to perform their conversions, e.g., efixed. Values
+ * already present are not looked up, except for L2 and 2-theta.
+ */
+void SpectrumGeometryTable::getDetectorValues(
+    const Kernel::Unit &inputUnit, const Kernel::Unit &outputUnit,
+    const Kernel::DeltaEMode::Type emode, const bool signedTheta,
+    const size_t index, Kernel::UnitParametersMap &pmap) const {
+  using Kernel::UnitParams;
+  if (!hasDetectors(index))
+    return;
+  if (isMonitor(index) || usesCalibration(inputUnit, outputUnit, emode)) {
+    m_experimentInfo.spectrumInfo().getDetectorValues(
+        inputUnit, outputUnit, emode, signedTheta,
+        static_cast<int64_t>(index), pmap);
+    return;
+  }
+
+  pmap[UnitParams::l2] = l2(index);
+  const double theta = signedTheta ? signedTwoTheta(index) : twoTheta(index);
+  if (!std::isnan(theta))
+    pmap[UnitParams::twoTheta] = theta;
+  if (emode != Kernel::DeltaEMode::Elastic &&
+      pmap.find(UnitParams::efixed) == pmap.end()) {
+    const double value = efixed(emode)[index];
+    if (!std::isnan(value))
+      pmap[UnitParams::efixed] = value;
+  }
+  const double difc = difcUncalibrated(index);
+  if (!std::isnan(difc))
+    pmap[UnitParams::difc] = difc;
+}
+
+/// Returns true if a conversion between the units uses calibrated
+/// diffractometer constants rather than the geometry.
+bool SpectrumGeometryTable::usesCalibration(
+    const Kernel::Unit &inputUnit, const Kernel::Unit &outputUnit,
+    const Kernel::DeltaEMode::Type emode) {
+  static const std::set<std::string> diffConstUnits = {
+      "dSpacing", "MomentumTransfer", "Empty"};
+  return emode == Kernel::DeltaEMode::Elastic &&
+         (diffConstUnits.count(inputUnit.unitID()) ||
+          diffConstUnits.count(outputUnit.unitID()));
+}
+
+/** Returns `column`, computing it in parallel on first access.
+ *
+ * @param column :: the column to return
+ * @param includeMonitors :: whether the value is defined for monitors
+ * @param value :: computes the value for a workspace index. Exceptions leave
+ * the value undefined.
+ */
+const std::vector<double> &SpectrumGeometryTable::column(
+    Column &column, const bool includeMonitors,
+    const std::function<double(const size_t)> &value) const {
+  std::call_once(column.computed, [&]() {
+    column.values.assign(size(), NaN);
+    if (std::isnan(m_l1))
+      return;
+    const auto nSpectra = static_cast<int64_t>(size());
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < nSpectra; ++i) {
+      const auto index = static_cast<size_t>(i);
+      if (!hasDetectors(index) || (!includeMonitors && isMonitor(index)))
+        continue;
+      try {
+        column.values[index] = value(index);
+      } catch (std::exception &) {
+        // e.g., angles for an invalid reference frame or a missing efixed;
+        // let the consumers work out if this is a problem
+      }
+    }
+  });
+  return column.values;
+}
+
+} // namespace API
+} // namespace Mantid
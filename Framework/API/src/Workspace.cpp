@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/Workspace.h"
+#include "MantidAPI/MemoryUsage.h"
 #include "MantidAPI/WorkspaceHistory.h"
 #include "MantidKernel/IPropertyManager.h"
 #include "MantidKernel/Memory.h"
@@ -85,6 +86,26 @@ std::string Workspace::getMemorySizeAsStr() const {
       static_cast<uint64_t>(getMemorySize()) / 1024);
 }
 
+/**
+ * Add the memory used by the data of the workspace. By default all of
+ * getMemorySize() is counted as unique data of kind Other, workspaces holding
+ * shared data override this.
+ * @param usage :: the memory usage to add to
+ */
+void Workspace::addMemoryUsage(MemoryUsage &usage) const {
+  usage.add(MemoryUsage::Data::Other, this, getMemorySize(), false);
+}
+
+/**
+ * Returns the memory used by the data of the workspace
+ * @return the bytes of data, split into unique and shared data
+ */
+MemoryUsage Workspace::getMemoryUsage() const {
+  MemoryUsage usage;
+  addMemoryUsage(usage);
+  return usage;
+}
+
 /// Returns the storage mode (used for MPI runs)
 Parallel::StorageMode Workspace::storageMode() const { return m_storageMode; }
 
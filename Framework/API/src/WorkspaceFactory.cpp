@@ -71,10 +71,11 @@ WorkspaceFactoryImpl::create(const MatrixWorkspace_const_sptr &parent,
     YLength = parent->blocksize();
   }
 
-  // If the parent is an EventWorkspace, we want it to spawn a Workspace2D (or
-  // managed variant) as a child
+  // If the parent is an EventWorkspace, a single precision or a file backed
+  // workspace, we want it to spawn a Workspace2D (or managed variant) as a
+  // child
   std::string id(parent->id());
-  if (id == "EventWorkspace")
+  if (id == "EventWorkspace" || parent->childrenAreWorkspace2D())
     id = "Workspace2D";
 
   // Create an 'empty' workspace of the appropriate type and size
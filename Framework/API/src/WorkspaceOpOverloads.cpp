@@ -481,6 +481,53 @@ bool WorkspaceHelpers::sharedXData(const MatrixWorkspace &WS) {
   return true;
 }
 
+/** Makes spectra with identical X values share a single X vector, releasing
+ *  the memory of the duplicates. Spectra already sharing their X vector are
+ *  not compared again, so this is cheap for workspaces with common bins.
+ *  @param workspace :: The workspace to modify
+ *  @return The number of distinct X vectors left in the workspace
+ */
+size_t WorkspaceHelpers::shareIdenticalXData(MatrixWorkspace &workspace) {
+  using XVector = Kernel::cow_ptr<HistogramData::HistogramX>;
+  const auto numHist = static_cast<int64_t>(workspace.getNumberHistograms());
+  std::vector<XVector> xs;
+  xs.reserve(numHist);
+  for (int64_t i = 0; i < numHist; ++i)
+    xs.emplace_back(workspace.sharedX(i));
+
+  // Only hash X vectors which are not the same vector as the previous one
+  std::vector<size_t> hashes(xs.size(), 0);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numHist; ++i) {
+    if (i == 0 || xs[i] != xs[i - 1])
+      hashes[i] = boost::hash_range(xs[i]->cbegin(), xs[i]->cend());
+  }
+
+  // The X vectors kept, grouped by hash
+  std::unordered_map<size_t, std::vector<XVector>> kept;
+  size_t numberKept = 0;
+  for (int64_t i = 0; i < numHist; ++i) {
+    XVector replacement(nullptr);
+    if (i > 0 && xs[i] == xs[i - 1]) {
+      replacement = workspace.sharedX(i - 1);
+    } else {
+      auto &candidates = kept[hashes[i]];
+      const auto match = std::find_if(
+          candidates.cbegin(), candidates.cend(),
+          [&xs, i](const XVector &x) { return x == xs[i] || *x == *xs[i]; });
+      if (match == candidates.cend()) {
+        candidates.emplace_back(xs[i]);
+        ++numberKept;
+        continue;
+      }
+      replacement = *match;
+    }
+    if (replacement != xs[i])
+      workspace.setSharedX(i, replacement);
+  }
+  return numberKept;
+}
+
 /** Divides the data in a workspace by the bin width to make it a distribution.
  *  Can also reverse this operation (i.e. multiply by the bin width).
  *  Sets the isDistribution() flag accordingly.
@@ -502,7 +549,8 @@ void WorkspaceHelpers::makeDistribution(const MatrixWorkspace_sptr &workspace,
     throw std::runtime_error(
         "Workspace is using point data for x (should be bin edges).");
   }
-  for (size_t i = 0; i < numberOfSpectra; ++i) {
+  PARALLEL_FOR_IF(Kernel::threadSafe(*workspace))
+  for (int64_t i = 0; i < static_cast<int64_t>(numberOfSpectra); ++i) {
     if (forwards) {
       workspace->convertToFrequencies(i);
     } else {
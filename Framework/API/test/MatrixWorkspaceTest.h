@@ -490,6 +490,24 @@ public:
     TS_ASSERT_EQUALS(ws.isCommonBins(), false);
   }
 
+  void test_setSharedX_updates_common_bins() {
+    WorkspaceTester ws;
+    ws.initialize(10, 10, 10);
+    const auto x = ws.sharedX(0);
+    for (size_t i = 0; i < ws.getNumberHistograms(); ++i)
+      ws.setSharedX(i, x);
+    TS_ASSERT(ws.isCommonBins());
+    // Setting the shared X data again keeps the bins common
+    ws.setSharedX(3, x);
+    TS_ASSERT(ws.isCommonBins());
+    TS_ASSERT_EQUALS(&ws.x(3), &ws.x(0));
+    auto other = Kernel::make_cow<Mantid::HistogramData::HistogramX>(10, 2.);
+    ws.setSharedX(3, other);
+    TS_ASSERT_EQUALS(ws.isCommonBins(), false);
+    ws.setSharedX(3, x);
+    TS_ASSERT(ws.isCommonBins());
+  }
+
   void testIsCommonLogAxis() {
     WorkspaceTester ws;
     ws.initialize(10, 10, 10);
@@ -897,6 +915,20 @@ public:
     TS_ASSERT_EQUALS(out[110 + offset], 99);
   }
 
+  void test_getDetectorIndexToWorkspaceIndexVector() {
+    auto ws = makeWorkspaceWithDetectors(5, 1);
+    ws->getSpectrum(1).clearDetectorIDs();
+    std::vector<size_t> out;
+    TS_ASSERT_THROWS_NOTHING(out =
+                                 ws->getDetectorIndexToWorkspaceIndexVector());
+    TS_ASSERT_EQUALS(out, (std::vector<size_t>{
+                              0, std::numeric_limits<size_t>::max(), 2, 3, 4}));
+
+    // Not one-to-one if a detector is in several spectra
+    ws->getSpectrum(1).addDetectorID(2);
+    TS_ASSERT(ws->getDetectorIndexToWorkspaceIndexVector().empty());
+  }
+
   void test_getSpectrumToWorkspaceIndexVector() {
     auto ws = makeWorkspaceWithDetectors(100, 10);
     std::vector<size_t> out;
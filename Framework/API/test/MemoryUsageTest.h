@@ -0,0 +1,89 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/MemoryUsage.h"
+#include "MantidTestHelpers/FakeObjects.h"
+
+using namespace Mantid::API;
+using Data = MemoryUsage::Data;
+
+class MemoryUsageTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MemoryUsageTest *createSuite() { return new MemoryUsageTest(); }
+  static void destroySuite(MemoryUsageTest *suite) { delete suite; }
+
+  void test_data_is_only_counted_once() {
+    MemoryUsage usage;
+    const double a(0.), b(0.);
+    usage.add(Data::X, &a, 10, false);
+    usage.add(Data::X, &a, 10, false);
+    usage.add(Data::Y, &b, 20, true);
+    TS_ASSERT_EQUALS(usage.unique(Data::X), 10)
+    TS_ASSERT_EQUALS(usage.shared(Data::X), 0)
+    TS_ASSERT_EQUALS(usage.shared(Data::Y), 20)
+    TS_ASSERT_EQUALS(usage.unique(), 10)
+    TS_ASSERT_EQUALS(usage.shared(), 20)
+    TS_ASSERT_EQUALS(usage.total(), 30)
+  }
+
+  void test_workspace_with_shared_X() {
+    auto ws = makeWorkspace();
+    auto usage = ws->getMemoryUsage();
+    TS_ASSERT_EQUALS(usage.unique(Data::X), 3 * 4 * sizeof(double))
+    TS_ASSERT_EQUALS(usage.shared(Data::X), 0)
+
+    ws->setSharedX(1, ws->sharedX(0));
+    ws->setSharedX(2, ws->sharedX(0));
+    usage = ws->getMemoryUsage();
+    TS_ASSERT_EQUALS(usage.unique(Data::X), 0)
+    TS_ASSERT_EQUALS(usage.shared(Data::X), 4 * sizeof(double))
+    TS_ASSERT_EQUALS(usage.unique(Data::Y), 3 * 3 * sizeof(double))
+    TS_ASSERT_EQUALS(usage.unique(Data::E), 3 * 3 * sizeof(double))
+    TS_ASSERT_EQUALS(usage.shared(Data::Y), 0)
+    TS_ASSERT_EQUALS(usage.unique(Data::Dx), 0)
+  }
+
+  void test_AnalysisDataService_counts_shared_data_once() {
+    auto &ads = AnalysisDataService::Instance();
+    const auto before = ads.totalMemoryUsage();
+    auto ws1 = makeWorkspace();
+    auto ws2 = makeWorkspace();
+    for (size_t i = 0; i < 3; ++i) {
+      ws1->setSharedX(i, ws1->sharedX(0));
+      ws2->setSharedX(i, ws1->sharedX(0));
+    }
+    ads.addOrReplace("MemoryUsageTest_1", ws1);
+    ads.addOrReplace("MemoryUsageTest_2", ws2);
+
+    const auto perWorkspace = ads.memoryUsage();
+    TS_ASSERT_EQUALS(perWorkspace.count("MemoryUsageTest_1"), 1)
+    TS_ASSERT_EQUALS(perWorkspace.count("MemoryUsageTest_2"), 1)
+    TS_ASSERT_EQUALS(perWorkspace.at("MemoryUsageTest_2").shared(Data::X),
+                     4 * sizeof(double))
+    const auto after = ads.totalMemoryUsage();
+    TS_ASSERT_EQUALS(after.shared(Data::X) - before.shared(Data::X),
+                     4 * sizeof(double))
+    TS_ASSERT_EQUALS(after.unique(Data::Y) - before.unique(Data::Y),
+                     2 * 3 * 3 * sizeof(double))
+
+    ads.remove("MemoryUsageTest_1");
+    ads.remove("MemoryUsageTest_2");
+  }
+
+private:
+  std::shared_ptr<WorkspaceTester> makeWorkspace() {
+    auto ws = std::make_shared<WorkspaceTester>();
+    ws->initialize(3, 4, 3);
+    return ws;
+  }
+};
@@ -0,0 +1,172 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/ExperimentInfo.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumGeometryTable.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/UnitFactory.h"
+
+#include "MantidTestHelpers/FakeObjects.h"
+#include "MantidTestHelpers/InstrumentCreationHelper.h"
+
+#include <cmath>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::Kernel;
+
+class SpectrumGeometryTableTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SpectrumGeometryTableTest *createSuite() {
+    return new SpectrumGeometryTableTest();
+  }
+  static void destroySuite(SpectrumGeometryTableTest *suite) { delete suite; }
+
+  void test_values_match_SpectrumInfo() {
+    auto ws = makeWorkspace();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    const auto &table = ws.spectrumGeometryTable();
+    TS_ASSERT_EQUALS(table.size(), spectrumInfo.size());
+    TS_ASSERT_EQUALS(table.l1(), spectrumInfo.l1());
+    TS_ASSERT_EQUALS(table.emode(), DeltaEMode::Elastic);
+    for (size_t i = 0; i < table.size(); ++i) {
+      TS_ASSERT(table.hasDetectors(i));
+      TS_ASSERT_EQUALS(table.isMonitor(i), spectrumInfo.isMonitor(i));
+      TS_ASSERT_EQUALS(table.l2(i), spectrumInfo.l2(i));
+      TS_ASSERT(std::isnan(table.efixed(i)));
+      if (spectrumInfo.isMonitor(i)) {
+        TS_ASSERT(std::isnan(table.twoTheta(i)));
+      } else {
+        TS_ASSERT_EQUALS(table.twoTheta(i), spectrumInfo.twoTheta(i));
+        TS_ASSERT_EQUALS(table.azimuthal(i), spectrumInfo.azimuthal(i));
+      }
+    }
+    TS_ASSERT_EQUALS(table.l2().size(), table.size());
+  }
+
+  void test_table_is_cached() {
+    auto ws = makeWorkspace();
+    const auto &table = ws.spectrumGeometryTable();
+    TS_ASSERT_EQUALS(&table, &ws.spectrumGeometryTable());
+  }
+
+  void test_changing_grouping_invalidates() {
+    auto ws = makeWorkspace();
+    const double l2Before = ws.spectrumGeometryTable().l2(0);
+    ws.getSpectrum(0).setDetectorIDs({2, 3});
+    const auto &table = ws.spectrumGeometryTable();
+    TS_ASSERT_DIFFERS(table.l2(0), l2Before);
+    TS_ASSERT_EQUALS(table.l2(0), ws.spectrumInfo().l2(0));
+  }
+
+  void test_moving_detector_invalidates() {
+    auto ws = makeWorkspace();
+    const double l2Before = ws.spectrumGeometryTable().l2(1);
+    ws.mutableDetectorInfo().setPosition(1, V3D(0.0, 0.0, 3.0));
+    TS_ASSERT_DIFFERS(ws.spectrumGeometryTable().l2(1), l2Before);
+    TS_ASSERT_DELTA(ws.spectrumGeometryTable().l2(1), 3.0, 1e-12);
+  }
+
+  void test_direct_efixed_from_logs() {
+    auto ws = makeWorkspace();
+    ws.mutableRun().addProperty<std::string>("deltaE-mode", "Direct", true);
+    ws.mutableRun().addProperty<double>("Ei", 12.5, true);
+    const auto &table = ws.spectrumGeometryTable();
+    TS_ASSERT_EQUALS(table.emode(), DeltaEMode::Direct);
+    TS_ASSERT_EQUALS(table.efixed(0), 12.5);
+    TS_ASSERT(std::isnan(table.efixed(3))); // monitor
+  }
+
+  void test_copy_has_own_table() {
+    auto ws = makeWorkspace();
+    const auto &table = ws.spectrumGeometryTable();
+    const ExperimentInfo copy(ws);
+    const auto &copyTable = copy.spectrumGeometryTable();
+    TS_ASSERT_DIFFERS(&copyTable, &table);
+    TS_ASSERT_EQUALS(copyTable.l2(), table.l2());
+  }
+
+  void test_derived_columns_match_SpectrumInfo() {
+    auto ws = makeWorkspace();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    const auto &table = ws.spectrumGeometryTable();
+    for (size_t i = 0; i < table.size(); ++i) {
+      if (spectrumInfo.isMonitor(i)) {
+        TS_ASSERT(std::isnan(table.signedTwoTheta(i)));
+        TS_ASSERT(std::isnan(table.difcUncalibrated(i)));
+      } else {
+        TS_ASSERT_EQUALS(table.signedTwoTheta(i),
+                         spectrumInfo.signedTwoTheta(i));
+        TS_ASSERT_DELTA(table.difcUncalibrated(i),
+                        spectrumInfo.difcUncalibrated(i), 1e-9);
+      }
+    }
+  }
+
+  void test_efixed_for_other_emode() {
+    auto ws = makeWorkspace();
+    ws.mutableRun().addProperty<double>("Ei", 12.5, true);
+    const auto &table = ws.spectrumGeometryTable();
+    TS_ASSERT_EQUALS(table.emode(), DeltaEMode::Elastic);
+    TS_ASSERT(std::isnan(table.efixed(0)));
+    TS_ASSERT_EQUALS(table.efixed(DeltaEMode::Direct)[0], 12.5);
+    // No Efixed parameter in the instrument
+    TS_ASSERT(std::isnan(table.efixed(DeltaEMode::Indirect)[0]));
+  }
+
+  void test_getDetectorValues_matches_SpectrumInfo() {
+    auto ws = makeWorkspace();
+    ws.mutableRun().addProperty<double>("Ei", 12.5, true);
+    const auto &spectrumInfo = ws.spectrumInfo();
+    const auto &table = ws.spectrumGeometryTable();
+    const auto tof = UnitFactory::Instance().create("TOF");
+    const auto wavelength = UnitFactory::Instance().create("Wavelength");
+    const auto dSpacing = UnitFactory::Instance().create("dSpacing");
+    for (const auto emode : {DeltaEMode::Elastic, DeltaEMode::Direct}) {
+      for (const auto &target : {wavelength, dSpacing}) {
+        for (size_t i = 0; i < table.size(); ++i) {
+          UnitParametersMap expected;
+          spectrumInfo.getDetectorValues(*tof, *target, emode, false, i,
+                                         expected);
+          UnitParametersMap actual;
+          table.getDetectorValues(*tof, *target, emode, false, i, actual);
+          TS_ASSERT_EQUALS(actual.size(), expected.size());
+          for (const auto &value : expected) {
+            TS_ASSERT_EQUALS(actual.count(value.first), 1);
+            TS_ASSERT_DELTA(actual[value.first], value.second, 1e-9);
+          }
+        }
+      }
+    }
+  }
+
+  void test_no_instrument() {
+    WorkspaceTester ws;
+    ws.initialize(3, 2, 1);
+    const auto &table = ws.spectrumGeometryTable();
+    TS_ASSERT_EQUALS(table.size(), 3);
+    TS_ASSERT(std::isnan(table.l1()));
+    TS_ASSERT(!table.hasDetectors(0));
+    TS_ASSERT(std::isnan(table.l2(0)));
+  }
+
+private:
+  WorkspaceTester makeWorkspace() {
+    WorkspaceTester ws;
+    ws.initialize(5, 2, 1);
+    InstrumentCreationHelper::addFullInstrumentToWorkspace(
+        ws, true, true, "SimpleFakeInstrument");
+    return ws;
+  }
+};
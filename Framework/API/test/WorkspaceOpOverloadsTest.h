@@ -105,6 +105,25 @@ public:
     TS_ASSERT(WorkspaceHelpers::sharedXData(*ws));
   }
 
+  void test_shareIdenticalXData() {
+    auto ws = std::make_shared<WorkspaceTester>();
+    ws->initialize(5, 3, 2);
+    // WorkspaceTester gives each spectrum its own X vector
+    for (size_t i = 0; i < 5; ++i)
+      ws->mutableX(i) = {1.0, 2.0, i == 3 ? 4.0 : 3.0};
+    TS_ASSERT(!WorkspaceHelpers::sharedXData(*ws));
+
+    TS_ASSERT_EQUALS(WorkspaceHelpers::shareIdenticalXData(*ws), 2);
+    TS_ASSERT_EQUALS(ws->sharedX(0), ws->sharedX(1));
+    TS_ASSERT_EQUALS(ws->sharedX(0), ws->sharedX(2));
+    TS_ASSERT_EQUALS(ws->sharedX(0), ws->sharedX(4));
+    TS_ASSERT_DIFFERS(ws->sharedX(0), ws->sharedX(3));
+    TS_ASSERT_EQUALS(ws->x(3)[2], 4.0);
+    TS_ASSERT_EQUALS(ws->x(4)[2], 3.0);
+    // Nothing left to share
+    TS_ASSERT_EQUALS(WorkspaceHelpers::shareIdenticalXData(*ws), 2);
+  }
+
   void test_makeDistribution() {
     // N.B. This is also tested in the tests for the
     // Convert[To/From]Distribution algorithms.
@@ -18,8 +18,9 @@
 namespace Mantid {
 
 namespace API {
+class Progress;
 class Sample;
-}
+} // namespace API
 namespace Geometry {
 class IDetector;
 class IObject;
@@ -79,6 +80,8 @@ public:
            "can be defined by the CreateSampleShape algorithm.";
   }
 
+  static void clearCache();
+
 protected:
   /** A virtual function in which additional properties of an algorithm should
    * be declared.
@@ -118,8 +121,11 @@ private:
   void exec() override;
 
   void retrieveBaseProperties();
+  void calculateFactors(API::MatrixWorkspace &outputWS, const int64_t xStep,
+                        const Kernel::V3D &detectorShift, API::Progress *prog);
   void constructSample(API::Sample &sample);
-  void calculateDistances(const Geometry::IDetector &detector,
+  Kernel::V3D detectorPosition(const Geometry::IDetector &detector) const;
+  void calculateDistances(const Kernel::V3D &detectorPos,
                           std::vector<double> &L2s) const;
   inline double doIntegration(const double linearCoefAbs,
                               const std::vector<double> &L2s,
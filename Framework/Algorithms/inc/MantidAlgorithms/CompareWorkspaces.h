@@ -141,6 +141,14 @@ private:
 
   bool relErr(double x1, double x2, double errorVal) const;
 
+  void logDataMismatches(const long index, const HistogramData::HistogramX &X1,
+                         const HistogramData::HistogramY &Y1,
+                         const HistogramData::HistogramE &E1,
+                         const HistogramData::HistogramX &X2,
+                         const HistogramData::HistogramY &Y2,
+                         const HistogramData::HistogramE &E2,
+                         const double tolerance, const bool relative) const;
+
   /// Result of comparison (true if equal, false otherwise)
   bool m_result{false};
 
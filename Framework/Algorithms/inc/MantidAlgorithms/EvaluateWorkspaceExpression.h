@@ -0,0 +1,49 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAlgorithms/DllConfig.h"
+
+namespace Mantid {
+namespace API {
+class Expression;
+}
+namespace Algorithms {
+class WorkspaceExpression;
+
+/** EvaluateWorkspaceExpression evaluates an arithmetic expression of
+  workspaces in the AnalysisDataService and numbers, e.g. "(ws - bkg) / van *
+  1.3", in a single pass using WorkspaceExpression rather than running one
+  binary operation algorithm per operator.
+*/
+class MANTID_ALGORITHMS_DLL EvaluateWorkspaceExpression
+    : public API::Algorithm {
+public:
+  const std::string name() const override {
+    return "EvaluateWorkspaceExpression";
+  }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Arithmetic"; }
+  const std::string summary() const override {
+    return "Evaluates an arithmetic expression of workspaces and numbers "
+           "without creating intermediate workspaces.";
+  }
+  const std::vector<std::string> seeAlso() const override {
+    return {"Plus", "Minus", "Multiply", "Divide", "Power"};
+  }
+
+private:
+  void init() override;
+  void exec() override;
+  std::map<std::string, std::string> validateInputs() override;
+
+  static WorkspaceExpression toWorkspaceExpression(const API::Expression &expr);
+};
+
+} // namespace Algorithms
+} // namespace Mantid
@@ -12,13 +12,16 @@
 #include "MantidGeometry/Objects/IObject.h"
 
 #include <array>
+#include <functional>
+#include <memory>
 #include <tuple>
 #include <utility>
 
 namespace Mantid {
 namespace Algorithms {
 class DetectorGridDefinition;
-}
+class InterpolationOption;
+} // namespace Algorithms
 namespace Geometry {
 class ReferenceFrame;
 }
@@ -31,10 +34,22 @@ class V3D;
 namespace Algorithms {
 /**
   Defines functions and utilities to create and deal with sparse instruments.
+
+  A sparse workspace approximates the instrument of a model workspace by a
+  coarse grid of detectors in latitude and longitude. Algorithms computing a
+  correction which varies smoothly with the scattering direction evaluate it
+  only for the spectra of the sparse workspace and interpolate the result to
+  the spectra of the model workspace using interpolateInto().
+  evaluateAdaptively() picks the grid density from an estimate of the
+  interpolation error.
 */
 
 class MANTID_ALGORITHMS_DLL SparseWorkspace : public DataObjects::Workspace2D {
 public:
+  /// Fills the Y (and optionally E) values of all spectra of a sparse
+  /// workspace
+  using Evaluator = std::function<void(SparseWorkspace &)>;
+
   SparseWorkspace(const API::MatrixWorkspace &modelWS,
                   const size_t wavelengthPoints, const size_t rows,
                   const size_t columns);
@@ -42,6 +57,13 @@ public:
   interpolateFromDetectorGrid(const double lat, const double lon) const;
   virtual HistogramData::Histogram
   bilinearInterpolateFromDetectorGrid(const double lat, const double lon) const;
+  void interpolateInto(API::MatrixWorkspace &targetWS, const size_t index,
+                       const InterpolationOption &interpOpt) const;
+  double maxInterpolationError() const;
+  static std::unique_ptr<SparseWorkspace>
+  evaluateAdaptively(const API::MatrixWorkspace &modelWS,
+                     const size_t wavelengthPoints, const Evaluator &evaluate,
+                     const double tolerance);
 
 protected:
   std::unique_ptr<Algorithms::DetectorGridDefinition> m_gridDef;
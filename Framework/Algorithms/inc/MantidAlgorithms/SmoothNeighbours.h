@@ -94,6 +94,12 @@ private:
   void execEvent(Mantid::DataObjects::EventWorkspace_sptr &ws);
   void findNeighboursRectangular();
   void findNeighboursUbiqutious();
+  Kernel::V3D neighbourSearchScale(const std::vector<size_t> &workspaceIndices,
+                                   const bool ignoreMaskedDetectors) const;
+  SpectraDistanceMap
+  nearestDetectors(const size_t wi, const std::vector<size_t> &workspaceIndices,
+                   const Kernel::V3D &scale,
+                   const bool ignoreMaskedDetectors) const;
 
   /// Sets the weighting stragegy.
   void setWeightingStrategy(const std::string &strategyName, double &cutOff);
@@ -62,6 +62,12 @@ private:
   bool expandNet(std::map<specnum_t, Mantid::Kernel::V3D> &nearest,
                  specnum_t spec, const size_t noNeighbours,
                  const Mantid::Geometry::BoundingBox &bbox);
+  /// find the nearest detectors in the search region using the spatial index
+  std::map<specnum_t, Mantid::Kernel::V3D>
+  nearestInBox(const API::MatrixWorkspace &workspace,
+               const std::vector<size_t> &workspaceIndices,
+               const size_t workspaceIndex, const size_t noNeighbours,
+               const Mantid::Geometry::BoundingBox &bbox);
   /// sort by distance
   void sortByDistance(std::map<specnum_t, Mantid::Kernel::V3D> &nearest,
                       const size_t noNeighbours);
@@ -58,6 +58,12 @@ public:
   /// Cross-input validation
   std::map<std::string, std::string> validateInputs() override;
 
+protected:
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+  void execDistributed() override;
+
 private:
   /// Handle logic for RebinnedOutput workspaces
   void doFractionalSum(const API::MatrixWorkspace_sptr &outputWorkspace,
@@ -86,6 +92,8 @@ private:
   bool m_keepMonitors{false};
   /// Set true to remove special values before processing
   bool m_replaceSpecialValues{false};
+  /// Set true if the spectra are distributed over the MPI ranks
+  bool m_distributed{false};
   /// numberOfSpectra in the input
   size_t m_numberOfSpectra{0};
   /// Blocksize of the input workspace
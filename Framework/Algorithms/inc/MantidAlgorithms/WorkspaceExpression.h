@@ -0,0 +1,77 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidAlgorithms/DllConfig.h"
+
+#include <memory>
+
+namespace Mantid {
+namespace Algorithms {
+
+/** WorkspaceExpression is a deferred arithmetic expression of matrix
+  workspaces and numbers, e.g.
+
+  @code
+  auto result = ((WorkspaceExpression(ws1) - bkg) / van * 1.3).evaluate();
+  @endcode
+
+  Building the expression does no work. evaluate() computes the result in a
+  single parallel pass over the spectra, evaluating the whole expression for
+  one spectrum at a time, so no intermediate workspaces are created. Errors
+  are propagated as in Plus, Minus, Multiply, Divide and Power, assuming
+  uncorrelated operands.
+
+  All workspace operands must have the same number of spectra and bins as the
+  largest one, unless they have a single spectrum, which is used for all
+  spectra, or a single value. A spectrum masked in any operand with the full
+  number of spectra is masked and zeroed in the result. As in
+  BinaryOperation, the masks of single spectrum and single value operands are
+  not propagated. The result is a Workspace2D with the binning, instrument,
+  units and logs of the largest workspace operand.
+*/
+class MANTID_ALGORITHMS_DLL WorkspaceExpression {
+public:
+  WorkspaceExpression(API::MatrixWorkspace_const_sptr workspace);
+  WorkspaceExpression(const API::MatrixWorkspace_sptr &workspace);
+  WorkspaceExpression(const double value, const double error = 0.0);
+
+  API::MatrixWorkspace_sptr evaluate() const;
+
+  friend MANTID_ALGORITHMS_DLL WorkspaceExpression
+  operator+(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_ALGORITHMS_DLL WorkspaceExpression
+  operator-(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_ALGORITHMS_DLL WorkspaceExpression
+  operator*(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_ALGORITHMS_DLL WorkspaceExpression
+  operator/(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_ALGORITHMS_DLL WorkspaceExpression
+  pow(const WorkspaceExpression &base, const double exponent);
+
+  struct Node;
+
+private:
+  explicit WorkspaceExpression(std::shared_ptr<const Node> node);
+
+  std::shared_ptr<const Node> m_node;
+};
+
+MANTID_ALGORITHMS_DLL WorkspaceExpression
+operator+(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+MANTID_ALGORITHMS_DLL WorkspaceExpression
+operator-(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+MANTID_ALGORITHMS_DLL WorkspaceExpression
+operator*(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+MANTID_ALGORITHMS_DLL WorkspaceExpression
+operator/(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+MANTID_ALGORITHMS_DLL WorkspaceExpression pow(const WorkspaceExpression &base,
+                                              const double exponent);
+
+} // namespace Algorithms
+} // namespace Mantid
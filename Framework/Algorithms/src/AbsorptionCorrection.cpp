@@ -5,21 +5,27 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/AbsorptionCorrection.h"
+#include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/HistoWorkspace.h"
 #include "MantidAPI/InstrumentValidator.h"
 #include "MantidAPI/Sample.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceUnitValidator.h"
+#include "MantidAlgorithms/InterpolationOption.h"
+#include "MantidAlgorithms/SampleCorrections/SparseWorkspace.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/SampleEnvironment.h"
+#include "MantidGeometry/Objects/CSGObject.h"
 #include "MantidGeometry/Objects/ShapeFactory.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidHistogramData/Interpolate.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/DeltaEMode.h"
+#include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/Fast_Exponential.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/Material.h"
@@ -28,6 +34,13 @@
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
 
+#include <Poco/NObserver.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <mutex>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -59,8 +72,127 @@ double energyToWavelength(const double energyFixed) {
   return 2. * M_PI * std::sqrt(E_mev_toNeutronWavenumberSq / energyFixed);
 }
 
+// default memory limit of the path length cache if not set in the config
+constexpr int DEFAULT_PATH_LENGTH_CACHE_MB{16};
+
+/// Path lengths from each volume element of one sample geometry to the
+/// detector positions seen so far
+class PathLengthTable {
+public:
+  PathLengthTable(std::string shapeXML, std::vector<V3D> elementPositions,
+                  const size_t maxValues)
+      : m_shapeXML(std::move(shapeXML)),
+        m_elementPositions(std::move(elementPositions)),
+        m_maxValues(maxValues) {}
+
+  bool matches(const std::string &shapeXML,
+               const std::vector<V3D> &elementPositions) const {
+    return m_shapeXML == shapeXML && m_elementPositions == elementPositions;
+  }
+
+  std::shared_ptr<const std::vector<double>> find(const V3D &detPos) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_pathLengths.find({{detPos.X(), detPos.Y(), detPos.Z()}});
+    return it == m_pathLengths.end() ? nullptr : it->second;
+  }
+
+  void insert(const V3D &detPos,
+              std::shared_ptr<const std::vector<double>> L2s) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_numValues + L2s->size() > m_maxValues)
+      return;
+    m_numValues += L2s->size();
+    m_pathLengths.emplace(
+        std::array<double, 3>{{detPos.X(), detPos.Y(), detPos.Z()}},
+        std::move(L2s));
+  }
+
+private:
+  const std::string m_shapeXML;
+  const std::vector<V3D> m_elementPositions;
+  const size_t m_maxValues;
+  size_t m_numValues{0};
+  mutable std::mutex m_mutex;
+  std::map<std::array<double, 3>, std::shared_ptr<const std::vector<double>>>
+      m_pathLengths;
+};
+
+/// Keeps the path length table of the most recent sample geometry between
+/// executions and drops it when the AnalysisDataService is cleared, e.g. by
+/// FrameworkManager::clear().
+class PathLengthCache {
+public:
+  PathLengthCache() : m_clearObserver(*this, &PathLengthCache::handleClear) {
+    AnalysisDataService::Instance().notificationCenter.addObserver(
+        m_clearObserver);
+  }
+  ~PathLengthCache() {
+    AnalysisDataService::Instance().notificationCenter.removeObserver(
+        m_clearObserver);
+  }
+  PathLengthCache(const PathLengthCache &) = delete;
+  PathLengthCache &operator=(const PathLengthCache &) = delete;
+
+  std::shared_ptr<PathLengthTable> get(const std::string &shapeXML,
+                                       const std::vector<V3D> &positions,
+                                       const size_t maxValues) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_table || !m_table->matches(shapeXML, positions))
+      m_table =
+          std::make_shared<PathLengthTable>(shapeXML, positions, maxValues);
+    return m_table;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_table.reset();
+  }
+
+private:
+  void handleClear(
+      const Poco::AutoPtr<AnalysisDataServiceImpl::ClearNotification> &) {
+    clear();
+  }
+
+  std::mutex m_mutex;
+  std::shared_ptr<PathLengthTable> m_table;
+  Poco::NObserver<PathLengthCache, AnalysisDataServiceImpl::ClearNotification>
+      m_clearObserver;
+};
+
+PathLengthCache &pathLengthCache() {
+  static PathLengthCache cache;
+  return cache;
+}
+
+/** Returns the path length table for a sample geometry. The table of the most
+ * recent geometry is kept between executions so that repeated corrections of
+ * runs with identical sample and instrument geometry skip the ray tracing.
+ * Returns nullptr if caching is disabled or the shape cannot be identified.
+ */
+std::shared_ptr<PathLengthTable>
+pathLengthTable(const IObject &shape,
+                const std::vector<V3D> &elementPositions) {
+  const auto *csgShape = dynamic_cast<const CSGObject *>(&shape);
+  if (!csgShape || csgShape->getShapeXML().empty())
+    return nullptr;
+  const auto sizeMB =
+      ConfigService::Instance()
+          .getValue<int>("AbsorptionCorrection.PathLengthCacheMB")
+          .get_value_or(DEFAULT_PATH_LENGTH_CACHE_MB);
+  if (sizeMB <= 0)
+    return nullptr;
+  const auto maxValues =
+      static_cast<size_t>(sizeMB) * 1024 * 1024 / sizeof(double);
+  return pathLengthCache().get(csgShape->getShapeXML(), elementPositions,
+                               maxValues);
+}
+
 } // namespace
 
+/// Frees the path lengths kept from previous executions.
+void AbsorptionCorrection::clearCache() { pathLengthCache().clear(); }
+
 AbsorptionCorrection::AbsorptionCorrection()
     : API::Algorithm(), m_inputWS(), m_sampleObject(nullptr), m_L1s(),
       m_elementVolumes(), m_elementPositions(), m_numVolumeElements(0),
@@ -128,6 +260,23 @@ void AbsorptionCorrection::init() {
       "The value of the initial or final energy, as appropriate, in meV.\n"
       "Will be taken from the instrument definition file, if available.");
 
+  declareProperty("SparseInstrument", false,
+                  "Calculate the factors on a sparse grid of detectors 1 m "
+                  "from the sample and interpolate the results to the real "
+                  "instrument. The grid is refined until the estimated "
+                  "interpolation error is below SparseInstrumentTolerance. "
+                  "The errors of the output are set to the estimated "
+                  "interpolation errors.");
+  auto positiveDouble = std::make_shared<BoundedValidator<double>>();
+  positiveDouble->setLower(0.0);
+  positiveDouble->setLowerExclusive(true);
+  declareProperty("SparseInstrumentTolerance", 1e-3, positiveDouble,
+                  "The maximum estimated interpolation error of the sparse "
+                  "instrument relative to the largest factor.");
+  setPropertySettings("SparseInstrumentTolerance",
+                      std::make_unique<EnabledWhenProperty>(
+                          "SparseInstrument", IS_NOT_DEFAULT));
+
   // Call the virtual method for concrete algorithm to define any other
   // properties
   defineProperties();
@@ -173,9 +322,6 @@ void AbsorptionCorrection::exec() {
   m_inputWS = getProperty("InputWorkspace");
   // Cache the beam direction
   m_beamDirection = m_inputWS->getInstrument()->getBeamDirection();
-  // Get a reference to the parameter map (used for indirect instruments)
-  const ParameterMap &pmap = m_inputWS->constInstrumentParameters();
-
   // Get the input parameters
   retrieveBaseProperties();
 
@@ -212,15 +358,81 @@ void AbsorptionCorrection::exec() {
         "Failed to define any initial scattering gauge volume for geometry");
   }
 
-  const auto &spectrumInfo = m_inputWS->spectrumInfo();
+  std::unique_ptr<SparseWorkspace> sparseWS;
+  const bool useSparseInstrument = getProperty("SparseInstrument");
+  if (useSparseInstrument) {
+    const double tolerance = getProperty("SparseInstrumentTolerance");
+    // The sparse instrument is centred on the origin but the sample elements
+    // are at the sample position of the input instrument
+    const V3D samplePos = m_inputWS->getInstrument()->getSample()->getPos();
+    sparseWS = SparseWorkspace::evaluateAdaptively(
+        *m_inputWS, static_cast<size_t>(std::min(m_num_lambda, specSize)),
+        [&](SparseWorkspace &ws) {
+          calculateFactors(ws, 1, samplePos, nullptr);
+        },
+        tolerance);
+    if (!sparseWS)
+      g_log.information("A sparse instrument with the requested accuracy "
+                        "would not be smaller than the input instrument. "
+                        "Calculating all spectra.");
+  }
+
   Progress prog(this, 0.0, 1.0, numHists);
+  if (sparseWS) {
+    // The errors set by SparseWorkspace::bilinearInterpolateFromDetectorGrid
+    // combine the (zero) errors of the grid points with a second derivative
+    // estimate of the spatial interpolation error, which is correlated
+    // between wavelength points
+    InterpolationOption interpolateOpt;
+    interpolateOpt.setIndependentErrors(false);
+    PARALLEL_FOR_IF(Kernel::threadSafe(*correctionFactors, *sparseWS))
+    for (int64_t i = 0; i < numHists; ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      sparseWS->interpolateInto(*correctionFactors, static_cast<size_t>(i),
+                                interpolateOpt);
+      prog.report();
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  } else {
+    calculateFactors(*correctionFactors, m_xStep, V3D(), &prog);
+  }
+
+  g_log.information() << "Total number of elements in the integration was "
+                      << m_L1s.size() << '\n';
+  setProperty("OutputWorkspace", correctionFactors);
+
+  // Now do some cleaning-up since destructor may not be called immediately
+  m_L1s.clear();
+  m_elementVolumes.clear();
+  m_elementPositions.clear();
+}
+
+/** Calculate the attenuation factors for all spectra of a workspace.
+ * @param outputWS :: The workspace providing the detector positions and the
+ * wavelength points. Its Y values are overwritten by the factors.
+ * @param xStep :: The step in bin number between calculated points, the
+ * points in between are interpolated linearly
+ * @param detectorShift :: Shift applied to the detector positions of outputWS
+ * @param prog :: Optional progress reporting
+ */
+void AbsorptionCorrection::calculateFactors(MatrixWorkspace &outputWS,
+                                            const int64_t xStep,
+                                            const V3D &detectorShift,
+                                            Progress *prog) {
+  // Get a reference to the parameter map (used for indirect instruments)
+  const ParameterMap &pmap = outputWS.constInstrumentParameters();
+  const auto numHists = static_cast<int64_t>(outputWS.getNumberHistograms());
+  const auto specSize = static_cast<int64_t>(outputWS.blocksize());
+
+  const auto pathLengths =
+      pathLengthTable(*m_sampleObject, m_elementPositions);
+
+  const auto &spectrumInfo = outputWS.spectrumInfo();
   // Loop over the spectra
-  PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWS, *correctionFactors))
+  PARALLEL_FOR_IF(Kernel::threadSafe(outputWS))
   for (int64_t i = 0; i < int64_t(numHists); ++i) {
     PARALLEL_START_INTERUPT_REGION
-    // Copy over bins
-    correctionFactors->setSharedX(i, m_inputWS->sharedX(i));
-
     if (!spectrumInfo.hasDetectors(i)) {
       g_log.information() << "Spectrum " << i
                           << " does not have a detector defined for it\n";
@@ -228,8 +440,16 @@ void AbsorptionCorrection::exec() {
     }
     const auto &det = spectrumInfo.detector(i);
 
-    std::vector<double> L2s(m_numVolumeElements);
-    calculateDistances(det, L2s);
+    const V3D detectorPos = detectorPosition(det) + detectorShift;
+    auto cachedL2s = pathLengths ? pathLengths->find(detectorPos) : nullptr;
+    if (!cachedL2s) {
+      auto newL2s = std::make_shared<std::vector<double>>(m_numVolumeElements);
+      calculateDistances(detectorPos, *newL2s);
+      cachedL2s = std::move(newL2s);
+      if (pathLengths)
+        pathLengths->insert(detectorPos, cachedL2s);
+    }
+    const auto &L2s = *cachedL2s;
 
     // If an indirect instrument, see if there's an efixed in the parameter map
     double lambdaFixed = m_lambdaFixed;
@@ -246,16 +466,16 @@ void AbsorptionCorrection::exec() {
 
     // calculate the absorption coefficient for fixed wavelength
     const double linearCoefAbsFixed = -m_material.linearAbsorpCoef(lambdaFixed);
-    const auto wavelengths = m_inputWS->points(i);
+    const auto wavelengths = outputWS.points(i);
     // these need to have the minus sign applied still
     const auto linearCoefAbs =
         m_material.linearAbsorpCoef(wavelengths.cbegin(), wavelengths.cend());
 
     // Get a reference to the Y's in the output WS for storing the factors
-    auto &Y = correctionFactors->mutableY(i);
+    auto &Y = outputWS.mutableY(i);
 
-    // Loop through the bins in the current spectrum every m_xStep
-    for (int64_t j = 0; j < specSize; j = j + m_xStep) {
+    // Loop through the bins in the current spectrum every xStep
+    for (int64_t j = 0; j < specSize; j = j + xStep) {
       if (m_emode == DeltaEMode::Elastic) {
         Y[j] = this->doIntegration(-linearCoefAbs[j], L2s, 0, L2s.size());
       } else if (m_emode == DeltaEMode::Direct) {
@@ -271,33 +491,25 @@ void AbsorptionCorrection::exec() {
       Y[j] /= m_sampleVolume; // Divide by total volume of the shape
 
       // Make certain that last point is calculated
-      if (m_xStep > 1 && j + m_xStep >= specSize && j + 1 != specSize) {
-        j = specSize - m_xStep - 1;
+      if (xStep > 1 && j + xStep >= specSize && j + 1 != specSize) {
+        j = specSize - xStep - 1;
       }
     }
 
-    // Interpolate linearly between points separated by m_xStep,
+    // Interpolate linearly between points separated by xStep,
     // last point required
-    if (m_xStep > 1) {
-      auto histnew = correctionFactors->histogram(i);
-      interpolateLinearInplace(histnew, m_xStep);
-      correctionFactors->setHistogram(i, histnew);
+    if (xStep > 1) {
+      auto histnew = outputWS.histogram(i);
+      interpolateLinearInplace(histnew, xStep);
+      outputWS.setHistogram(i, histnew);
     }
 
-    prog.report();
+    if (prog)
+      prog->report();
 
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
-
-  g_log.information() << "Total number of elements in the integration was "
-                      << m_L1s.size() << '\n';
-  setProperty("OutputWorkspace", correctionFactors);
-
-  // Now do some cleaning-up since destructor may not be called immediately
-  m_L1s.clear();
-  m_elementVolumes.clear();
-  m_elementPositions.clear();
 }
 
 /// Fetch the properties and set the appropriate member variables
@@ -414,12 +626,9 @@ void AbsorptionCorrection::constructSample(API::Sample &sample) {
   }
 }
 
-/// Calculate the distances traversed by the neutrons within the sample
+/// Returns the position used for the path lengths to a (grouped) detector
 /// @param detector :: The detector we are working on
-/// @param L2s :: A vector of the sample-detector distance for  each segment of
-/// the sample
-void AbsorptionCorrection::calculateDistances(const IDetector &detector,
-                                              std::vector<double> &L2s) const {
+V3D AbsorptionCorrection::detectorPosition(const IDetector &detector) const {
   V3D detectorPos(detector.getPos());
   if (detector.nDets() > 1) {
     // We need to make sure this is right for grouped detectors - should use
@@ -429,7 +638,15 @@ void AbsorptionCorrection::calculateDistances(const IDetector &detector,
                               M_PI,
                           detector.getPhi() * 180.0 / M_PI);
   }
+  return detectorPos;
+}
 
+/// Calculate the distances traversed by the neutrons within the sample
+/// @param detectorPos :: The position of the detector we are working on
+/// @param L2s :: A vector of the sample-detector distance for  each segment of
+/// the sample
+void AbsorptionCorrection::calculateDistances(const V3D &detectorPos,
+                                              std::vector<double> &L2s) const {
   for (size_t i = 0; i < m_numVolumeElements; ++i) {
     // Create track for distance in cylinder between scattering point and
     // detector
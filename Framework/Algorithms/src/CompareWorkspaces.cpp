@@ -25,6 +25,8 @@
 #include "MantidKernel/Unit.h"
 #include "MantidParallel/Communicator.h"
 
+#include <atomic>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -124,6 +126,45 @@ int compareEventLists(Kernel::Logger &logger, const EventList &el1,
   // Anything that gets this far is equal within tolerances
   return returnint;
 }
+
+/**
+ * Checks whether any of the first values of two vectors differ by more than
+ * the tolerance, using the same definition of the relative error as
+ * CompareWorkspaces::relErr. The values are checked in blocks without
+ * branches, allowing the compiler to vectorize the loops, and the check stops
+ * after the first block containing a difference.
+ * @param lhs :: the first values
+ * @param rhs :: the second values
+ * @param size :: the number of values to check
+ * @param tolerance :: the tolerance
+ * @param relative :: whether the tolerance is relative
+ * @return true if any value differs by more than the tolerance
+ */
+bool anyDifference(const std::vector<double> &lhs,
+                   const std::vector<double> &rhs, const size_t size,
+                   const double tolerance, const bool relative) {
+  constexpr size_t blockSize = 256;
+  const double *a = lhs.data();
+  const double *b = rhs.data();
+  for (size_t start = 0; start < size; start += blockSize) {
+    const size_t end = std::min(size, start + blockSize);
+    int different = 0;
+    if (relative) {
+      for (size_t i = start; i < end; ++i) {
+        const double difference = std::fabs(a[i] - b[i]);
+        const double mean = 0.5 * (std::fabs(a[i]) + std::fabs(b[i]));
+        const double error = mean < tolerance ? difference : difference / mean;
+        different |= error > tolerance;
+      }
+    } else {
+      for (size_t i = start; i < end; ++i)
+        different |= std::fabs(a[i] - b[i]) > tolerance;
+    }
+    if (different)
+      return true;
+  }
+  return false;
+}
 } // namespace
 
 /** Initialize the algorithm's properties.
@@ -524,8 +565,8 @@ bool CompareWorkspaces::compareEventWorkspaces(
   }
   g_log.notice() << "TOF Tolerance = " << toleranceTOF << "\n";
 
-  bool mismatchedEvent = false;
-  int mismatchedEventWI = 0;
+  std::atomic<bool> mismatchedEvent{false};
+  int mismatchedEventWI = static_cast<int>(ews1.getNumberHistograms());
 
   size_t numUnequalNumEventsSpectra = 0;
   size_t numUnequalEvents = 0;
@@ -571,8 +612,8 @@ bool CompareWorkspaces::compareEventWorkspaces(
         }
 
         mismatchedEvent = true;
-        mismatchedEventWI = i;
         PARALLEL_CRITICAL(CompareWorkspaces) {
+          mismatchedEventWI = std::min(mismatchedEventWI, i);
           if (tempNumUnequal == -1) {
             // 2 spectra have different number of events
             ++numUnequalNumEventsSpectra;
@@ -667,7 +708,8 @@ bool CompareWorkspaces::checkData(const API::MatrixWorkspace_const_sptr &ws1,
   }
 
   const double tolerance = getProperty("Tolerance");
-  bool resultBool = true;
+  std::atomic<bool> resultBool{true};
+  const bool logDetails = g_log.is(Logger::Priority::PRIO_DEBUG);
 
   // Now check the data itself
   PARALLEL_FOR_IF(m_parallelComparison && ws1->threadSafe() &&
@@ -686,30 +728,18 @@ bool CompareWorkspaces::checkData(const API::MatrixWorkspace_const_sptr &ws1,
       const auto &Y2 = ws2->y(i);
       const auto &E2 = ws2->e(i);
 
-      for (int j = 0; j < static_cast<int>(numBins); ++j) {
-        bool err;
-        if (RelErr) {
-          err = (relErr(X1[j], X2[j], tolerance) ||
-                 relErr(Y1[j], Y2[j], tolerance) ||
-                 relErr(E1[j], E2[j], tolerance));
-        } else
-          err = (std::fabs(X1[j] - X2[j]) > tolerance ||
-                 std::fabs(Y1[j] - Y2[j]) > tolerance ||
-                 std::fabs(E1[j] - E2[j]) > tolerance);
-
-        if (err) {
-          g_log.debug() << "Data mismatch at cell (hist#,bin#): (" << i << ","
-                        << j << ")\n";
-          g_log.debug() << " Dataset #1 (X,Y,E) = (" << X1[j] << "," << Y1[j]
-                        << "," << E1[j] << ")\n";
-          g_log.debug() << " Dataset #2 (X,Y,E) = (" << X2[j] << "," << Y2[j]
-                        << "," << E2[j] << ")\n";
-          g_log.debug() << " Difference (X,Y,E) = (" << std::fabs(X1[j] - X2[j])
-                        << "," << std::fabs(Y1[j] - Y2[j]) << ","
-                        << std::fabs(E1[j] - E2[j]) << ")\n";
-          PARALLEL_CRITICAL(resultBool)
-          resultBool = false;
-        }
+      // Data shared by both workspaces is equal and needs no check
+      const bool mismatch =
+          (&X1 != &X2 && anyDifference(X1.rawData(), X2.rawData(), numBins,
+                                       tolerance, RelErr)) ||
+          (&Y1 != &Y2 && anyDifference(Y1.rawData(), Y2.rawData(), numBins,
+                                       tolerance, RelErr)) ||
+          (&E1 != &E2 && anyDifference(E1.rawData(), E2.rawData(), numBins,
+                                       tolerance, RelErr));
+      if (mismatch) {
+        if (logDetails)
+          logDataMismatches(i, X1, Y1, E1, X2, Y2, E2, tolerance, RelErr);
+        resultBool = false;
       }
 
       // Extra one for histogram data
@@ -717,7 +747,6 @@ bool CompareWorkspaces::checkData(const API::MatrixWorkspace_const_sptr &ws1,
         g_log.debug() << " Data ranges mismatch for spectra N: (" << i << ")\n";
         g_log.debug() << " Last bin ranges (X1_end vs X2_end) = (" << X1.back()
                       << "," << X2.back() << ")\n";
-        PARALLEL_CRITICAL(resultBool)
         resultBool = false;
       }
     }
@@ -731,6 +760,50 @@ bool CompareWorkspaces::checkData(const API::MatrixWorkspace_const_sptr &ws1,
   return resultBool;
 }
 
+/**
+ * Logs the values of all bins of a spectrum that differ by more than the
+ * tolerance
+ * @param index :: the workspace index of the spectrum
+ * @param X1 :: X values of the first workspace
+ * @param Y1 :: Y values of the first workspace
+ * @param E1 :: E values of the first workspace
+ * @param X2 :: X values of the second workspace
+ * @param Y2 :: Y values of the second workspace
+ * @param E2 :: E values of the second workspace
+ * @param tolerance :: the tolerance
+ * @param relative :: whether the tolerance is relative
+ */
+void CompareWorkspaces::logDataMismatches(
+    const long index, const HistogramData::HistogramX &X1,
+    const HistogramData::HistogramY &Y1, const HistogramData::HistogramE &E1,
+    const HistogramData::HistogramX &X2, const HistogramData::HistogramY &Y2,
+    const HistogramData::HistogramE &E2, const double tolerance,
+    const bool relative) const {
+  for (size_t j = 0; j < Y1.size(); ++j) {
+    bool err;
+    if (relative) {
+      err = (relErr(X1[j], X2[j], tolerance) ||
+             relErr(Y1[j], Y2[j], tolerance) ||
+             relErr(E1[j], E2[j], tolerance));
+    } else
+      err = (std::fabs(X1[j] - X2[j]) > tolerance ||
+             std::fabs(Y1[j] - Y2[j]) > tolerance ||
+             std::fabs(E1[j] - E2[j]) > tolerance);
+
+    if (err) {
+      g_log.debug() << "Data mismatch at cell (hist#,bin#): (" << index << ","
+                    << j << ")\n";
+      g_log.debug() << " Dataset #1 (X,Y,E) = (" << X1[j] << "," << Y1[j]
+                    << "," << E1[j] << ")\n";
+      g_log.debug() << " Dataset #2 (X,Y,E) = (" << X2[j] << "," << Y2[j]
+                    << "," << E2[j] << ")\n";
+      g_log.debug() << " Difference (X,Y,E) = (" << std::fabs(X1[j] - X2[j])
+                    << "," << std::fabs(Y1[j] - Y2[j]) << ","
+                    << std::fabs(E1[j] - E2[j]) << ")\n";
+    }
+  }
+}
+
 //------------------------------------------------------------------------------------------------
 /**
  * Checks that the axes matches
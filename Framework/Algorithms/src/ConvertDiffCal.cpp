@@ -6,7 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/ConvertDiffCal.h"
 #include "MantidAPI/IAlgorithm.h"
-#include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/SpectrumGeometryTable.h"
 #include "MantidAPI/TableRow.h"
 #include "MantidDataObjects/OffsetsWorkspace.h"
 #include "MantidDataObjects/TableWorkspace.h"
@@ -14,6 +14,8 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidKernel/PhysicalConstants.h"
 
+#include <cmath>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -103,25 +105,22 @@ double getOffset(const OffsetsWorkspace_const_sptr &offsetsWS,
 /**
  * @param offsetsWS
  * @param index
- * @param spectrumInfo
+ * @param geometry
  * @return The offset adjusted value of DIFC
  */
 double calculateDIFC(const OffsetsWorkspace_const_sptr &offsetsWS,
                      const size_t index,
-                     const Mantid::API::SpectrumInfo &spectrumInfo) {
+                     const Mantid::API::SpectrumGeometryTable &geometry) {
   const detid_t detid = getDetID(offsetsWS, index);
   const double offset = getOffset(offsetsWS, detid);
-  double twotheta;
-  try {
-    twotheta = spectrumInfo.twoTheta(index);
-  } catch (std::runtime_error &) {
-    // Choose an arbitrary angle if detector 2theta determination fails.
+  double twotheta = geometry.twoTheta(index);
+  // Choose an arbitrary angle if detector 2theta determination fails.
+  if (std::isnan(twotheta))
     twotheta = 0.;
-  }
   // the factor returned is what is needed to convert TOF->d-spacing
   // the table is supposed to be filled with DIFC which goes the other way
   const double factor = Mantid::Geometry::Conversion::tofToDSpacingFactor(
-      spectrumInfo.l1(), spectrumInfo.l2(index), twotheta, offset);
+      geometry.l1(), geometry.l2(index), twotheta, offset);
   return 1. / factor;
 }
 
@@ -142,11 +141,11 @@ void ConvertDiffCal::exec() {
   const size_t numberOfSpectra = offsetsWS->getNumberHistograms();
   Progress progress(this, 0.0, 1.0, numberOfSpectra);
 
-  const Mantid::API::SpectrumInfo &spectrumInfo = offsetsWS->spectrumInfo();
+  const auto &geometry = offsetsWS->spectrumGeometryTable();
   for (size_t i = 0; i < numberOfSpectra; ++i) {
     API::TableRow newrow = configWksp->appendRow();
     newrow << static_cast<int>(getDetID(offsetsWS, i));
-    newrow << calculateDIFC(offsetsWS, i, spectrumInfo);
+    newrow << calculateDIFC(offsetsWS, i, geometry);
     newrow << 0.; // difa
     newrow << 0.; // tzero
 
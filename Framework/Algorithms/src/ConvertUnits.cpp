@@ -8,6 +8,7 @@
 #include "MantidAPI/AlgorithmFactory.h"
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumGeometryTable.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceUnitValidator.h"
 #include "MantidDataObjects/EventWorkspace.h"
@@ -464,6 +465,9 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   assert(static_cast<bool>(eventWS) == m_inputEvents); // Sanity check
 
   auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
+  const auto &geometry = outputWS->spectrumGeometryTable();
+  geometry.prepareDetectorValues(*fromUnit, *outputUnit, emode, signedTheta,
+                                 efixedProp == EMPTY_DBL());
   // Loop over the histograms (detector spectra)
   PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS))
   for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
@@ -482,8 +486,8 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
     if (efixedProp != EMPTY_DBL()) {
       pmap[UnitParams::efixed] = efixed;
     }
-    outSpectrumInfo.getDetectorValues(*fromUnit, *outputUnit, emode,
-                                      signedTheta, i, pmap);
+    geometry.getDetectorValues(*fromUnit, *outputUnit, emode, signedTheta,
+                               i, pmap);
     try {
       localFromUnit->toTOF(outputWS->dataX(i), emptyVec, l1, emode, pmap);
       // Convert from time-of-flight to the desired unit
@@ -21,9 +21,11 @@
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/VectorHelper.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <iterator>
 #include <numeric>
+#include <set>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -31,6 +33,16 @@ using namespace Mantid::DataObjects;
 using Mantid::HistogramData::BinEdges;
 using std::vector;
 
+namespace {
+/// Sums over a block of the spectra in a group
+struct PartialSum {
+  Mantid::MantidVec y;
+  Mantid::MantidVec e;
+  Mantid::MantidVec weight;
+  std::set<Mantid::detid_t> detectorIDs;
+};
+} // namespace
+
 namespace Mantid {
 
 namespace Algorithms {
@@ -172,45 +184,55 @@ void DiffractionFocussing2::exec() {
   }
   API::MatrixWorkspace_sptr out = API::WorkspaceFactory::Instance().create(
       m_matrixInputW, m_validGroups.size(), nPoints + 1, nPoints);
-  // Caching containers that are either only read from or unused. Initialize
-  // them once.
-  // Helgrind will show a race-condition but the data is completely unused so it
-  // is irrelevant
-  MantidVec weights_default(1, 1.0), emptyVec(1, 0.0), EOutDummy(nPoints);
+  // Caching containers that are only read from. Initialize them once.
+  const MantidVec weights_default(1, 1.0), emptyVec(1, 0.0);
+
+  // With fewer groups than threads the spectra of each group are split into
+  // blocks, so that all threads are busy. The first block of a group is
+  // accumulated in the output spectrum, the others in partial sums which are
+  // then added pairwise.
+  const size_t nOutput = m_validGroups.size();
+  const auto nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  const size_t nBlocks =
+      std::max(size_t{1}, (nThreads + nOutput - 1) / nOutput);
+  std::vector<PartialSum> partials(nOutput * nBlocks);
 
   Progress prog(this, 0.2, 1.0, static_cast<int>(totalHistProcess) + nGroups);
 
   PARALLEL_FOR_IF(Kernel::threadSafe(*m_matrixInputW, *out))
-  for (int outWorkspaceIndex = 0;
-       outWorkspaceIndex < static_cast<int>(m_validGroups.size());
-       outWorkspaceIndex++) {
+  for (int task = 0; task < static_cast<int>(nOutput * nBlocks); task++) {
     PARALLEL_START_INTERUPT_REGION
+    const size_t outWorkspaceIndex = static_cast<size_t>(task) / nBlocks;
+    const size_t block = static_cast<size_t>(task) % nBlocks;
     auto group = static_cast<int>(m_validGroups[outWorkspaceIndex]);
 
     // Get the group
     auto &Xout = group2xvector.at(group);
 
-    // Assign the new X axis only once (i.e when this group is encountered the
-    // first time)
-    out->setBinEdges(outWorkspaceIndex, Xout);
-
-    // This is the output spectrum
-    auto &outSpec = out->getSpectrum(outWorkspaceIndex);
-    outSpec.setSpectrumNo(group);
-
-    // Get the references to Y and E output and rebin
+    // The first block of each group writes directly to the output spectrum
+    auto &partial = partials[task];
+    partial.weight.assign(nPoints, 0.0);
+    if (block == 0) {
+      out->setBinEdges(outWorkspaceIndex, Xout);
+    } else {
+      partial.y.assign(nPoints, 0.0);
+      partial.e.assign(nPoints, 0.0);
+    }
     // TODO can only be changed once rebin implemented in HistogramData
-    auto &Yout = outSpec.dataY();
-    auto &Eout = outSpec.dataE();
-
-    // Initialize the group's weight vector here and the dummy vector used for
-    // accumulating errors.
-    MantidVec groupWgt(nPoints, 0.0);
-
-    // loop through the contributing histograms
+    auto &Yout =
+        block == 0 ? out->getSpectrum(outWorkspaceIndex).dataY() : partial.y;
+    auto &Eout =
+        block == 0 ? out->getSpectrum(outWorkspaceIndex).dataE() : partial.e;
+    auto &groupWgt = partial.weight;
+    // Accumulates the unused errors of the weights
+    MantidVec EOutDummy(nPoints);
+
+    // loop through the contributing histograms of this block
     const std::vector<size_t> &indices = m_wsIndices[outWorkspaceIndex];
     const size_t groupSize = indices.size();
-    for (size_t i = 0; i < groupSize; i++) {
+    const size_t blockStart = groupSize * block / nBlocks;
+    const size_t blockEnd = groupSize * (block + 1) / nBlocks;
+    for (size_t i = blockStart; i < blockEnd; i++) {
       size_t inWorkspaceIndex = indices[i];
       // This is the input spectrum
       const auto &inSpec = m_matrixInputW->getSpectrum(inWorkspaceIndex);
@@ -218,7 +240,8 @@ void DiffractionFocussing2::exec() {
       auto &Xin = inSpec.x();
       auto &Yin = inSpec.y();
       auto &Ein = inSpec.e();
-      outSpec.addDetectorIDs(inSpec.getDetectorIDs());
+      const auto &detectorIDs = inSpec.getDetectorIDs();
+      partial.detectorIDs.insert(detectorIDs.cbegin(), detectorIDs.cend());
 
       try {
         // TODO This should be implemented in Histogram as rebin
@@ -271,8 +294,6 @@ void DiffractionFocussing2::exec() {
       } else // If no masked bins we want to add 1 to the weight of the output
              // bins that this input covers
       {
-        // Initialized within the loop to avoid having to wrap writing to it
-        // with a PARALLEL_CRITICAL sections
         MantidVec limits(2);
 
         if (eventXMin > 0. && eventXMax > 0.) {
@@ -289,6 +310,46 @@ void DiffractionFocussing2::exec() {
       }
       prog.report();
     } // end of loop for input spectra
+    PARALLEL_END_INTERUPT_REGION
+  } // end of loop for blocks
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  PARALLEL_FOR_IF(Kernel::threadSafe(*out))
+  for (int outWorkspaceIndex = 0; outWorkspaceIndex < static_cast<int>(nOutput);
+       outWorkspaceIndex++) {
+    PARALLEL_START_INTERUPT_REGION
+    auto group = static_cast<int>(m_validGroups[outWorkspaceIndex]);
+    auto &Xout = group2xvector.at(group);
+
+    // This is the output spectrum
+    auto &outSpec = out->getSpectrum(outWorkspaceIndex);
+    outSpec.setSpectrumNo(group);
+    auto &Yout = outSpec.dataY();
+    auto &Eout = outSpec.dataE();
+
+    // Add the partial sums of the blocks pairwise into the first one
+    PartialSum *groupPartials = &partials[outWorkspaceIndex * nBlocks];
+    for (size_t stride = 1; stride < nBlocks; stride *= 2) {
+      for (size_t block = 0; block + stride < nBlocks; block += 2 * stride) {
+        auto &source = groupPartials[block + stride];
+        auto &sink = groupPartials[block];
+        auto &sinkY = block == 0 ? Yout : sink.y;
+        auto &sinkE = block == 0 ? Eout : sink.e;
+        std::transform(sinkY.begin(), sinkY.end(), source.y.begin(),
+                       sinkY.begin(), std::plus<double>());
+        std::transform(sinkE.begin(), sinkE.end(), source.e.begin(),
+                       sinkE.begin(), std::plus<double>());
+        std::transform(sink.weight.begin(), sink.weight.end(),
+                       source.weight.begin(), sink.weight.begin(),
+                       std::plus<double>());
+        sink.detectorIDs.insert(source.detectorIDs.cbegin(),
+                                source.detectorIDs.cend());
+        source = PartialSum();
+      }
+    }
+    const auto &groupWgt = groupPartials->weight;
+    outSpec.addDetectorIDs(groupPartials->detectorIDs);
+    const size_t groupSize = m_wsIndices[outWorkspaceIndex].size();
 
     // Calculate the bin widths
     std::vector<double> widths(Xout.size());
@@ -318,6 +379,7 @@ void DiffractionFocussing2::exec() {
     std::for_each(Eout.begin(), Eout.end(), [groupSize](double &val) {
       val *= static_cast<double>(groupSize);
     });
+    *groupPartials = PartialSum();
 
     prog.report();
     PARALLEL_END_INTERUPT_REGION
@@ -394,6 +456,8 @@ void DiffractionFocussing2::execEvent() {
     int chunkSize = 200;
 
     int end = (totalHistProcess / chunkSize) + 1;
+    std::vector<size_t> chunkStarts;
+    bool allChunksAreSorted = true;
     // cppcheck-suppress syntaxError
     PRAGMA_OMP(parallel for schedule(dynamic, 1) )
     for (int wiChunk = 0; wiChunk < end; wiChunk++) {
@@ -410,20 +474,33 @@ void DiffractionFocussing2::execEvent() {
       // chunkEL.reserve(numEventsInChunk);
 
       // process the chunk
+      std::vector<size_t> runStarts;
+      bool chunkIsSorted = true;
       for (int i = wiChunk * chunkSize; i < max; i++) {
         // Accumulate the chunk
         size_t wi = indices[i];
-        chunkEL += m_eventW->getSpectrum(wi);
+        const auto &inputEL = m_eventW->getSpectrum(wi);
+        chunkIsSorted =
+            chunkIsSorted && (inputEL.empty() || inputEL.isSortedByTof());
+        runStarts.emplace_back(chunkEL.getNumberEvents());
+        chunkEL += inputEL;
       }
+      // Merging the sorted spectra is cheaper than sorting the group later
+      if (chunkIsSorted)
+        chunkEL.sortTofFromRuns(runStarts);
 
       // Rejoin the chunk with the rest.
       PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) {
+        allChunksAreSorted = allChunksAreSorted && chunkIsSorted;
+        chunkStarts.emplace_back(groupEL.getNumberEvents());
         groupEL += chunkEL;
       }
 
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
+    if (allChunksAreSorted)
+      groupEL.sortTofFromRuns(chunkStarts);
   } else {
     // ------ PARALLELIZE BY GROUPS -------------------------
 
@@ -432,9 +509,17 @@ void DiffractionFocussing2::execEvent() {
     for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
       PARALLEL_START_INTERUPT_REGION
       const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
+      EventList &groupEL = out->getSpectrum(iGroup);
+      std::vector<size_t> runStarts;
+      runStarts.reserve(indices.size());
+      bool groupIsSorted = true;
       for (auto wi : indices) {
         // In workspace index iGroup, put what was in the OLD workspace index wi
-        out->getSpectrum(iGroup) += m_eventW->getSpectrum(wi);
+        const auto &inputEL = m_eventW->getSpectrum(wi);
+        groupIsSorted =
+            groupIsSorted && (inputEL.empty() || inputEL.isSortedByTof());
+        runStarts.emplace_back(groupEL.getNumberEvents());
+        groupEL += inputEL;
 
         prog->reportIncrement(1, "Appending Lists");
 
@@ -446,6 +531,9 @@ void DiffractionFocussing2::execEvent() {
               .clear();
         }
       }
+      // Merging the sorted spectra is cheaper than sorting the group later
+      if (groupIsSorted)
+        groupEL.sortTofFromRuns(runStarts);
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
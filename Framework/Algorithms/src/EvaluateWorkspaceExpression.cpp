@@ -0,0 +1,124 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/EvaluateWorkspaceExpression.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/Expression.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAlgorithms/WorkspaceExpression.h"
+#include "MantidKernel/MandatoryValidator.h"
+
+#include <stdexcept>
+
+namespace Mantid {
+namespace Algorithms {
+
+DECLARE_ALGORITHM(EvaluateWorkspaceExpression)
+
+using namespace API;
+using namespace Kernel;
+
+namespace {
+/// Returns true and sets value if name is a number
+bool toNumber(const std::string &name, double &value) {
+  try {
+    size_t length = 0;
+    value = std::stod(name, &length);
+    return length == name.size();
+  } catch (std::logic_error &) {
+    return false;
+  }
+}
+} // namespace
+
+void EvaluateWorkspaceExpression::init() {
+  declareProperty("Expression", "",
+                  std::make_shared<MandatoryValidator<std::string>>(),
+                  "An expression of workspace names and numbers combined with "
+                  "+, -, *, / and brackets, and raised to numeric powers with "
+                  "^, e.g. (ws - bkg) / van * 1.3");
+  declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "OutputWorkspace", "", Direction::Output),
+                  "The result of the expression.");
+}
+
+std::map<std::string, std::string>
+EvaluateWorkspaceExpression::validateInputs() {
+  std::map<std::string, std::string> issues;
+  Expression expr;
+  try {
+    expr.parse(getPropertyValue("Expression"));
+    toWorkspaceExpression(expr);
+  } catch (std::exception &e) {
+    issues["Expression"] = e.what();
+  }
+  return issues;
+}
+
+void EvaluateWorkspaceExpression::exec() {
+  Expression expr;
+  expr.parse(getPropertyValue("Expression"));
+  setProperty("OutputWorkspace", toWorkspaceExpression(expr).evaluate());
+}
+
+/** Build a WorkspaceExpression from a parsed expression. Names that are not
+ * numbers are looked up in the AnalysisDataService.
+ * @param expr :: the parsed expression
+ * @return the (unevaluated) WorkspaceExpression
+ * @throws std::invalid_argument if the expression contains an unsupported
+ * operation or a name that is neither a number nor a MatrixWorkspace
+ */
+WorkspaceExpression EvaluateWorkspaceExpression::toWorkspaceExpression(
+    const Expression &expr) {
+  const auto &term = expr.bracketsRemoved();
+  const auto &name = term.name();
+  if (!term.isFunct()) {
+    double value;
+    if (toNumber(name, value))
+      return WorkspaceExpression(value);
+    auto &ads = AnalysisDataService::Instance();
+    if (!ads.doesExist(name))
+      throw std::invalid_argument("No workspace named '" + name + "'");
+    auto workspace = ads.retrieveWS<MatrixWorkspace>(name);
+    if (!workspace)
+      throw std::invalid_argument("'" + name + "' is not a MatrixWorkspace");
+    return WorkspaceExpression(workspace);
+  }
+  if (term.size() == 1 && (name == "-" || name == "+")) {
+    // Unary sign
+    const auto operand = toWorkspaceExpression(term[0]);
+    return name == "-" ? WorkspaceExpression(-1.0) * operand : operand;
+  }
+  if (name == "^") {
+    double exponent;
+    if (term.size() != 2 || term[1].isFunct() ||
+        !toNumber(term[1].name(), exponent))
+      throw std::invalid_argument("Only single numeric exponents are "
+                                  "supported: " +
+                                  term.str());
+    return pow(toWorkspaceExpression(term[0]), exponent);
+  }
+  if (name != "+" && name != "*")
+    throw std::invalid_argument("Unsupported operation '" + name +
+                                "' in: " + term.str());
+  auto result = toWorkspaceExpression(term[0]);
+  for (size_t i = 1; i < term.size(); ++i) {
+    const auto operand = toWorkspaceExpression(term[i]);
+    const auto &op = term[i].operator_name();
+    if (op == "+")
+      result = result + operand;
+    else if (op == "-")
+      result = result - operand;
+    else if (op == "*")
+      result = result * operand;
+    else
+      result = result / operand;
+  }
+  return result;
+}
+
+} // namespace Algorithms
+} // namespace Mantid
@@ -149,14 +149,48 @@ void ExtractSpectra::exec() {
     this->execHistogram();
 }
 
+namespace {
+/** Slice the Y, E and Dx data of a histogram and give it the X data x, which
+ * must already be sliced.
+ */
+Histogram sliceWithX(const Histogram &histogram,
+                     const Kernel::cow_ptr<HistogramX> &x, const size_t begin,
+                     const size_t end) {
+  Histogram sliced = histogram.xMode() == Histogram::XMode::BinEdges
+                         ? Histogram(BinEdges(x))
+                         : Histogram(Points(x));
+  if (histogram.sharedY()) {
+    const auto &y = histogram.y();
+    if (histogram.yMode() == Histogram::YMode::Frequencies)
+      sliced.setFrequencies(y.begin() + begin, y.begin() + end);
+    else
+      sliced.setCounts(y.begin() + begin, y.begin() + end);
+  }
+  if (histogram.sharedE())
+    sliced.setSharedE(Kernel::make_cow<HistogramE>(
+        histogram.e().begin() + begin, histogram.e().begin() + end));
+  if (histogram.sharedDx())
+    sliced.setSharedDx(Kernel::make_cow<HistogramDx>(
+        histogram.dx().begin() + begin, histogram.dx().begin() + end));
+  return sliced;
+}
+} // namespace
+
 /// Execute the algorithm in case of a histogrammed data.
 void ExtractSpectra::execHistogram() {
   auto size = static_cast<int>(m_inputWorkspace->getNumberHistograms());
   Progress prog(this, 0.0, 1.0, size);
+  // With common bins all spectra get the same X, slice it only once
+  Kernel::cow_ptr<HistogramX> commonX(nullptr);
+  if (m_commonBoundaries && size > 0)
+    commonX = slice(m_inputWorkspace->histogram(0), m_minX,
+                    m_maxX - m_histogram)
+                  .sharedX();
   for (int i = 0; i < size; ++i) {
     if (m_commonBoundaries) {
-      m_inputWorkspace->setHistogram(i, slice(m_inputWorkspace->histogram(i),
-                                              m_minX, m_maxX - m_histogram));
+      m_inputWorkspace->setHistogram(
+          i, sliceWithX(m_inputWorkspace->histogram(i), commonX, m_minX,
+                        m_maxX - m_histogram));
     } else {
       this->cropRagged(*m_inputWorkspace, i);
     }
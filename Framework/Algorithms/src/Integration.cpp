@@ -22,6 +22,7 @@
 
 #include <cmath>
 #include <numeric>
+#include <tuple>
 
 namespace Mantid {
 namespace Algorithms {
@@ -80,6 +81,34 @@ public:
   }
 };
 
+namespace {
+/**
+ * Finds the X values bounding an integration range
+ * @param X :: the X values of a spectrum
+ * @param lowerLimit :: the lower limit, EMPTY_DBL() for the first X value
+ * @param upperLimit :: the upper limit, EMPTY_DBL() for the last X value
+ * @return iterators to the first X value not below the lower limit and past
+ * the last X value not above the upper limit
+ */
+std::pair<MantidVec::const_iterator, MantidVec::const_iterator>
+integrationRange(const HistogramX &X, const double lowerLimit,
+                 const double upperLimit) {
+  MantidVec::const_iterator lowit, highit;
+  if (lowerLimit == EMPTY_DBL()) {
+    lowit = X.begin();
+  } else {
+    lowit = std::lower_bound(X.begin(), X.end(), lowerLimit, tolerant_less());
+  }
+
+  if (upperLimit == EMPTY_DBL()) {
+    highit = X.end();
+  } else {
+    highit = std::upper_bound(lowit, X.end(), upperLimit, tolerant_less());
+  }
+  return {lowit, highit};
+}
+} // namespace
+
 /** Executes the algorithm
  *
  *  @throw runtime_error Thrown if algorithm cannot execute
@@ -174,6 +203,17 @@ void Integration::exec() {
   const bool axisIsText = localworkspace->getAxis(1)->isText();
   const bool axisIsNumeric = localworkspace->getAxis(1)->isNumeric();
 
+  // Without ranges per spectrum, the integration range is the same for all
+  // spectra sharing their X data. Find it once for the X data of the first
+  // spectrum, which is all X data for workspaces with common bins.
+  const HistogramX *commonX = nullptr;
+  MantidVec::const_iterator commonLowit, commonHighit;
+  if (minRanges.empty() && maxRanges.empty() && minRange <= maxRange) {
+    commonX = &localworkspace->x(minWsIndex);
+    std::tie(commonLowit, commonHighit) =
+        integrationRange(*commonX, minRange, maxRange);
+  }
+
   // Loop over spectra
   PARALLEL_FOR_IF(Kernel::threadSafe(*localworkspace, *outputWorkspace))
   for (int i = minWsIndex; i <= maxWsIndex; ++i) {
@@ -230,16 +270,11 @@ void Integration::exec() {
       progress.report();
       continue;
     }
-    if (lowerLimit == EMPTY_DBL()) {
-      lowit = X.begin();
-    } else {
-      lowit = std::lower_bound(X.begin(), X.end(), lowerLimit, tolerant_less());
-    }
-
-    if (upperLimit == EMPTY_DBL()) {
-      highit = X.end();
+    if (&X == commonX) {
+      lowit = commonLowit;
+      highit = commonHighit;
     } else {
-      highit = std::upper_bound(lowit, X.end(), upperLimit, tolerant_less());
+      std::tie(lowit, highit) = integrationRange(X, lowerLimit, upperLimit);
     }
 
     // If range specified doesn't overlap with this spectrum then bail out
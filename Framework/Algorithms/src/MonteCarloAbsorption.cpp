@@ -491,22 +491,12 @@ MonteCarloAbsorption::createBeamProfile(const Instrument &instrument,
 void MonteCarloAbsorption::interpolateFromSparse(
     MatrixWorkspace &targetWS, const SparseWorkspace &sparseWS,
     const Mantid::Algorithms::InterpolationOption &interpOpt) {
-  const auto &spectrumInfo = targetWS.spectrumInfo();
-  const auto refFrame = targetWS.getInstrument()->getReferenceFrame();
+  const auto numSpectra =
+      static_cast<int64_t>(targetWS.getNumberHistograms());
   PARALLEL_FOR_IF(Kernel::threadSafe(targetWS, sparseWS))
-  for (int64_t i = 0; i < static_cast<decltype(i)>(spectrumInfo.size()); ++i) {
+  for (int64_t i = 0; i < numSpectra; ++i) {
     PARALLEL_START_INTERUPT_REGION
-    double lat, lon;
-    std::tie(lat, lon) = spectrumInfo.geographicalAngles(i);
-    const auto spatiallyInterpHisto =
-        sparseWS.bilinearInterpolateFromDetectorGrid(lat, lon);
-    if (spatiallyInterpHisto.size() > 1) {
-      auto targetHisto = targetWS.histogram(i);
-      interpOpt.applyInPlace(spatiallyInterpHisto, targetHisto);
-      targetWS.setHistogram(i, targetHisto);
-    } else {
-      targetWS.mutableY(i) = spatiallyInterpHisto.y().front();
-    }
+    sparseWS.interpolateInto(targetWS, static_cast<size_t>(i), interpOpt);
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
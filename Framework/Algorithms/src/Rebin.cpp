@@ -249,14 +249,33 @@ void Rebin::exec() {
           1, std::unique_ptr<Axis>(inputWS->getAxis(1)->clone(outputWS.get())));
     bool ignoreBinErrors = getProperty("IgnoreBinErrors");
 
+    // Spectra sharing the X of the first spectrum are rebinned with bin
+    // overlaps computed only once
+    Kernel::cow_ptr<HistogramData::HistogramX> commonX(nullptr);
+    std::unique_ptr<HistogramData::Rebinner> rebinner;
+    if (histnumber > 0) {
+      try {
+        rebinner = std::make_unique<HistogramData::Rebinner>(
+            inputWS->binEdges(0), XValues_new);
+        commonX = inputWS->sharedX(0);
+      } catch (InvalidBinEdgesError &) {
+        // Handled for each spectrum below
+      }
+    }
+
     Progress prog(this, 0.0, 1.0, histnumber);
     PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
     for (int hist = 0; hist < histnumber; ++hist) {
       PARALLEL_START_INTERUPT_REGION
 
       try {
-        outputWS->setHistogram(
-            hist, HistogramData::rebin(inputWS->histogram(hist), XValues_new));
+        if (rebinner && inputWS->sharedX(hist) == commonX)
+          outputWS->setHistogram(hist,
+                                 rebinner->rebin(inputWS->histogram(hist)));
+        else
+          outputWS->setHistogram(hist, HistogramData::rebin(
+                                           inputWS->histogram(hist),
+                                           XValues_new));
       } catch (InvalidBinEdgesError &) {
         if (ignoreBinErrors)
           outputWS->setBinEdges(hist, XValues_new);
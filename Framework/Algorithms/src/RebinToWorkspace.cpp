@@ -130,6 +130,16 @@ void RebinToWorkspace::rebin(MatrixWorkspace_sptr &toRebin,
   const bool matchingX =
       (toRebin->getNumberHistograms() != toMatch->getNumberHistograms());
 
+  // Spectra sharing the X of the first spectrum are rebinned with bin
+  // overlaps computed only once if they all get the same bin boundaries
+  Kernel::cow_ptr<HistogramData::HistogramX> commonX(nullptr);
+  std::unique_ptr<HistogramData::Rebinner> rebinner;
+  if (matchingX && !m_isEvents && numHist > 0) {
+    rebinner = std::make_unique<HistogramData::Rebinner>(
+        toRebin->binEdges(0), toMatch->binEdges(0));
+    commonX = toRebin->sharedX(0);
+  }
+
   // rebin
   PARALLEL_FOR_IF(Kernel::threadSafe(*toMatch, *outputWS))
   for (int i = 0; i < numHist; ++i) {
@@ -138,6 +148,8 @@ void RebinToWorkspace::rebin(MatrixWorkspace_sptr &toRebin,
                                   : toMatch->histogram(i).binEdges();
     if (m_isEvents) {
       outputWSEvents->getSpectrum(i).setHistogram(edges);
+    } else if (rebinner && toRebin->sharedX(i) == commonX) {
+      outputWS->setHistogram(i, rebinner->rebin(toRebin->histogram(i)));
     } else {
       outputWS->setHistogram(
           i, HistogramData::rebin(toRebin->histogram(i), edges));
@@ -9,6 +9,7 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/SpectrumInfo.h"
+#include "MantidAlgorithms/InterpolationOption.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/Detector.h"
@@ -22,6 +23,9 @@
 #include <Poco/DOM/AutoPtr.h>
 #include <Poco/DOM/Document.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace {
 /** Check all detectors have the same EFixed value.
  *  @param eFixed An EFixedProvider object.
@@ -41,6 +45,9 @@ bool constantIndirectEFixed(const Mantid::API::ExperimentInfo &info,
 
 constexpr double R = 1.0; // This will be the default L2 distance.
 
+/// Number of rows and columns of the first grid tried by evaluateAdaptively
+constexpr size_t INITIAL_GRID_SIZE = 5;
+
 /// static logger
 Mantid::Kernel::Logger g_log("SparseWorkspace");
 } // namespace
@@ -473,5 +480,111 @@ SparseWorkspace::bilinearInterpolateFromDetectorGrid(const double lat,
   return h;
 }
 
+/** Interpolate the values of this sparse workspace to a spectrum of a
+ *  target workspace, both spatially and in wavelength.
+ *  @param targetWS A workspace with the instrument this sparse workspace was
+ *  modelled on.
+ *  @param index The workspace index of the spectrum whose Y and E values are
+ *  overwritten.
+ *  @param interpOpt The method used for interpolating in wavelength.
+ */
+void SparseWorkspace::interpolateInto(
+    API::MatrixWorkspace &targetWS, const size_t index,
+    const InterpolationOption &interpOpt) const {
+  double lat, lon;
+  std::tie(lat, lon) = targetWS.spectrumInfo().geographicalAngles(index);
+  const auto spatiallyInterpHisto =
+      bilinearInterpolateFromDetectorGrid(lat, lon);
+  if (spatiallyInterpHisto.size() > 1) {
+    auto targetHisto = targetWS.histogram(index);
+    interpOpt.applyInPlace(spatiallyInterpHisto, targetHisto);
+    targetWS.setHistogram(index, targetHisto);
+  } else {
+    targetWS.mutableY(index) = spatiallyInterpHisto.y().front();
+  }
+}
+
+/** Estimate the largest error made by interpolating from the detector grid.
+ *  Each interior grid point is compared with the linear interpolation between
+ *  its neighbours along latitude and longitude. The deviation is four times
+ *  the leading order error of linear interpolation on the grid.
+ *  @return The estimated error relative to the largest absolute Y value.
+ */
+double SparseWorkspace::maxInterpolationError() const {
+  const auto rows = m_gridDef->numberRows();
+  const auto columns = m_gridDef->numberColumns();
+  const auto index = [rows](const size_t row, const size_t col) {
+    return col * rows + row;
+  };
+  double maxValue = 0.;
+  for (size_t i = 0; i < getNumberHistograms(); ++i) {
+    for (const auto value : y(i)) {
+      if (std::isfinite(value))
+        maxValue = std::max(maxValue, std::abs(value));
+    }
+  }
+  if (maxValue == 0.)
+    return 0.;
+  double maxDeviation = 0.;
+  const auto updateDeviation = [&](const size_t centre, const size_t before,
+                                   const size_t after) {
+    const auto &yCentre = y(centre);
+    const auto &yBefore = y(before);
+    const auto &yAfter = y(after);
+    for (size_t j = 0; j < yCentre.size(); ++j) {
+      const double deviation =
+          std::abs(yCentre[j] - 0.5 * (yBefore[j] + yAfter[j]));
+      if (std::isfinite(deviation))
+        maxDeviation = std::max(maxDeviation, deviation);
+    }
+  };
+  for (size_t col = 0; col < columns; ++col) {
+    for (size_t row = 0; row < rows; ++row) {
+      if (row > 0 && row + 1 < rows)
+        updateDeviation(index(row, col), index(row - 1, col),
+                        index(row + 1, col));
+      if (col > 0 && col + 1 < columns)
+        updateDeviation(index(row, col), index(row, col - 1),
+                        index(row, col + 1));
+    }
+  }
+  return 0.25 * maxDeviation / maxValue;
+}
+
+/** Evaluate a correction on sparse workspaces of increasing grid density
+ *  until the estimated interpolation error is within a tolerance. Each step
+ *  halves the grid spacing.
+ *  @param modelWS The workspace the sparse workspaces approximate.
+ *  @param wavelengthPoints Number of wavelength points in the sparse
+ *  workspaces.
+ *  @param evaluate Computes the correction for all spectra of a sparse
+ *  workspace.
+ *  @param tolerance Maximum relative interpolation error.
+ *  @return The evaluated sparse workspace, or nullptr if a grid with the
+ *  required accuracy has at least as many points as modelWS has spectra. The
+ *  correction should then be evaluated for every spectrum.
+ */
+std::unique_ptr<SparseWorkspace> SparseWorkspace::evaluateAdaptively(
+    const API::MatrixWorkspace &modelWS, const size_t wavelengthPoints,
+    const Evaluator &evaluate, const double tolerance) {
+  const auto numSpectra = modelWS.getNumberHistograms();
+  size_t gridSize = INITIAL_GRID_SIZE;
+  while (gridSize * gridSize < numSpectra) {
+    auto sparseWS = std::make_unique<SparseWorkspace>(
+        modelWS, wavelengthPoints, gridSize, gridSize);
+    evaluate(*sparseWS);
+    const double error = sparseWS->maxInterpolationError();
+    g_log.information() << "Sparse instrument with " << gridSize << "x"
+                        << gridSize
+                        << " detectors has an estimated relative "
+                           "interpolation error of "
+                        << error << '\n';
+    if (error <= tolerance)
+      return sparseWS;
+    gridSize = 2 * gridSize - 1;
+  }
+  return nullptr;
+}
+
 } // namespace Algorithms
 } // namespace Mantid
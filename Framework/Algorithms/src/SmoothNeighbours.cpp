@@ -15,9 +15,12 @@
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidGeometry/ICompAssembly.h"
 #include "MantidGeometry/IComponent.h"
+#include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument/DetectorGroup.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/DetectorSpatialIndex.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Objects/BoundingBox.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/ListValidator.h"
@@ -34,7 +37,6 @@ using ConstVecProperties = const VecProperties;
 
 namespace Mantid {
 namespace Algorithms {
-
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(SmoothNeighbours)
 
@@ -339,8 +341,17 @@ void SmoothNeighbours::findNeighboursUbiqutious() {
   m_neighbours.resize(inWS->getNumberHistograms());
 
   bool ignoreMaskedDetectors = getProperty("IgnoreMaskedDetectors");
-  WorkspaceNearestNeighbourInfo neighbourInfo(*inWS, ignoreMaskedDetectors,
-                                              nNeighbours);
+  // If every spectrum has a single detector, search the cached spatial index
+  // of the instrument. Otherwise search the positions of the spectra.
+  const auto workspaceIndices =
+      inWS->getDetectorIndexToWorkspaceIndexVector();
+  std::unique_ptr<WorkspaceNearestNeighbourInfo> neighbourInfo;
+  V3D searchScale;
+  if (workspaceIndices.empty())
+    neighbourInfo = std::make_unique<WorkspaceNearestNeighbourInfo>(
+        *inWS, ignoreMaskedDetectors, nNeighbours);
+  else
+    searchScale = neighbourSearchScale(workspaceIndices, ignoreMaskedDetectors);
 
   // Cull by radius
   RadiusFilter radiusFilter(Radius);
@@ -387,7 +398,10 @@ void SmoothNeighbours::findNeighboursUbiqutious() {
     specnum_t inSpec = inWS->getSpectrum(wi).getSpectrumNo();
 
     // Step one - Get the number of specified neighbours
-    SpectraDistanceMap insideGrid = neighbourInfo.getNeighboursExact(inSpec);
+    SpectraDistanceMap insideGrid =
+        neighbourInfo ? neighbourInfo->getNeighboursExact(inSpec)
+                      : nearestDetectors(wi, workspaceIndices, searchScale,
+                                         ignoreMaskedDetectors);
 
     // Step two - Filter the results by the radius cut off.
     SpectraDistanceMap neighbSpectra = radiusFilter.apply(insideGrid);
@@ -450,6 +464,78 @@ void SmoothNeighbours::findNeighboursUbiqutious() {
   delete[] used;
 }
 
+/** Returns the size of the first detector searched for neighbours.
+ * Like WorkspaceNearestNeighbours, distances are measured in units of this
+ * size when choosing neighbours, so that non-square pixels are handled.
+ * @param workspaceIndices : The workspace index of each detector
+ * @param ignoreMaskedDetectors : True if masked detectors are not neighbours
+ * @return The length of one unit along each axis
+ */
+V3D SmoothNeighbours::neighbourSearchScale(
+    const std::vector<size_t> &workspaceIndices,
+    const bool ignoreMaskedDetectors) const {
+  const auto &detectorInfo = inWS->detectorInfo();
+  for (size_t i = 0; i < workspaceIndices.size(); ++i) {
+    if (workspaceIndices[i] == std::numeric_limits<size_t>::max() ||
+        detectorInfo.isMonitor(i) ||
+        (ignoreMaskedDetectors && detectorInfo.isMasked(i)))
+      continue;
+    BoundingBox bbox;
+    detectorInfo.detector(i).getBoundingBox(bbox);
+    const auto width = bbox.width();
+    V3D scale(1.0, 1.0, 1.0);
+    for (size_t axis = 0; axis < 3; ++axis)
+      if (width[axis] > 0.0)
+        scale[axis] = width[axis];
+    return scale;
+  }
+  return V3D(1.0, 1.0, 1.0);
+}
+
+/** Find the nearest neighbours of the detector of a spectrum using the spatial
+ * index of the instrument. As for WorkspaceNearestNeighbours, up to
+ * nNeighbours spectra are returned, excluding the spectrum itself and any
+ * detector at the same position.
+ * @param wi : The workspace index of the central spectrum
+ * @param workspaceIndices : The workspace index of each detector
+ * @param scale : The units in which distances are compared
+ * @param ignoreMaskedDetectors : True if masked detectors are not neighbours
+ * @return The spectrum numbers of the neighbours and their offsets from the
+ * central detector
+ */
+SpectraDistanceMap
+SmoothNeighbours::nearestDetectors(const size_t wi,
+                                   const std::vector<size_t> &workspaceIndices,
+                                   const V3D &scale,
+                                   const bool ignoreMaskedDetectors) const {
+  const auto &detectorInfo = inWS->detectorInfo();
+  const auto &index = detectorInfo.spatialIndex();
+  const auto center = detectorInfo.indexOf(
+      *inWS->getSpectrum(wi).getDetectorIDs().begin());
+  const auto centerPos = detectorInfo.position(center);
+  const auto wanted = static_cast<size_t>(nNeighbours);
+
+  SpectraDistanceMap result;
+  // Query more candidates until enough are eligible or all are found
+  for (auto k = wanted + 1;; k *= 2) {
+    result.clear();
+    const auto candidates = index.nearest(centerPos, k, scale);
+    for (const auto &candidate : candidates) {
+      const auto neighbWI = workspaceIndices[candidate.first];
+      if (candidate.second == 0.0 ||
+          neighbWI == std::numeric_limits<size_t>::max() ||
+          (ignoreMaskedDetectors && detectorInfo.isMasked(candidate.first)))
+        continue;
+      result[inWS->getSpectrum(neighbWI).getSpectrumNo()] =
+          detectorInfo.position(candidate.first) - centerPos;
+      if (result.size() == wanted)
+        return result;
+    }
+    if (candidates.size() < k)
+      return result;
+  }
+}
+
 /**
 Attempts to reset the Weight based on the strategyName provided. Note that if
 these conditional statements fail to override the existing WeightedSum member,
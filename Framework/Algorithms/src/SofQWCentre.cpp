@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/SofQWCentre.h"
 #include "MantidAPI/SpectrumDetectorMapping.h"
+#include "MantidAPI/SpectrumGeometryTable.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAlgorithms/SofQW.h"
 #include "MantidDataObjects/Histogram1D.h"
@@ -51,6 +52,7 @@ void SofQWCentre::exec() {
 
   const auto &detectorInfo = inputWorkspace->detectorInfo();
   const auto &spectrumInfo = inputWorkspace->spectrumInfo();
+  const auto &geometry = inputWorkspace->spectrumGeometryTable();
   const V3D beamDir =
       normalize(detectorInfo.samplePosition() - detectorInfo.sourcePosition());
   const double l1 = detectorInfo.l1();
@@ -62,7 +64,7 @@ void SofQWCentre::exec() {
   const size_t numBins = inputWorkspace->blocksize();
   Progress prog(this, 0.0, 1.0, numHists);
   for (int64_t i = 0; i < int64_t(numHists); ++i) {
-    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i))
+    if (!geometry.hasDetectors(i) || geometry.isMonitor(i))
       continue;
 
     const auto &spectrumDet = spectrumInfo.detector(i);
@@ -23,6 +23,7 @@
 #include "MantidGeometry/Objects/CSGObject.h"
 #include "MantidGeometry/Objects/IObject.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/Memory.h"
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
@@ -399,6 +400,22 @@ void SofQWNormalisedPolygon::exec() {
   const auto &inputIndices = inputWS->indexInfo();
   const auto &spectrumInfo = inputWS->spectrumInfo();
 
+  // Each thread rebins into its own buffer if they fit in memory, otherwise
+  // the threads add to the output workspace in a critical section
+  using FractionalRebinning::FractionalRebinBuffer;
+  std::vector<FractionalRebinBuffer> buffers;
+  const auto nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  if (nThreads > 1) {
+    Kernel::MemoryStats memory;
+    memory.update();
+    if (nThreads * FractionalRebinBuffer::memorySize(*outputWS) <
+        memory.availMem() * 1024 / 4)
+      buffers.assign(nThreads, FractionalRebinBuffer(*outputWS));
+    else
+      g_log.information("Not enough memory for a buffer per thread, threads "
+                        "will share the output workspace.");
+  }
+
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
   for (int64_t i = 0; i < static_cast<int64_t>(nHistos); ++i) {
     PARALLEL_START_INTERUPT_REGION
@@ -412,8 +429,17 @@ void SofQWNormalisedPolygon::exec() {
     const double thetaLower = m_twoThetaLowers[i];
     const double thetaUpper = m_twoThetaUppers[i];
 
+    // Q at the energy bin edges, shared by the polygons of adjacent bins
+    std::vector<double> qLower(nEnergyBins + 1);
+    std::vector<double> qUpper(nEnergyBins + 1);
+    for (size_t j = 0; j <= nEnergyBins; ++j) {
+      qLower[j] = m_EmodeProperties.q(X[j], thetaLower, det);
+      qUpper[j] = m_EmodeProperties.q(X[j], thetaUpper, det);
+    }
+
     const auto specNo = static_cast<specnum_t>(inputIndices.spectrumNumber(i));
     std::stringstream logStream;
+    std::vector<size_t> mappedQIndices;
     for (size_t j = 0; j < nEnergyBins; ++j) {
       m_progress->report("Computing polygon intersections");
       // For each input polygon test where it intersects with
@@ -421,12 +447,12 @@ void SofQWNormalisedPolygon::exec() {
       const double dE_j = X[j];
       const double dE_jp1 = X[j + 1];
 
-      const double lrQ = m_EmodeProperties.q(dE_jp1, thetaLower, det);
+      const double lrQ = qLower[j + 1];
 
-      const V2D ll(dE_j, m_EmodeProperties.q(dE_j, thetaLower, det));
+      const V2D ll(dE_j, qLower[j]);
       const V2D lr(dE_jp1, lrQ);
-      const V2D ur(dE_jp1, m_EmodeProperties.q(dE_jp1, thetaUpper, det));
-      const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
+      const V2D ur(dE_jp1, qUpper[j + 1]);
+      const V2D ul(dE_j, qUpper[j]);
       if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
         logStream << "Spectrum=" << specNo
                   << ", lower theta=" << thetaLower * rad2deg
@@ -436,21 +462,29 @@ void SofQWNormalisedPolygon::exec() {
       }
 
       using FractionalRebinning::rebinToFractionalOutput;
-      rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j,
-                              *outputWS, m_Qout);
+      if (buffers.empty())
+        rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j,
+                                *outputWS, m_Qout);
+      else
+        rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j,
+                                buffers[PARALLEL_THREAD_NUMBER], m_Qout);
 
       // Find which q bin this point lies in
       const MantidVec::difference_type qIndex =
           std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) - m_Qout.begin();
       if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
         // Add this spectra-detector pair to the mapping
-        PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
-          // Could do a more complete merge of spectrum definitions here, but
-          // historically only the ID of the first detector in the spectrum is
-          // used, so I am keeping that for now.
-          detIDMapping[qIndex - 1].add(
-              spectrumInfo.spectrumDefinition(i)[0].first);
-        }
+        mappedQIndices.emplace_back(qIndex - 1);
+      }
+    }
+    if (!mappedQIndices.empty()) {
+      const auto detID = spectrumInfo.spectrumDefinition(i)[0].first;
+      PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
+        // Could do a more complete merge of spectrum definitions here, but
+        // historically only the ID of the first detector in the spectrum is
+        // used, so I am keeping that for now.
+        for (const auto qIndex : mappedQIndices)
+          detIDMapping[qIndex].add(detID);
       }
     }
     if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
@@ -461,6 +495,9 @@ void SofQWNormalisedPolygon::exec() {
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  for (const auto &buffer : buffers)
+    buffer.addTo(*outputWS);
+
   FractionalRebinning::finalizeFractionalRebin(*outputWS);
   outputWS->finalize();
   FractionalRebinning::normaliseOutput(outputWS, inputWS, m_progress.get());
@@ -7,6 +7,7 @@
 #include "MantidAlgorithms/SofQWPolygon.h"
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAPI/SpectrumDetectorMapping.h"
+#include "MantidAPI/SpectrumGeometryTable.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAlgorithms/ReplaceSpecialValues.h"
 #include "MantidAlgorithms/SofQW.h"
@@ -18,6 +19,8 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
+#include <cmath>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -168,10 +171,12 @@ void SofQWPolygon::initThetaCache(const API::MatrixWorkspace &workspace) {
   double minTheta(DBL_MAX), maxTheta(-DBL_MAX);
 
   const auto &spectrumInfo = workspace.spectrumInfo();
+  const auto &geometry = workspace.spectrumGeometryTable();
+  const auto &twoTheta = geometry.twoTheta();
   for (int64_t i = 0; i < static_cast<int64_t>(nhist); ++i) {
     m_progress->report("Calculating detector angles");
     m_thetaPts[i] = -1.0; // Indicates a detector to skip
-    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i))
+    if (!geometry.hasDetectors(i) || geometry.isMonitor(i))
       continue;
     // Check to see if there is an EFixed, if not skip it
     try {
@@ -179,8 +184,10 @@ void SofQWPolygon::initThetaCache(const API::MatrixWorkspace &workspace) {
     } catch (std::runtime_error &) {
       continue;
     }
+    const double theta = twoTheta[i];
+    if (std::isnan(theta))
+      continue;
     ++ndets;
-    const double theta = spectrumInfo.twoTheta(i);
     m_thetaPts[i] = theta;
     minTheta = std::min(minTheta, theta);
     maxTheta = std::max(maxTheta, theta);
@@ -7,6 +7,8 @@
 #include "MantidAlgorithms/SpatialGrouping.h"
 
 #include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/DetectorSpatialIndex.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
 
 #include "MantidAPI/FileProperty.h"
@@ -19,6 +21,8 @@
 
 #include "MantidAPI/ISpectrum.h"
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace {
 /*
@@ -87,9 +91,18 @@ void SpatialGrouping::exec() {
 
   Mantid::API::Progress prog(this, 0.0, 1.0, m_positions.size());
 
-  bool ignoreMaskedDetectors = false;
-  m_neighbourInfo = std::make_unique<API::WorkspaceNearestNeighbourInfo>(
-      *inputWorkspace, ignoreMaskedDetectors);
+  // If every spectrum has a single detector, search the cached spatial index
+  // of the instrument. Otherwise expand the nearest neighbour graph of the
+  // spectra.
+  const auto workspaceIndices =
+      inputWorkspace->getDetectorIndexToWorkspaceIndexVector();
+  if (workspaceIndices.empty()) {
+    bool ignoreMaskedDetectors = false;
+    m_neighbourInfo = std::make_unique<API::WorkspaceNearestNeighbourInfo>(
+        *inputWorkspace, ignoreMaskedDetectors);
+  } else {
+    m_neighbourInfo.reset();
+  }
 
   for (size_t i = 0; i < inputWorkspace->getNumberHistograms(); ++i) {
     prog.report();
@@ -119,9 +132,14 @@ void SpatialGrouping::exec() {
 
     createBox(spectrumInfo.detector(i), bbox, searchDist);
 
-    bool extend = true;
-    while ((nNeighbours > nearest.size()) && extend) {
-      extend = expandNet(nearest, specNo, nNeighbours, bbox);
+    if (m_neighbourInfo) {
+      bool extend = true;
+      while ((nNeighbours > nearest.size()) && extend) {
+        extend = expandNet(nearest, specNo, nNeighbours, bbox);
+      }
+    } else {
+      nearest = nearestInBox(*inputWorkspace, workspaceIndices, i, nNeighbours,
+                             bbox);
     }
 
     if (nearest.size() != nNeighbours)
@@ -270,6 +288,53 @@ bool SpatialGrouping::expandNet(
   return true;
 }
 
+/**
+ * Finds the detectors closest to the detector of a spectrum within the search
+ * region using the spatial index of the instrument. Detectors already included
+ * in a group are skipped.
+ * @param workspace :: the input workspace
+ * @param workspaceIndices :: the workspace index of each detector
+ * @param workspaceIndex :: the workspace index of the central spectrum
+ * @param noNeighbours :: number of neighbours that should be found
+ * @param bbox :: BoundingBox object representing the search region
+ * @return up to noNeighbours spectrum numbers and their offsets from the
+ * central detector
+ */
+std::map<specnum_t, Mantid::Kernel::V3D> SpatialGrouping::nearestInBox(
+    const API::MatrixWorkspace &workspace,
+    const std::vector<size_t> &workspaceIndices, const size_t workspaceIndex,
+    const size_t noNeighbours, const Mantid::Geometry::BoundingBox &bbox) {
+  const auto &detectorInfo = workspace.detectorInfo();
+  const auto center = detectorInfo.indexOf(
+      *workspace.getSpectrum(workspaceIndex).getDetectorIDs().begin());
+  const auto centerPos = detectorInfo.position(center);
+  // The sphere around the detector that contains the whole search region
+  double radiusSq = 0.0;
+  for (size_t axis = 0; axis < 3; ++axis) {
+    const double extent =
+        std::max(std::abs(bbox.maxPoint()[axis] - centerPos[axis]),
+                 std::abs(bbox.minPoint()[axis] - centerPos[axis]));
+    radiusSq += extent * extent;
+  }
+
+  std::map<specnum_t, Mantid::Kernel::V3D> nearest;
+  const auto candidates =
+      detectorInfo.spatialIndex().inRadius(centerPos, std::sqrt(radiusSq));
+  for (const auto &candidate : candidates) {
+    if (nearest.size() == noNeighbours)
+      break;
+    const auto neighbourIndex = workspaceIndices[candidate.first];
+    if (candidate.first == center ||
+        neighbourIndex == std::numeric_limits<size_t>::max())
+      continue;
+    const auto specNo = workspace.getSpectrum(neighbourIndex).getSpectrumNo();
+    const auto &pos = detectorInfo.position(candidate.first);
+    if (m_included.count(specNo) == 0 && bbox.isPointInside(pos))
+      nearest[specNo] = pos - centerPos;
+  }
+  return nearest;
+}
+
 /**
  * This method will trim the result set down to the specified number required by
  * sorting
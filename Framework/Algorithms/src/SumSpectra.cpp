@@ -12,13 +12,19 @@
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/RebinnedOutput.h"
+#include "MantidDataObjects/Workspace2D.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/IDetector.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidParallel/Collectives.h"
+#include "MantidParallel/Communicator.h"
 
+#include <algorithm>
 #include <functional>
+#include <set>
 
 namespace Mantid {
 namespace Algorithms {
@@ -107,6 +113,43 @@ void validateWorkspaceName(std::map<std::string, std::string> &validationOutput,
     ++index;
   }
 }
+
+/**
+ * Check that the parts of a distributed workspace on all MPI ranks can be
+ * summed. The check is collective so that either all ranks or none of them
+ * take part in the reduction of the partial sums.
+ * @param comm The communicator of the algorithm
+ * @param validationOutput Output map to be populated with any errors
+ * @param ws The part of the input workspace on this rank
+ */
+void validateDistributedWorkspace(
+    const Parallel::Communicator &comm,
+    std::map<std::string, std::string> &validationOutput,
+    const MatrixWorkspace &ws) {
+  const int supported =
+      ws.id() == "Workspace2D" || ws.id() == "EventWorkspace" ? 1 : 0;
+  // Ranks without any spectra do not constrain the number of bins
+  const int numBins =
+      ws.getNumberHistograms() > 0 ? static_cast<int>(ws.y(0).size()) : -1;
+  std::vector<int> allSupported(comm.size());
+  Parallel::all_gather(comm, supported, allSupported);
+  std::vector<int> allNumBins(comm.size());
+  Parallel::all_gather(comm, numBins, allNumBins);
+
+  if (std::find(allSupported.cbegin(), allSupported.cend(), 0) !=
+      allSupported.cend()) {
+    validationOutput["InputWorkspace"] =
+        "Distributed execution is only supported for Workspace2D and "
+        "EventWorkspace inputs.";
+    return;
+  }
+  allNumBins.erase(std::remove(allNumBins.begin(), allNumBins.end(), -1),
+                   allNumBins.end());
+  if (std::adjacent_find(allNumBins.cbegin(), allNumBins.cend(),
+                         std::not_equal_to<int>()) != allNumBins.cend())
+    validationOutput["InputWorkspace"] =
+        "The spectra on all MPI ranks must have the same number of bins.";
+}
 } // namespace
 
 /** Initialisation method.
@@ -193,6 +236,14 @@ std::map<std::string, std::string> SumSpectra::validateInputs() {
   } else {
     const std::vector<int> indices = getProperty("ListOfWorkspaceIndices");
     if (MatrixWorkspace_const_sptr singleWs = getProperty("InputWorkspace")) {
+      // Indices of distributed workspaces are local to each rank, a custom
+      // range is rejected by getParallelExecutionMode()
+      if (singleWs->storageMode() == Parallel::StorageMode::Distributed &&
+          communicator().size() > 1) {
+        validateDistributedWorkspace(communicator(), validationOutput,
+                                     *singleWs);
+        return validationOutput;
+      }
       validateSingleMatrixWorkspace(validationOutput, *singleWs, minIndex,
                                     maxIndex, indices);
     } else {
@@ -238,11 +289,13 @@ void SumSpectra::exec() {
   Progress progress(this, 0.0, 1.0, m_indices.size());
   EventWorkspace_const_sptr eventW =
       std::dynamic_pointer_cast<const EventWorkspace>(localworkspace);
-  if (eventW) {
-    if (m_calculateWeightedSum) {
-      g_log.warning("Ignoring request for WeightedSum");
-      m_calculateWeightedSum = false;
-    }
+  if (eventW && m_calculateWeightedSum) {
+    g_log.warning("Ignoring request for WeightedSum");
+    m_calculateWeightedSum = false;
+  }
+  // Distributed event lists are histogrammed locally, only the partial sums
+  // of the histograms are sent to rank 0
+  if (eventW && !m_distributed) {
     outputWorkspace = create<EventWorkspace>(*eventW, 1, eventW->binEdges(0));
 
     execEvent(outputWorkspace, progress, numSpectra, numMasked, numZeros);
@@ -250,9 +303,22 @@ void SumSpectra::exec() {
     //-------Workspace 2D mode -----
 
     // Create the 2D workspace for the output
-    outputWorkspace = API::WorkspaceFactory::Instance().create(
-        localworkspace, 1, localworkspace->x(*(m_indices.begin())).size(),
-        m_yLength);
+    if (m_distributed) {
+      // On all but rank 0 this is a temporary workspace
+      Indexing::IndexInfo indexInfo(1,
+                                    communicator().rank() == 0
+                                        ? Parallel::StorageMode::MasterOnly
+                                        : Parallel::StorageMode::Cloned,
+                                    communicator());
+      indexInfo.setSpectrumDefinitions(std::vector<SpectrumDefinition>(1));
+      outputWorkspace = create<Workspace2D>(
+          *localworkspace, indexInfo,
+          localworkspace->histogram(*(m_indices.begin())));
+    } else {
+      outputWorkspace = API::WorkspaceFactory::Instance().create(
+          localworkspace, 1, localworkspace->x(*(m_indices.begin())).size(),
+          m_yLength);
+    }
 
     // This is the (only) output spectrum
     auto &outSpec = outputWorkspace->getSpectrum(0);
@@ -290,7 +356,8 @@ void SumSpectra::exec() {
                                             true);
 
   // Assign it to the output workspace property
-  setProperty("OutputWorkspace", outputWorkspace);
+  if (!m_distributed || communicator().rank() == 0)
+    setProperty("OutputWorkspace", outputWorkspace);
 }
 
 void SumSpectra::determineIndices(const size_t numberOfSpectra) {
@@ -371,6 +438,100 @@ API::MatrixWorkspace_sptr SumSpectra::replaceSpecialValues() {
 }
 
 namespace { // anonymous namespace
+/// Sums over a block of the spectra
+struct PartialSum {
+  std::vector<double> y;
+  std::vector<double> e;
+  std::vector<double> weight;
+  std::vector<size_t> nZeros;
+  std::set<detid_t> detectorIDs;
+
+  /// Add another partial sum to this one and release its memory
+  PartialSum &operator+=(PartialSum &other) {
+    std::transform(y.begin(), y.end(), other.y.begin(), y.begin(),
+                   std::plus<double>());
+    std::transform(e.begin(), e.end(), other.e.begin(), e.begin(),
+                   std::plus<double>());
+    std::transform(weight.begin(), weight.end(), other.weight.begin(),
+                   weight.begin(), std::plus<double>());
+    std::transform(nZeros.begin(), nZeros.end(), other.nZeros.begin(),
+                   nZeros.begin(), std::plus<size_t>());
+    detectorIDs.insert(other.detectorIDs.cbegin(), other.detectorIDs.cend());
+    other = PartialSum();
+    return *this;
+  }
+};
+
+/**
+ * Add the partial sums of all MPI ranks on rank 0. Ranks without any spectra
+ * pass an empty partial sum.
+ * @param comm The communicator of the algorithm
+ * @param sum The local sum, holds the total sum on rank 0 on return
+ * @param numSpectra The number of summed spectra, total on rank 0 on return
+ * @param numMasked The number of masked spectra, total on rank 0 on return
+ * @param specNum The output spectrum number, minimum on rank 0 on return
+ */
+void reduceOnRoot(const Parallel::Communicator &comm, PartialSum &sum,
+                  size_t &numSpectra, size_t &numMasked, specnum_t &specNum) {
+  const int tag = 0;
+  if (comm.rank() != 0) {
+    const auto size = static_cast<int>(sum.y.size());
+    comm.send(0, tag, size);
+    if (size > 0) {
+      comm.send(0, tag, sum.y.data(), size);
+      comm.send(0, tag, sum.e.data(), size);
+      if (!sum.weight.empty()) {
+        comm.send(0, tag, sum.weight.data(), size);
+        comm.send(0, tag, sum.nZeros.data(), size);
+      }
+      comm.send(0, tag, specNum);
+    }
+    comm.send(0, tag, numSpectra);
+    comm.send(0, tag, numMasked);
+    const std::vector<detid_t> detIds(sum.detectorIDs.cbegin(),
+                                      sum.detectorIDs.cend());
+    const auto nDets = static_cast<int>(detIds.size());
+    comm.send(0, tag, nDets);
+    if (nDets > 0)
+      comm.send(0, tag, detIds.data(), nDets);
+    return;
+  }
+
+  for (int rank = 1; rank < comm.size(); ++rank) {
+    int size;
+    comm.recv(rank, tag, size);
+    if (size > 0) {
+      PartialSum other;
+      other.y.resize(size);
+      other.e.resize(size);
+      comm.recv(rank, tag, other.y.data(), size);
+      comm.recv(rank, tag, other.e.data(), size);
+      if (!sum.weight.empty()) {
+        other.weight.resize(size);
+        other.nZeros.resize(size);
+        comm.recv(rank, tag, other.weight.data(), size);
+        comm.recv(rank, tag, other.nZeros.data(), size);
+      }
+      sum += other;
+      specnum_t otherSpecNum;
+      comm.recv(rank, tag, otherSpecNum);
+      specNum = std::min(specNum, otherSpecNum);
+    }
+    size_t count;
+    comm.recv(rank, tag, count);
+    numSpectra += count;
+    comm.recv(rank, tag, count);
+    numMasked += count;
+    int nDets;
+    comm.recv(rank, tag, nDets);
+    if (nDets > 0) {
+      std::vector<detid_t> detIds(nDets);
+      comm.recv(rank, tag, detIds.data(), nDets);
+      sum.detectorIDs.insert(detIds.cbegin(), detIds.cend());
+    }
+  }
+}
+
 // small function that normalizes the accumulated weight in a consistent fashion
 // the weights are modified in the process
 size_t applyWeight(const size_t numSpectra, HistogramData::HistogramY &y,
@@ -446,51 +607,89 @@ void SumSpectra::doSimpleSum(const MatrixWorkspace_sptr &outputWorkspace,
   auto &YSum = outSpec.mutableY();
   auto &YErrorSum = outSpec.mutableE();
 
-  std::vector<double> Weight;
-  std::vector<size_t> nZeros;
-  if (m_calculateWeightedSum) {
-    Weight.assign(YSum.size(), 0.);
-    nZeros.assign(YSum.size(), 0);
-  }
-
   const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
+  std::vector<size_t> indices;
+  indices.reserve(m_indices.size());
   for (const auto wsIndex : m_indices) {
-    if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
-      continue;
-    numSpectra++;
-
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-
+    if (useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
+      indices.emplace_back(wsIndex);
+  }
+  numSpectra += indices.size();
+
+  // Each thread sums a block of the spectra, the partial sums are then added
+  // pairwise
+  const size_t nBlocks = std::max(
+      size_t{1}, std::min(static_cast<size_t>(PARALLEL_GET_MAX_THREADS),
+                          indices.size()));
+  std::vector<PartialSum> partials(nBlocks);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*localworkspace))
+  for (int block = 0; block < static_cast<int>(nBlocks); ++block) {
+    PARALLEL_START_INTERUPT_REGION
+    auto &partial = partials[block];
+    partial.y.assign(m_yLength, 0.);
+    partial.e.assign(m_yLength, 0.);
     if (m_calculateWeightedSum) {
-      // Retrieve the spectrum into a vector
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq = yErrorsVal * yErrorsVal;
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] / errsq;
-        } else {
-          nZeros[yIndex]++;
+      partial.weight.assign(m_yLength, 0.);
+      partial.nZeros.assign(m_yLength, 0);
+    }
+    const size_t blockStart = indices.size() * block / nBlocks;
+    const size_t blockEnd = indices.size() * (block + 1) / nBlocks;
+    for (size_t i = blockStart; i < blockEnd; ++i) {
+      const size_t wsIndex = indices[i];
+      const auto &YValues = localworkspace->y(wsIndex);
+      const auto &YErrors = localworkspace->e(wsIndex);
+
+      if (m_calculateWeightedSum) {
+        // Retrieve the spectrum into a vector
+        for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
+          const double yErrorsVal = YErrors[yIndex];
+          if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
+            const double errsq = yErrorsVal * yErrorsVal;
+            partial.e[yIndex] += errsq;
+            partial.weight[yIndex] += 1. / errsq;
+            partial.y[yIndex] += YValues[yIndex] / errsq;
+          } else {
+            partial.nZeros[yIndex]++;
+          }
         }
+      } else {
+        std::transform(partial.y.begin(), partial.y.end(), YValues.begin(),
+                       partial.y.begin(), std::plus<double>());
+        std::transform(partial.e.begin(), partial.e.end(), YErrors.begin(),
+                       partial.e.begin(),
+                       [](const double accum, const double yerrorSpec) {
+                         return accum + yerrorSpec * yerrorSpec;
+                       });
       }
-    } else {
-      YSum += YValues;
-      std::transform(YErrorSum.begin(), YErrorSum.end(), YErrors.begin(),
-                     YErrorSum.begin(),
-                     [](const double accum, const double yerrorSpec) {
-                       return accum + yerrorSpec * yerrorSpec;
-                     });
-    }
 
-    // Map all the detectors onto the spectrum of the output
-    outSpec.addDetectorIDs(
-        localworkspace->getSpectrum(wsIndex).getDetectorIDs());
+      // Map all the detectors onto the spectrum of the output
+      const auto &detectorIDs =
+          localworkspace->getSpectrum(wsIndex).getDetectorIDs();
+      partial.detectorIDs.insert(detectorIDs.cbegin(), detectorIDs.cend());
 
-    progress.report();
+      progress.report();
+    }
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  for (size_t stride = 1; stride < nBlocks; stride *= 2) {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int block = 0; block < static_cast<int>(nBlocks - stride);
+         block += static_cast<int>(2 * stride)) {
+      partials[block] += partials[block + stride];
+    }
+  }
+  auto &sum = partials.front();
+  if (m_distributed) {
+    reduceOnRoot(communicator(), sum, numSpectra, numMasked, m_outSpecNum);
+    outSpec.setSpectrumNo(m_outSpecNum);
   }
+  std::copy(sum.y.cbegin(), sum.y.cend(), YSum.begin());
+  std::copy(sum.e.cbegin(), sum.e.cend(), YErrorSum.begin());
+  outSpec.addDetectorIDs(sum.detectorIDs);
+  std::vector<double> Weight(sum.weight);
+  const std::vector<size_t> &nZeros = sum.nZeros;
 
   if (m_calculateWeightedSum) {
     numZeros =
@@ -623,6 +822,8 @@ void SumSpectra::execEvent(const MatrixWorkspace_sptr &outputWorkspace,
   outputEL.clearDetectorIDs();
 
   const auto &spectrumInfo = inputWorkspace->spectrumInfo();
+  std::vector<size_t> runStarts;
+  bool allSorted = true;
   // Loop over spectra
   for (const auto i : m_indices) {
     if (spectrumInfo.hasDetectors(i)) {
@@ -641,11 +842,49 @@ void SumSpectra::execEvent(const MatrixWorkspace_sptr &outputWorkspace,
     const EventList &inputEL = inputWorkspace->getSpectrum(i);
     if (inputEL.empty()) {
       ++numZeros;
+    } else {
+      allSorted = allSorted && inputEL.isSortedByTof();
     }
+    runStarts.emplace_back(outputEL.getNumberEvents());
     outputEL += inputEL;
 
     progress.report();
   }
+  // Merging the sorted spectra is cheaper than sorting the sum later
+  if (allSorted)
+    outputEL.sortTofFromRuns(runStarts);
+}
+
+/** Sums the spectra of a workspace distributed over the MPI ranks. The
+ * partial sums of all ranks are added on rank 0, which is the only rank that
+ * holds the output workspace.
+ */
+void SumSpectra::execDistributed() {
+  MatrixWorkspace_const_sptr localworkspace = getProperty("InputWorkspace");
+  m_distributed = true;
+  if (localworkspace->getNumberHistograms() > 0) {
+    exec();
+    return;
+  }
+  // Rank 0 always has spectra, this rank only takes part in the reduction
+  PartialSum sum;
+  size_t numSpectra(0);
+  size_t numMasked(0);
+  reduceOnRoot(communicator(), sum, numSpectra, numMasked, m_outSpecNum);
+}
+
+Parallel::ExecutionMode SumSpectra::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  using namespace Parallel;
+  if (storageModes.at("InputWorkspace") != StorageMode::Distributed)
+    return ParallelAlgorithm::getParallelExecutionMode(storageModes);
+  if (!getPointerToProperty("StartWorkspaceIndex")->isDefault() ||
+      !getPointerToProperty("EndWorkspaceIndex")->isDefault() ||
+      !getPointerToProperty("ListOfWorkspaceIndices")->isDefault())
+    throw std::runtime_error("Summing a range of workspace indices in an MPI "
+                             "run of " +
+                             name() + " is currently not supported.");
+  return ExecutionMode::Distributed;
 }
 
 } // namespace Algorithms
@@ -0,0 +1,309 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/WorkspaceExpression.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace Mantid {
+namespace Algorithms {
+
+/// A node of the expression tree
+struct WorkspaceExpression::Node {
+  enum class Type { Workspace, Constant, Plus, Minus, Multiply, Divide, Power };
+  Type type;
+  /// The operand of a Workspace node
+  API::MatrixWorkspace_const_sptr workspace;
+  /// The value of a Constant node or the exponent of a Power node
+  double value{0.0};
+  /// The error of a Constant node
+  double error{0.0};
+  /// The operands of binary nodes, lhs is the base of a Power node
+  std::shared_ptr<const Node> lhs;
+  std::shared_ptr<const Node> rhs;
+};
+
+namespace {
+using Node = WorkspaceExpression::Node;
+
+/// Append the workspace operands of the tree below node to workspaces
+void collectWorkspaces(const Node &node,
+                       std::vector<const API::MatrixWorkspace *> &workspaces) {
+  if (node.type == Node::Type::Workspace) {
+    workspaces.emplace_back(node.workspace.get());
+    return;
+  }
+  if (node.lhs)
+    collectWorkspaces(*node.lhs, workspaces);
+  if (node.rhs)
+    collectWorkspaces(*node.rhs, workspaces);
+}
+
+/// Returns the number of binary operations nested below node
+size_t binaryDepth(const Node &node) {
+  const size_t lhsDepth = node.lhs ? binaryDepth(*node.lhs) : 0;
+  if (!node.rhs)
+    return lhsDepth;
+  return std::max(lhsDepth, binaryDepth(*node.rhs) + 1);
+}
+
+/** Evaluates the expression for one spectrum at a time. The right-hand
+ * operands of binary operations are evaluated into buffers, one for each
+ * level of nesting, which are reused between spectra so the evaluation of a
+ * spectrum does not allocate.
+ */
+class SpectrumEvaluator {
+public:
+  SpectrumEvaluator(const size_t numberBins, const size_t depth)
+      : m_numberBins(numberBins),
+        m_scratch(depth, std::vector<double>(2 * numberBins)) {}
+
+  void evaluate(const Node &node, const size_t index, double *y, double *e) {
+    evaluate(node, index, y, e, 0);
+  }
+
+private:
+  void evaluate(const Node &node, const size_t index, double *y, double *e,
+                const size_t depth) {
+    switch (node.type) {
+    case Node::Type::Workspace:
+      copyOperand(*node.workspace, index, y, e);
+      return;
+    case Node::Type::Constant:
+      std::fill(y, y + m_numberBins, node.value);
+      std::fill(e, e + m_numberBins, node.error);
+      return;
+    case Node::Type::Power:
+      evaluate(*node.lhs, index, y, e, depth);
+      power(node.value, y, e);
+      return;
+    default:
+      break;
+    }
+    evaluate(*node.lhs, index, y, e, depth);
+    double *rhsY = m_scratch[depth].data();
+    double *rhsE = rhsY + m_numberBins;
+    evaluate(*node.rhs, index, rhsY, rhsE, depth + 1);
+    switch (node.type) {
+    case Node::Type::Plus:
+      for (size_t j = 0; j < m_numberBins; ++j) {
+        y[j] += rhsY[j];
+        e[j] = std::sqrt(e[j] * e[j] + rhsE[j] * rhsE[j]);
+      }
+      break;
+    case Node::Type::Minus:
+      for (size_t j = 0; j < m_numberBins; ++j) {
+        y[j] -= rhsY[j];
+        e[j] = std::sqrt(e[j] * e[j] + rhsE[j] * rhsE[j]);
+      }
+      break;
+    case Node::Type::Multiply:
+      for (size_t j = 0; j < m_numberBins; ++j) {
+        const double lhsTerm = e[j] * rhsY[j];
+        const double rhsTerm = rhsE[j] * y[j];
+        e[j] = std::sqrt(lhsTerm * lhsTerm + rhsTerm * rhsTerm);
+        y[j] *= rhsY[j];
+      }
+      break;
+    case Node::Type::Divide:
+      // See Divide::performBinaryOperation for the form of the error
+      for (size_t j = 0; j < m_numberBins; ++j) {
+        const double rhsTerm = y[j] * rhsE[j] / rhsY[j];
+        e[j] = std::sqrt(e[j] * e[j] + rhsTerm * rhsTerm) / std::fabs(rhsY[j]);
+        y[j] /= rhsY[j];
+      }
+      break;
+    default:
+      throw std::logic_error("WorkspaceExpression: unknown operation");
+    }
+  }
+
+  /// Copy the data of an operand, broadcasting single spectra and values
+  void copyOperand(const API::MatrixWorkspace &ws, const size_t index,
+                   double *y, double *e) const {
+    const size_t wsIndex = ws.getNumberHistograms() == 1 ? 0 : index;
+    const auto &wsY = ws.y(wsIndex);
+    const auto &wsE = ws.e(wsIndex);
+    if (wsY.size() == 1) {
+      std::fill(y, y + m_numberBins, wsY[0]);
+      std::fill(e, e + m_numberBins, wsE[0]);
+    } else {
+      std::copy(wsY.cbegin(), wsY.cend(), y);
+      std::copy(wsE.cbegin(), wsE.cend(), e);
+    }
+  }
+
+  /// Raise y to exponent, see Power::performUnaryOperation for the error
+  void power(const double exponent, double *y, double *e) const {
+    for (size_t j = 0; j < m_numberBins; ++j) {
+      const double result = std::pow(y[j], exponent);
+      e[j] = std::fabs(exponent * result * (e[j] / y[j]));
+      y[j] = result;
+    }
+  }
+
+  const size_t m_numberBins;
+  std::vector<std::vector<double>> m_scratch;
+};
+
+std::shared_ptr<const Node> binaryNode(const Node::Type type,
+                                       std::shared_ptr<const Node> lhs,
+                                       std::shared_ptr<const Node> rhs) {
+  auto node = std::make_shared<Node>();
+  node->type = type;
+  node->lhs = std::move(lhs);
+  node->rhs = std::move(rhs);
+  return node;
+}
+} // namespace
+
+/// Constructs an expression consisting of a single workspace
+WorkspaceExpression::WorkspaceExpression(
+    API::MatrixWorkspace_const_sptr workspace) {
+  if (!workspace)
+    throw std::invalid_argument("WorkspaceExpression: null workspace");
+  auto node = std::make_shared<Node>();
+  node->type = Node::Type::Workspace;
+  node->workspace = std::move(workspace);
+  m_node = std::move(node);
+}
+
+/// Constructs an expression consisting of a single workspace
+WorkspaceExpression::WorkspaceExpression(
+    const API::MatrixWorkspace_sptr &workspace)
+    : WorkspaceExpression(API::MatrixWorkspace_const_sptr(workspace)) {}
+
+/// Constructs an expression consisting of a single value with an error
+WorkspaceExpression::WorkspaceExpression(const double value,
+                                         const double error) {
+  auto node = std::make_shared<Node>();
+  node->type = Node::Type::Constant;
+  node->value = value;
+  node->error = error;
+  m_node = std::move(node);
+}
+
+WorkspaceExpression::WorkspaceExpression(std::shared_ptr<const Node> node)
+    : m_node(std::move(node)) {}
+
+/** Compute the value of the expression.
+ * @return a new Workspace2D holding the result
+ * @throws std::invalid_argument if the expression contains no workspace or
+ * the workspace operands are not compatible
+ */
+API::MatrixWorkspace_sptr WorkspaceExpression::evaluate() const {
+  std::vector<const API::MatrixWorkspace *> workspaces;
+  collectWorkspaces(*m_node, workspaces);
+  if (workspaces.empty())
+    throw std::invalid_argument(
+        "WorkspaceExpression: the expression contains no workspace");
+
+  // The largest operand defines the shape and the metadata of the result
+  const auto *reference = *std::max_element(
+      workspaces.cbegin(), workspaces.cend(), [](const auto *a, const auto *b) {
+        return a->getNumberHistograms() * a->blocksize() <
+               b->getNumberHistograms() * b->blocksize();
+      });
+  const auto numberHistograms = reference->getNumberHistograms();
+  const auto numberBins = reference->blocksize();
+  // Operands whose spectra mask the spectra of the result. As in
+  // BinaryOperation, single spectrum and single value operands do not.
+  std::vector<const API::SpectrumInfo *> maskingInfos;
+  bool threadSafe = true;
+  for (const auto *ws : workspaces) {
+    threadSafe = threadSafe && ws->threadSafe();
+    const bool singleValue = ws->getNumberHistograms() == 1 &&
+                             ws->blocksize() == 1 && numberBins != 1;
+    if (singleValue)
+      continue;
+    if (ws->blocksize() != numberBins ||
+        (ws->getNumberHistograms() != numberHistograms &&
+         ws->getNumberHistograms() != 1))
+      throw std::invalid_argument(
+          "WorkspaceExpression: the sizes of workspace operands '" +
+          ws->getName() + "' and '" + reference->getName() + "' differ");
+    if (!API::WorkspaceHelpers::matchingBins(*reference, *ws, true))
+      throw std::invalid_argument(
+          "WorkspaceExpression: the bins of workspace operands '" +
+          ws->getName() + "' and '" + reference->getName() + "' differ");
+    if (ws->getNumberHistograms() == numberHistograms)
+      maskingInfos.emplace_back(&ws->spectrumInfo());
+  }
+
+  API::MatrixWorkspace_sptr out =
+      DataObjects::create<DataObjects::Workspace2D>(*reference);
+  auto &outSpectrumInfo = out->mutableSpectrumInfo();
+  // One evaluator per thread keeps its buffers for all of its spectra
+  std::vector<SpectrumEvaluator> evaluators(
+      PARALLEL_GET_MAX_THREADS,
+      SpectrumEvaluator(numberBins, binaryDepth(*m_node)));
+
+  PARALLEL_FOR_IF(threadSafe)
+  for (int64_t i = 0; i < static_cast<int64_t>(numberHistograms); ++i) {
+    const auto index = static_cast<size_t>(i);
+    const bool masked = std::any_of(
+        maskingInfos.cbegin(), maskingInfos.cend(), [index](const auto *info) {
+          return info->hasDetectors(index) && info->isMasked(index);
+        });
+    if (masked) {
+      out->getSpectrum(index).clearData();
+      PARALLEL_CRITICAL(setMasked) { outSpectrumInfo.setMasked(index, true); }
+      continue;
+    }
+    // Nothing to compute, and &y[0] is invalid for empty spectra
+    if (numberBins == 0)
+      continue;
+    auto &y = out->mutableY(index);
+    auto &e = out->mutableE(index);
+    evaluators[PARALLEL_THREAD_NUMBER].evaluate(*m_node, index, &y[0], &e[0]);
+  }
+  return out;
+}
+
+WorkspaceExpression operator+(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(
+      binaryNode(Node::Type::Plus, lhs.m_node, rhs.m_node));
+}
+
+WorkspaceExpression operator-(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(
+      binaryNode(Node::Type::Minus, lhs.m_node, rhs.m_node));
+}
+
+WorkspaceExpression operator*(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(
+      binaryNode(Node::Type::Multiply, lhs.m_node, rhs.m_node));
+}
+
+WorkspaceExpression operator/(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(
+      binaryNode(Node::Type::Divide, lhs.m_node, rhs.m_node));
+}
+
+WorkspaceExpression pow(const WorkspaceExpression &base,
+                        const double exponent) {
+  auto node = std::make_shared<Node>();
+  node->type = Node::Type::Power;
+  node->value = exponent;
+  node->lhs = base.m_node;
+  return WorkspaceExpression(std::move(node));
+}
+
+} // namespace Algorithms
+} // namespace Mantid
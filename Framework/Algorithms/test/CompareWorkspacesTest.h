@@ -625,6 +625,30 @@ public:
     TS_ASSERT((!Mantid::API::equals(ws1, ws2)));
   }
 
+  void test_difference_in_a_later_block_of_bins() {
+    Workspace2D_sptr ws2 =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(4, 1000);
+    Workspace2D_sptr ws3 = ws2->clone();
+    ws3->mutableY(2)[700] += 0.1;
+    TS_ASSERT(compareWithTolerance(ws2, ws3, 0.2, false))
+    TS_ASSERT(!compareWithTolerance(ws2, ws3, 0.05, false))
+    ws3->mutableE(3)[999] *= 1.1;
+    TS_ASSERT(compareWithTolerance(ws2, ws3, 0.2, true))
+    TS_ASSERT(!compareWithTolerance(ws2, ws3, 0.01, true))
+  }
+
+  void test_relative_tolerance_of_values_near_zero() {
+    Workspace2D_sptr ws2 =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(1, 300);
+    ws2->mutableY(0)[299] = 0.0;
+    Workspace2D_sptr ws3 = ws2->clone();
+    // Values smaller than the tolerance are compared absolutely
+    ws3->mutableY(0)[299] = 0.005;
+    TS_ASSERT(compareWithTolerance(ws2, ws3, 0.01, true))
+    ws3->mutableY(0)[299] = 0.02;
+    TS_ASSERT(!compareWithTolerance(ws2, ws3, 0.01, true))
+  }
+
   void testHistNotHist() {
     if (!checker.isInitialized())
       checker.initialize();
@@ -1405,7 +1429,20 @@ private:
     Mantid::API::AnalysisDataService::Instance().deepRemoveGroup(name);
   }
 
-private:
+  bool compareWithTolerance(const MatrixWorkspace_sptr &lhs,
+                            const MatrixWorkspace_sptr &rhs,
+                            const double tolerance, const bool relative) {
+    CompareWorkspaces alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("Workspace1", lhs);
+    alg.setProperty("Workspace2", rhs);
+    alg.setProperty("Tolerance", tolerance);
+    alg.setProperty("ToleranceRelErr", relative);
+    alg.execute();
+    return alg.getProperty("Result");
+  }
+
   Mantid::Algorithms::CompareWorkspaces checker;
   const Mantid::API::MatrixWorkspace_sptr ws1;
 
@@ -876,6 +876,47 @@ public:
     AnalysisDataService::Instance().remove(wsName);
   }
 
+  void test_FloatWorkspace2D_distribution_in_place() {
+    auto input =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 10);
+    input->getAxis(0)->unit() = UnitFactory::Instance().create("TOF");
+    input->setYUnit("Counts");
+    input->setDistribution(true);
+    const std::string doubleName("ConvertUnitsTest_double");
+    const std::string floatName("ConvertUnitsTest_float");
+    AnalysisDataService::Instance().addOrReplace(doubleName, input);
+    AnalysisDataService::Instance().addOrReplace(
+        floatName, WorkspaceCreationHelper::createFloatWorkspace2D(*input));
+
+    for (const auto &name : {doubleName, floatName}) {
+      ConvertUnits conv;
+      conv.initialize();
+      conv.setRethrows(true);
+      conv.setPropertyValue("InputWorkspace", name);
+      conv.setPropertyValue("OutputWorkspace", name);
+      conv.setPropertyValue("Target", "Wavelength");
+      TS_ASSERT_THROWS_NOTHING(conv.execute())
+    }
+
+    const auto &ads = AnalysisDataService::Instance();
+    const auto expected = ads.retrieveWS<MatrixWorkspace>(doubleName);
+    const auto output = ads.retrieveWS<MatrixWorkspace>(floatName);
+    TS_ASSERT_EQUALS(output->id(), "FloatWorkspace2D")
+    TS_ASSERT_EQUALS(output->getAxis(0)->unit()->unitID(), "Wavelength")
+    TS_ASSERT(output->isDistribution())
+    for (size_t i = 0; i < output->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(output->x(i), expected->x(i))
+      for (size_t j = 0; j < output->blocksize(); ++j) {
+        TS_ASSERT_DELTA(output->y(i)[j], expected->y(i)[j],
+                        1e-6 * expected->y(i)[j])
+        TS_ASSERT_DELTA(output->e(i)[j], expected->e(i)[j],
+                        1e-6 * expected->e(i)[j])
+      }
+    }
+    AnalysisDataService::Instance().remove(floatName);
+    AnalysisDataService::Instance().remove(doubleName);
+  }
+
 private:
   ConvertUnits alg;
   std::string inputSpace;
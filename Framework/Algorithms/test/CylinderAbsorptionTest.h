@@ -12,6 +12,7 @@
 #include "MantidAlgorithms/CylinderAbsorption.h"
 #include "MantidDataHandling/SetSample.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/PropertyManager.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
@@ -290,7 +291,69 @@ public:
     Mantid::API::AnalysisDataService::Instance().remove(outputWS);
   }
 
+  void testRepeatedExecutionReusesPathLengths() {
+    MatrixWorkspace_sptr testWS = createTestWorkspace();
+    const auto first = runWithRadius(testWS, "0.4");
+    // The second run with identical geometry uses the cached path lengths
+    const auto second = runWithRadius(testWS, "0.4");
+    TS_ASSERT_EQUALS(first->readY(0), second->readY(0));
+    TS_ASSERT_DELTA(second->readY(0).front(), 0.7210, 0.0001);
+
+    // A different sample geometry must not pick up the cached values
+    const auto smaller = runWithRadius(testWS, "0.3");
+    TS_ASSERT_DIFFERS(smaller->readY(0).front(), first->readY(0).front());
+
+    auto &config = Mantid::Kernel::ConfigService::Instance();
+    const std::string key("AbsorptionCorrection.PathLengthCacheMB");
+    const auto oldValue = config.getString(key);
+    config.setString(key, "0");
+    const auto uncached = runWithRadius(testWS, "0.3");
+    config.setString(key, oldValue);
+    TS_ASSERT_EQUALS(uncached->readY(0), smaller->readY(0));
+
+    Mantid::Algorithms::AbsorptionCorrection::clearCache();
+    const auto recomputed = runWithRadius(testWS, "0.3");
+    TS_ASSERT_EQUALS(recomputed->readY(0), smaller->readY(0));
+  }
+
+  void testSparseInstrumentMatchesFullCalculation() {
+    MatrixWorkspace_sptr testWS =
+        WorkspaceCreationHelper::create2DWorkspaceWithRectangularInstrument(
+            1, 10, 10);
+    testWS->getAxis(0)->unit() =
+        Mantid::Kernel::UnitFactory::Instance().create("Wavelength");
+    const auto full = runWithRadius(testWS, "0.4");
+
+    Mantid::Algorithms::CylinderAbsorption atten;
+    atten.setChild(true);
+    configureAbsCommon(atten, testWS, "factors");
+    configureAbsSample(atten);
+    atten.setProperty("SparseInstrument", true);
+    atten.setProperty("SparseInstrumentTolerance", 1e-2);
+    TS_ASSERT_THROWS_NOTHING(atten.execute());
+    MatrixWorkspace_sptr sparse = atten.getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(sparse->getNumberHistograms(),
+                     full->getNumberHistograms());
+    for (size_t i = 0; i < full->getNumberHistograms(); ++i) {
+      const auto &expected = full->y(i);
+      const auto &actual = sparse->y(i);
+      for (size_t j = 0; j < expected.size(); ++j)
+        TS_ASSERT_DELTA(actual[j], expected[j], 0.02 * expected[j]);
+    }
+  }
+
 private:
+  MatrixWorkspace_sptr runWithRadius(MatrixWorkspace_sptr &testWS,
+                                     const std::string &radius) {
+    Mantid::Algorithms::CylinderAbsorption atten;
+    atten.setChild(true);
+    configureAbsCommon(atten, testWS, "factors");
+    configureAbsSample(atten);
+    atten.setPropertyValue("CylinderSampleRadius", radius);
+    atten.execute();
+    return atten.getProperty("OutputWorkspace");
+  }
+
   MatrixWorkspace_sptr createTestWorkspace() {
     // Create a small test workspace
     MatrixWorkspace_sptr testWS =
@@ -0,0 +1,115 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidAlgorithms/EvaluateWorkspaceExpression.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+using namespace Mantid::API;
+using Mantid::Algorithms::EvaluateWorkspaceExpression;
+
+class EvaluateWorkspaceExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EvaluateWorkspaceExpressionTest *createSuite() {
+    return new EvaluateWorkspaceExpressionTest();
+  }
+  static void destroySuite(EvaluateWorkspaceExpressionTest *suite) {
+    delete suite;
+  }
+
+  EvaluateWorkspaceExpressionTest() {
+    auto &ads = AnalysisDataService::Instance();
+    m_data = WorkspaceCreationHelper::create2DWorkspace123(3, 4);
+    m_background = WorkspaceCreationHelper::create2DWorkspace154(3, 4);
+    ads.addOrReplace("EvaluateWorkspaceExpressionTest_data", m_data);
+    ads.addOrReplace("EvaluateWorkspaceExpressionTest_bkg", m_background);
+  }
+
+  ~EvaluateWorkspaceExpressionTest() override {
+    auto &ads = AnalysisDataService::Instance();
+    ads.remove("EvaluateWorkspaceExpressionTest_data");
+    ads.remove("EvaluateWorkspaceExpressionTest_bkg");
+  }
+
+  void test_init() {
+    EvaluateWorkspaceExpression alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_matches_binary_operations() {
+    const auto result = run("(EvaluateWorkspaceExpressionTest_data - "
+                            "EvaluateWorkspaceExpressionTest_bkg) * 1.5 / "
+                            "EvaluateWorkspaceExpressionTest_data");
+    const auto expected = (m_data - m_background) * 1.5 / m_data;
+    assertWorkspacesEqual(*result, *expected);
+  }
+
+  void test_power_and_unary_minus() {
+    const auto result = run("-EvaluateWorkspaceExpressionTest_bkg^2 + 1e1");
+    const auto expected = 10.0 - m_background * m_background;
+    TS_ASSERT_EQUALS(result->getNumberHistograms(), 3)
+    for (size_t i = 0; i < 3; ++i)
+      for (size_t j = 0; j < 4; ++j)
+        TS_ASSERT_DELTA(result->y(i)[j], expected->y(i)[j], 1e-12)
+  }
+
+  void test_unknown_workspace_is_rejected() {
+    EvaluateWorkspaceExpression alg;
+    alg.setChild(true);
+    alg.setRethrows(true);
+    alg.initialize();
+    alg.setPropertyValue("Expression",
+                         "EvaluateWorkspaceExpressionTest_data + missing");
+    alg.setPropertyValue("OutputWorkspace", "out");
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &)
+  }
+
+  void test_unsupported_function_is_rejected() {
+    EvaluateWorkspaceExpression alg;
+    alg.setChild(true);
+    alg.setRethrows(true);
+    alg.initialize();
+    alg.setPropertyValue("Expression",
+                         "sin(EvaluateWorkspaceExpressionTest_data)");
+    alg.setPropertyValue("OutputWorkspace", "out");
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &)
+  }
+
+private:
+  MatrixWorkspace_sptr run(const std::string &expression) {
+    EvaluateWorkspaceExpression alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setPropertyValue("Expression", expression);
+    alg.setPropertyValue("OutputWorkspace", "out");
+    TS_ASSERT_THROWS_NOTHING(alg.execute())
+    TS_ASSERT(alg.isExecuted())
+    return alg.getProperty("OutputWorkspace");
+  }
+
+  void assertWorkspacesEqual(const MatrixWorkspace &actual,
+                             const MatrixWorkspace &expected) {
+    TS_ASSERT_EQUALS(actual.getNumberHistograms(),
+                     expected.getNumberHistograms())
+    for (size_t i = 0; i < expected.getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < expected.blocksize(); ++j) {
+        TS_ASSERT_DELTA(actual.y(i)[j], expected.y(i)[j], 1e-12)
+        TS_ASSERT_DELTA(actual.e(i)[j], expected.e(i)[j], 1e-12)
+      }
+    }
+  }
+
+  MatrixWorkspace_sptr m_data;
+  MatrixWorkspace_sptr m_background;
+};
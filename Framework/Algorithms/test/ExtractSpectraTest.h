@@ -128,6 +128,47 @@ public:
     params.testXRange(*ws);
   }
 
+  void test_x_range_shares_x_between_spectra() {
+    Parameters params;
+    params.setXRange();
+
+    auto ws = runAlgorithm(params);
+    if (!ws)
+      return;
+
+    for (size_t i = 1; i < ws->getNumberHistograms(); ++i)
+      TS_ASSERT_EQUALS(ws->sharedX(i), ws->sharedX(0))
+    params.testXRange(*ws);
+  }
+
+  void test_x_range_crops_workspace2d_with_frequencies() {
+    auto input = create<Workspace2D>(
+        2, Histogram(BinEdges{0.0, 1.0, 2.0, 3.0, 4.0},
+                     Frequencies{1.0, 2.0, 3.0, 4.0},
+                     FrequencyStandardDeviations{0.1, 0.2, 0.3, 0.4}));
+    ExtractSpectra alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", std::move(input));
+    alg.setPropertyValue("OutputWorkspace", outWSName);
+    alg.setProperty("XMin", 1.0);
+    alg.setProperty("XMax", 3.0);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr ws = alg.getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), 2);
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      const auto &histogram = ws->histogram(i);
+      TS_ASSERT_EQUALS(histogram.yMode(), Histogram::YMode::Frequencies);
+      TS_ASSERT_EQUALS(histogram.x().rawData(),
+                       (std::vector<double>{1.0, 2.0, 3.0}));
+      TS_ASSERT_EQUALS(histogram.y().rawData(),
+                       (std::vector<double>{2.0, 3.0}));
+      TS_ASSERT_EQUALS(histogram.e().rawData(),
+                       (std::vector<double>{0.2, 0.3}));
+    }
+    TS_ASSERT_EQUALS(ws->sharedX(1), ws->sharedX(0));
+  }
+
   void test_equal_x_range_extracts_single_bin_histogram() {
     Parameters params;
     params.XMin = 3.4;
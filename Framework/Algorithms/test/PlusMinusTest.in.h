@@ -184,6 +184,24 @@ public:
         DO_PLUS ? 4.0 : 0.0,   2.0);
   }
 
+  void test_Float2D_2D()
+  {
+    MatrixWorkspace_sptr work_in1 = WorkspaceCreationHelper::createFloatWorkspace2D(*histWS_5x10_bin);
+    MatrixWorkspace_sptr work_in2 = histWS_5x10_bin;
+    MatrixWorkspace_sptr work_out = performTest(work_in1,work_in2, false /*not inplace*/, false /*not event*/,
+        DO_PLUS ? 4.0 : 0.0,   2.0);
+    TS_ASSERT_EQUALS(work_out->id(), "Workspace2D");
+  }
+
+  void test_Float2D_2D_inplace()
+  {
+    MatrixWorkspace_sptr work_in1 = WorkspaceCreationHelper::createFloatWorkspace2D(*histWS_5x10_bin);
+    MatrixWorkspace_sptr work_in2 = histWS_5x10_bin;
+    MatrixWorkspace_sptr work_out = performTest(work_in1,work_in2, true /*inplace*/, false /*not event*/,
+        DO_PLUS ? 4.0 : 0.0,   2.0);
+    TS_ASSERT_EQUALS(work_out->id(), "FloatWorkspace2D");
+  }
+
   void test_2D_2D_NotHistograms()
   {
     MatrixWorkspace_sptr work_in1 = histWS_5x10_123;
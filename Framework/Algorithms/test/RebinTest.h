@@ -527,6 +527,25 @@ public:
     do_test_FullBinsOnly(params, yExpected, xExpected);
   }
 
+  void test_FloatWorkspace2D_matches_Workspace2D() {
+    MatrixWorkspace_sptr input = Create2DWorkspace(50, 5);
+    MatrixWorkspace_sptr floatInput =
+        WorkspaceCreationHelper::createFloatWorkspace2D(*input);
+    TS_ASSERT_EQUALS(floatInput->id(), "FloatWorkspace2D")
+    const std::string params("1.5,2.0,20,-0.1,30,1.0,35");
+    const auto expected = runRebin(input, params);
+    const auto output = runRebin(floatInput, params);
+    TS_ASSERT_EQUALS(output->id(), "Workspace2D")
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 5)
+    for (size_t i = 0; i < output->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(output->x(i), expected->x(i))
+      for (size_t j = 0; j < output->blocksize(); ++j) {
+        TS_ASSERT_DELTA(output->y(i)[j], expected->y(i)[j], 1e-5)
+        TS_ASSERT_DELTA(output->e(i)[j], expected->e(i)[j], 1e-5)
+      }
+    }
+  }
+
   void test_parallel_cloned() {
     ParallelTestHelpers::runParallel(run_rebin,
                                      "Parallel::StorageMode::Cloned");
@@ -580,6 +599,19 @@ private:
     return retVal;
   }
 
+  MatrixWorkspace_sptr runRebin(const MatrixWorkspace_sptr &input,
+                                const std::string &params) {
+    Rebin rebin;
+    rebin.initialize();
+    rebin.setChild(true);
+    rebin.setRethrows(true);
+    rebin.setProperty("InputWorkspace", input);
+    rebin.setPropertyValue("OutputWorkspace", "unused");
+    rebin.setPropertyValue("Params", params);
+    TS_ASSERT_THROWS_NOTHING(rebin.execute())
+    return rebin.getProperty("OutputWorkspace");
+  }
+
   void maskFirstBins(const std::string &in, const std::string &out,
                      double maskBinsTo) {
     MaskBins mask;
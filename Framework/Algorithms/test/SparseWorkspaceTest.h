@@ -20,6 +20,9 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include <cmath>
+#include <vector>
+
 using namespace Mantid::Algorithms;
 using namespace Mantid::Geometry;
 
@@ -524,4 +527,63 @@ public:
     TS_ASSERT_EQUALS(weights[2], 1 / 0.1 / 0.1)
     TS_ASSERT_EQUALS(weights[3], 1 / 0.4 / 0.4)
   }
+
+  void test_maxInterpolationError_zeroForLinearData() {
+    using namespace WorkspaceCreationHelper;
+    auto ws = create2DWorkspaceWithRectangularInstrument(1, 4, 7);
+    constexpr size_t rows = 4;
+    auto sparseWS = std::make_unique<SparseWorkspace>(*ws, 3, rows, 5);
+    for (size_t i = 0; i < sparseWS->getNumberHistograms(); ++i) {
+      const auto row = static_cast<double>(i % rows);
+      const auto col = static_cast<double>(i / rows);
+      sparseWS->mutableY(i) = 2.0 + row + 0.5 * col;
+    }
+    TS_ASSERT_DELTA(sparseWS->maxInterpolationError(), 0.0, 1e-12)
+  }
+
+  void test_maxInterpolationError_curvedData() {
+    using namespace WorkspaceCreationHelper;
+    auto ws = create2DWorkspaceWithRectangularInstrument(1, 4, 7);
+    constexpr size_t rows = 4;
+    auto sparseWS = std::make_unique<SparseWorkspace>(*ws, 3, rows, 3);
+    for (size_t i = 0; i < sparseWS->getNumberHistograms(); ++i) {
+      const auto row = static_cast<double>(i % rows);
+      sparseWS->mutableY(i) = row * row;
+    }
+    // The deviation from the mean of the neighbours is 1 everywhere, the
+    // maximum value is 9.
+    TS_ASSERT_DELTA(sparseWS->maxInterpolationError(), 0.25 / 9.0, 1e-12)
+  }
+
+  void test_evaluateAdaptively_returnsNullForSmallModels() {
+    using namespace WorkspaceCreationHelper;
+    auto ws = create2DWorkspaceWithRectangularInstrument(1, 4, 7);
+    size_t evaluations = 0;
+    auto sparseWS = SparseWorkspace::evaluateAdaptively(
+        *ws, 3, [&evaluations](SparseWorkspace &) { ++evaluations; }, 1e-3);
+    TS_ASSERT(!sparseWS)
+    TS_ASSERT_EQUALS(evaluations, 0)
+  }
+
+  void test_evaluateAdaptively_refinesUntilTolerance() {
+    using namespace WorkspaceCreationHelper;
+    auto ws = create2DWorkspaceWithRectangularInstrument(1, 20, 7);
+    std::vector<size_t> gridSizes;
+    const auto evaluate = [&gridSizes](SparseWorkspace &sparseWS) {
+      const auto n = sparseWS.getNumberHistograms();
+      const auto rows = static_cast<size_t>(std::lround(std::sqrt(n)));
+      gridSizes.emplace_back(rows);
+      for (size_t i = 0; i < n; ++i) {
+        const auto row = static_cast<double>(i % rows) / (rows - 1);
+        sparseWS.mutableY(i) = 1.0 + row * row;
+      }
+    };
+    auto sparseWS =
+        SparseWorkspace::evaluateAdaptively(*ws, 3, evaluate, 0.005);
+    TS_ASSERT(sparseWS)
+    const std::vector<size_t> expected{5, 9};
+    TS_ASSERT_EQUALS(gridSizes, expected)
+    TS_ASSERT_EQUALS(sparseWS->getNumberHistograms(), 81)
+    TS_ASSERT_LESS_THAN_EQUALS(sparseWS->maxInterpolationError(), 0.005)
+  }
 };
@@ -13,6 +13,7 @@
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
+#include "MantidTypes/SpectrumDefinition.h"
 
 #include <Poco/File.h>
 #include <Poco/Path.h>
@@ -103,4 +104,70 @@ public:
     // delete file
     remove(file.c_str());
   }
+
+  void test_groups_follow_detector_positions_not_workspace_order() {
+    // Spectrum 18 (detector 18) comes first, so it is grouped with the rest
+    // of its bank before spectrum 9 is reached
+    std::vector<Indexing::SpectrumNumber> spectrumNumbers;
+    std::vector<SpectrumDefinition> spectrumDefinitions;
+    for (int i = 17; i >= 0; --i) {
+      spectrumNumbers.emplace_back(i + 1);
+      spectrumDefinitions.emplace_back(i);
+    }
+    Indexing::IndexInfo indexInfo(spectrumNumbers);
+    indexInfo.setSpectrumDefinitions(spectrumDefinitions);
+
+    TS_ASSERT_EQUALS(groups(indexInfo),
+                     (std::vector<std::string>{
+                         "<group name=\"group1\"><detids "
+                         "val=\"18,10,11,12,13,14,15,16,17\"/></group>",
+                         "<group name=\"group2\"><detids "
+                         "val=\"9,1,2,3,4,5,6,7,8\"/></group>"}));
+  }
+
+  void test_detectors_without_spectrum_are_not_grouped() {
+    // Detector 18 has no spectrum, so the second bank lacks a neighbour
+    std::vector<Indexing::SpectrumNumber> spectrumNumbers;
+    std::vector<SpectrumDefinition> spectrumDefinitions;
+    for (int i = 0; i < 17; ++i) {
+      spectrumNumbers.emplace_back(i + 1);
+      spectrumDefinitions.emplace_back(i);
+    }
+    Indexing::IndexInfo indexInfo(spectrumNumbers);
+    indexInfo.setSpectrumDefinitions(spectrumDefinitions);
+
+    TS_ASSERT_EQUALS(groups(indexInfo),
+                     (std::vector<std::string>{
+                         "<group name=\"group1\"><detids "
+                         "val=\"1,2,3,4,5,6,7,8,9\"/></group>"}));
+  }
+
+private:
+  /// Runs the algorithm on two cylindrical banks of 9 detectors each and
+  /// returns the group lines of the grouping file
+  std::vector<std::string> groups(const Indexing::IndexInfo &indexInfo) {
+    auto workspace = DataObjects::create<DataObjects::Workspace2D>(
+        ComponentCreationHelper::createTestInstrumentCylindrical(2),
+        indexInfo, HistogramData::BinEdges(2));
+
+    Algorithms::SpatialGrouping alg;
+    alg.initialize();
+    alg.setProperty<Mantid::API::MatrixWorkspace_sptr>("InputWorkspace",
+                                                       std::move(workspace));
+    alg.setProperty("Filename", "test_SpatialGrouping");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    const std::string file = alg.getProperty("Filename");
+    std::ifstream input(file.c_str());
+    std::vector<std::string> result;
+    std::string line;
+    while (std::getline(input, line)) {
+      if (line.find("<group ") == 0)
+        result.emplace_back(line);
+    }
+    input.close();
+    remove(file.c_str());
+    return result;
+  }
 };
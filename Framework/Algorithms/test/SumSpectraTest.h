@@ -8,9 +8,15 @@
 
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/SpectrumInfo.h"
+#include "MantidAlgorithms/CreateWorkspace.h"
 #include "MantidAlgorithms/SumSpectra.h"
+#include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidIndexing/IndexInfo.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 #include <boost/lexical_cast.hpp>
 #include <cmath>
@@ -21,6 +27,89 @@ using namespace Mantid;
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
 
+namespace {
+void run_sum_distributed(const Parallel::Communicator &comm) {
+  // Spectrum i has counts {i, 1} and errors {1, 1}
+  constexpr int nspec = 10;
+  std::vector<double> dataX, dataY;
+  for (int i = 0; i < nspec; ++i) {
+    dataX.insert(dataX.end(), {0.0, 1.0, 2.0});
+    dataY.insert(dataY.end(), {static_cast<double>(i), 1.0});
+  }
+  auto create = ParallelTestHelpers::create<Algorithms::CreateWorkspace>(comm);
+  create->setProperty<int>("NSpec", nspec);
+  create->setProperty("DataX", dataX);
+  create->setProperty("DataY", dataY);
+  create->setProperty("DataE", std::vector<double>(2 * nspec, 1.0));
+  create->setProperty("ParallelStorageMode",
+                      "Parallel::StorageMode::Distributed");
+  create->execute();
+  MatrixWorkspace_sptr ws = create->getProperty("OutputWorkspace");
+
+  auto sum = ParallelTestHelpers::create<Algorithms::SumSpectra>(comm);
+  sum->setProperty("InputWorkspace", ws);
+  TS_ASSERT_THROWS_NOTHING(sum->execute());
+  MatrixWorkspace_const_sptr out = sum->getProperty("OutputWorkspace");
+  if (comm.rank() != 0) {
+    TS_ASSERT_EQUALS(out, nullptr);
+    return;
+  }
+  TS_ASSERT_EQUALS(out->getNumberHistograms(), 1);
+  TS_ASSERT_EQUALS(out->y(0)[0], 45.0);
+  TS_ASSERT_EQUALS(out->y(0)[1], 10.0);
+  TS_ASSERT_DELTA(out->e(0)[0], std::sqrt(10.0), 1e-12);
+  TS_ASSERT_EQUALS(out->getSpectrum(0).getSpectrumNo(), 1);
+  TS_ASSERT_EQUALS(out->run().getLogData("NumAllSpectra")->value(), "10");
+}
+
+void run_sum_distributed_events(const Parallel::Communicator &comm) {
+  // Spectrum number s has s - 1 events in the first and 1 in the second bin
+  Indexing::IndexInfo indexInfo(10, Parallel::StorageMode::Distributed, comm);
+  auto ws = create<EventWorkspace>(indexInfo,
+                                   HistogramData::BinEdges{0.0, 1.0, 2.0});
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+    auto &events = ws->getSpectrum(i);
+    const auto specNum =
+        static_cast<int32_t>(ws->indexInfo().spectrumNumber(i));
+    for (int32_t n = 1; n < specNum; ++n)
+      events.addEventQuickly(Types::Event::TofEvent(0.5));
+    events.addEventQuickly(Types::Event::TofEvent(1.5));
+  }
+
+  auto sum = ParallelTestHelpers::create<Algorithms::SumSpectra>(comm);
+  sum->setProperty("InputWorkspace", std::move(ws));
+  TS_ASSERT_THROWS_NOTHING(sum->execute());
+  MatrixWorkspace_const_sptr out = sum->getProperty("OutputWorkspace");
+  if (comm.rank() != 0) {
+    TS_ASSERT_EQUALS(out, nullptr);
+    return;
+  }
+  TS_ASSERT_EQUALS(out->getNumberHistograms(), 1);
+  TS_ASSERT_EQUALS(out->y(0)[0], 45.0);
+  TS_ASSERT_EQUALS(out->y(0)[1], 10.0);
+  TS_ASSERT_DELTA(out->e(0)[0], std::sqrt(45.0), 1e-12);
+  TS_ASSERT_DELTA(out->e(0)[1], std::sqrt(10.0), 1e-12);
+  TS_ASSERT_EQUALS(out->getSpectrum(0).getSpectrumNo(), 1);
+  TS_ASSERT_EQUALS(out->run().getLogData("NumAllSpectra")->value(), "10");
+}
+
+void run_sum_distributed_different_bins_fails(
+    const Parallel::Communicator &comm) {
+  Indexing::IndexInfo indexInfo(10, Parallel::StorageMode::Distributed, comm);
+  const size_t numBins = comm.rank() == 0 ? 2 : 3;
+  auto sum = ParallelTestHelpers::create<Algorithms::SumSpectra>(comm);
+  sum->setProperty("InputWorkspace",
+                   create<Workspace2D>(indexInfo,
+                                       HistogramData::BinEdges(numBins + 1)));
+  // All ranks must fail instead of rank 0 waiting for the others
+  if (comm.size() == 1) {
+    TS_ASSERT_THROWS_NOTHING(sum->execute());
+  } else {
+    TS_ASSERT_THROWS(sum->execute(), const std::runtime_error &);
+  }
+}
+} // namespace
+
 class SumSpectraTest : public CxxTest::TestSuite {
 public:
   static SumSpectraTest *createSuite() { return new SumSpectraTest(); }
@@ -691,6 +780,18 @@ public:
     AnalysisDataService::Instance().remove(outWsName);
   }
 
+  void test_parallel_distributed() {
+    ParallelTestHelpers::runParallel(run_sum_distributed);
+  }
+
+  void test_parallel_distributed_events() {
+    ParallelTestHelpers::runParallel(run_sum_distributed_events);
+  }
+
+  void test_parallel_distributed_different_bins_fails() {
+    ParallelTestHelpers::runParallel(run_sum_distributed_different_bins_fails);
+  }
+
 private:
   int nTestHist;
   Mantid::Algorithms::SumSpectra alg; // Test with range limits
@@ -0,0 +1,164 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidAlgorithms/WorkspaceExpression.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <cmath>
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using Mantid::Algorithms::WorkspaceExpression;
+
+class WorkspaceExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static WorkspaceExpressionTest *createSuite() {
+    return new WorkspaceExpressionTest();
+  }
+  static void destroySuite(WorkspaceExpressionTest *suite) { delete suite; }
+
+  void test_matches_binary_operation_algorithms() {
+    MatrixWorkspace_sptr data = makeWorkspace(4, 5, 10.0);
+    MatrixWorkspace_sptr background = makeWorkspace(4, 5, 1.0);
+    MatrixWorkspace_sptr vanadium = makeWorkspace(4, 5, 3.0);
+
+    const auto fused =
+        ((WorkspaceExpression(data) - background) / vanadium * 1.3)
+            .evaluate();
+    const auto expected = (data - background) / vanadium * 1.3;
+    assertWorkspacesEqual(*fused, *expected);
+  }
+
+  void test_addition_with_value_and_error() {
+    MatrixWorkspace_sptr data = makeWorkspace(3, 4, 2.0);
+    const auto fused =
+        (WorkspaceExpression(data) + WorkspaceExpression(5.0, 2.0)).evaluate();
+    for (size_t i = 0; i < data->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < data->blocksize(); ++j) {
+        TS_ASSERT_DELTA(fused->y(i)[j], data->y(i)[j] + 5.0, 1e-12)
+        TS_ASSERT_DELTA(fused->e(i)[j],
+                        std::sqrt(data->e(i)[j] * data->e(i)[j] + 4.0), 1e-12)
+      }
+    }
+  }
+
+  void test_power() {
+    MatrixWorkspace_sptr data = makeWorkspace(2, 3, 2.0);
+    const auto fused = pow(WorkspaceExpression(data), 2.0).evaluate();
+    for (size_t i = 0; i < data->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < data->blocksize(); ++j) {
+        const double y = data->y(i)[j];
+        TS_ASSERT_DELTA(fused->y(i)[j], y * y, 1e-12)
+        TS_ASSERT_DELTA(fused->e(i)[j], 2.0 * y * data->e(i)[j], 1e-12)
+      }
+    }
+  }
+
+  void test_single_spectrum_and_single_value_operands_are_broadcast() {
+    MatrixWorkspace_sptr data = makeWorkspace(3, 4, 2.0);
+    MatrixWorkspace_sptr monitor = makeWorkspace(1, 4, 7.0);
+    MatrixWorkspace_sptr scale =
+        WorkspaceCreationHelper::createWorkspaceSingleValueWithError(2.0, 0.1);
+
+    const auto fused =
+        (WorkspaceExpression(data) / monitor * scale).evaluate();
+    TS_ASSERT_EQUALS(fused->getNumberHistograms(), 3)
+    const auto expected = data / monitor * scale;
+    assertWorkspacesEqual(*fused, *expected);
+  }
+
+  void test_masked_spectra_are_propagated() {
+    MatrixWorkspace_sptr data =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 4);
+    MatrixWorkspace_sptr background =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 4);
+    background->mutableSpectrumInfo().setMasked(1, true);
+
+    const auto fused = (WorkspaceExpression(data) - background).evaluate();
+    const auto &spectrumInfo = fused->spectrumInfo();
+    TS_ASSERT(!spectrumInfo.isMasked(0))
+    TS_ASSERT(spectrumInfo.isMasked(1))
+    TS_ASSERT(!spectrumInfo.isMasked(2))
+    for (const auto y : fused->y(1))
+      TS_ASSERT_EQUALS(y, 0.0)
+  }
+
+  void test_masks_of_single_spectrum_operands_are_not_propagated() {
+    MatrixWorkspace_sptr data =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 4);
+    MatrixWorkspace_sptr monitor =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(1, 4);
+    monitor->mutableSpectrumInfo().setMasked(0, true);
+
+    const auto fused = (WorkspaceExpression(data) / monitor).evaluate();
+    const auto &spectrumInfo = fused->spectrumInfo();
+    for (size_t i = 0; i < fused->getNumberHistograms(); ++i)
+      TS_ASSERT(!spectrumInfo.isMasked(i))
+    const auto expected = data / monitor;
+    assertWorkspacesEqual(*fused, *expected);
+  }
+
+  void test_incompatible_sizes_throw() {
+    MatrixWorkspace_sptr data = makeWorkspace(3, 4, 2.0);
+    MatrixWorkspace_sptr other = makeWorkspace(2, 4, 2.0);
+    TS_ASSERT_THROWS((WorkspaceExpression(data) + other).evaluate(),
+                     const std::invalid_argument &)
+  }
+
+  void test_spectra_without_bins() {
+    MatrixWorkspace_sptr empty = create<Workspace2D>(
+        2, Mantid::HistogramData::Histogram(
+               Mantid::HistogramData::BinEdges(1, 0.0)));
+    MatrixWorkspace_sptr result;
+    TS_ASSERT_THROWS_NOTHING(
+        result = (WorkspaceExpression(empty) * 2.0).evaluate())
+    TS_ASSERT_EQUALS(result->getNumberHistograms(), 2)
+    TS_ASSERT_EQUALS(result->blocksize(), 0)
+  }
+
+  void test_expression_without_workspace_throws() {
+    TS_ASSERT_THROWS((WorkspaceExpression(1.0) * 2.0).evaluate(),
+                     const std::invalid_argument &)
+  }
+
+private:
+  MatrixWorkspace_sptr makeWorkspace(const size_t nHist, const size_t nBins,
+                                     const double offset) {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(nHist, nBins);
+    for (size_t i = 0; i < nHist; ++i) {
+      auto &y = ws->mutableY(i);
+      auto &e = ws->mutableE(i);
+      for (size_t j = 0; j < nBins; ++j) {
+        y[j] = offset + static_cast<double>(i + 2 * j);
+        e[j] = std::sqrt(y[j]);
+      }
+    }
+    return ws;
+  }
+
+  void assertWorkspacesEqual(const MatrixWorkspace &actual,
+                             const MatrixWorkspace &expected) {
+    TS_ASSERT_EQUALS(actual.getNumberHistograms(),
+                     expected.getNumberHistograms())
+    for (size_t i = 0; i < expected.getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(actual.x(i), expected.x(i))
+      for (size_t j = 0; j < expected.blocksize(); ++j) {
+        TS_ASSERT_DELTA(actual.y(i)[j], expected.y(i)[j], 1e-12)
+        TS_ASSERT_DELTA(actual.e(i)[j], expected.e(i)[j], 1e-12)
+      }
+    }
+  }
+};
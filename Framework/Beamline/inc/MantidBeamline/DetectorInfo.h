@@ -78,6 +78,7 @@ public:
   void setRotation(const size_t index, const Eigen::Quaterniond &rotation);
   void setRotation(const std::pair<size_t, size_t> &index,
                    const Eigen::Quaterniond &rotation);
+  uint64_t positionVersion() const;
 
   size_t scanCount() const;
   const std::vector<std::pair<int64_t, int64_t>> scanIntervals() const;
@@ -102,6 +103,7 @@ private:
   void checkNoTimeDependence() const;
   void checkSizes(const DetectorInfo &other) const;
   void merge(const DetectorInfo &other, const std::vector<bool> &merge);
+  static uint64_t newPositionVersion();
 
   Kernel::cow_ptr<std::vector<bool>> m_isMonitor{nullptr};
   Kernel::cow_ptr<std::vector<bool>> m_isMasked{nullptr};
@@ -109,6 +111,8 @@ private:
   Kernel::cow_ptr<std::vector<Eigen::Quaterniond,
                               Eigen::aligned_allocator<Eigen::Quaterniond>>>
       m_rotations{nullptr};
+  /// Identifies the current positions, shared by copies with equal positions
+  uint64_t m_positionVersion{newPositionVersion()};
 
   ComponentInfo *m_componentInfo = nullptr; // Geometry::ComponentInfo owner
 };
@@ -169,12 +173,14 @@ inline void DetectorInfo::setPosition(const size_t index,
                                       const Eigen::Vector3d &position) {
   checkNoTimeDependence();
   m_positions.access()[index] = position;
+  m_positionVersion = newPositionVersion();
 }
 
 /// Set the position of the detector with given index.
 inline void DetectorInfo::setPosition(const std::pair<size_t, size_t> &index,
                                       const Eigen::Vector3d &position) {
   m_positions.access()[linearIndex(index)] = position;
+  m_positionVersion = newPositionVersion();
 }
 
 /** Set the rotation of the detector with given detector index.
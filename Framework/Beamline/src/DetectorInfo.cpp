@@ -9,6 +9,7 @@
 #include "MantidKernel/make_cow.h"
 
 #include <algorithm>
+#include <atomic>
 
 namespace Mantid {
 namespace Beamline {
@@ -206,6 +207,20 @@ void DetectorInfo::merge(const DetectorInfo &other,
     rotations.insert(rotations.end(), other.m_rotations->begin() + indexStart,
                      other.m_rotations->begin() + indexEnd);
   }
+  m_positionVersion = newPositionVersion();
+}
+
+/** Returns a number identifying the current detector positions.
+ *
+ * Every change of positions assigns a new number that is unique within the
+ * process, so caches derived from positions can be validated in constant time.
+ * Copies share the number as long as neither of them is modified. */
+uint64_t DetectorInfo::positionVersion() const { return m_positionVersion; }
+
+/// Returns a new process-wide unique position version.
+uint64_t DetectorInfo::newPositionVersion() {
+  static std::atomic<uint64_t> lastVersion{0};
+  return ++lastVersion;
 }
 
 void DetectorInfo::setComponentInfo(ComponentInfo *componentInfo) {
@@ -145,6 +145,11 @@ private:
                     const double &progressRange,
                     const Mantid::NeXus::NXEntry &mtd_entry, const int xlength,
                     std::string &workspaceType);
+  bool isLoadedOnDemand(Mantid::NeXus::NXData &wksp_cls,
+                        const std::string &workspaceType);
+  void setFileBacking(Mantid::NeXus::NXData &wksp_cls,
+                      Mantid::NeXus::NXDouble &xbins,
+                      API::MatrixWorkspace &local_workspace);
 
   /// Read the data from the sample group
   void readSampleGroup(Mantid::NeXus::NXEntry &mtd_entry,
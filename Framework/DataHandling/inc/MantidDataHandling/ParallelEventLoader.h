@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "MantidDataHandling/DllConfig.h"
+#include "MantidParallel/IO/EventLoader.h"
 
 namespace Mantid {
 namespace DataObjects {
@@ -37,7 +38,9 @@ public:
                                const std::string &groupName,
                                const std::vector<std::string> &bankNames,
                                const bool eventIDIsSpectrumNumber,
-                               const bool precalcEvents);
+                               const bool precalcEvents,
+                               const Parallel::IO::EventLoader::EventFilter
+                                   &filter = {});
 };
 
 } // namespace DataHandling
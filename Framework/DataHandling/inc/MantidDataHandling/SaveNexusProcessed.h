@@ -93,6 +93,8 @@ private:
               std::shared_ptr<Mantid::NeXus::NexusFileIO> &nexusFile,
               const bool keepFile = false,
               boost::optional<size_t> entryNumber = boost::optional<size_t>());
+  void loadWorkspacesBackedByFile(
+      std::vector<Mantid::API::Workspace_sptr> workspaces);
 
   /// Pointer to the local workspace
   API::MatrixWorkspace_const_sptr m_inputWorkspace;
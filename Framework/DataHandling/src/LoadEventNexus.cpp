@@ -1175,9 +1175,19 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
       };
 
       try {
+        Parallel::IO::EventLoader::EventFilter filter;
+        if (filter_tof_min != -1e20 || filter_tof_max != 1e20) {
+          filter.tofMin = filter_tof_min;
+          filter.tofMax = filter_tof_max;
+        }
+        if (filter_time_start != Types::Core::DateAndTime::minimum() ||
+            filter_time_stop != Types::Core::DateAndTime::maximum()) {
+          filter.pulseTimeMin = filter_time_start.totalNanoseconds();
+          filter.pulseTimeMax = filter_time_stop.totalNanoseconds();
+        }
         ParallelEventLoader::loadMultiProcess(*ws, m_filename, m_top_entry_name,
                                               bankNames, event_id_is_spec,
-                                              getProperty("Precount"));
+                                              getProperty("Precount"), filter);
         g_log.information() << "Used Multiprocess ParallelEventLoader.\n";
         loaded = true;
         shortest_tof = 0.0;
@@ -1697,11 +1707,14 @@ LoadEventNexus::defineLoaderType(const bool haveWeights,
   noParallelConstrictions &= !(m_ws->nPeriods() != 1);
   noParallelConstrictions &= !haveWeights;
   noParallelConstrictions &= !oldNeXusFileNames;
-  noParallelConstrictions &=
-      !(filter_tof_min != -1e20 || filter_tof_max != 1e20);
-  noParallelConstrictions &=
-      !((filter_time_start != Types::Core::DateAndTime::minimum() ||
-         filter_time_stop != Types::Core::DateAndTime::maximum()));
+  // Only the multiprocess loader filters by time-of-flight and pulse time
+  if (propVal == "MPI") {
+    noParallelConstrictions &=
+        !(filter_tof_min != -1e20 || filter_tof_max != 1e20);
+    noParallelConstrictions &=
+        !((filter_time_start != Types::Core::DateAndTime::minimum() ||
+           filter_time_stop != Types::Core::DateAndTime::maximum()));
+  }
   noParallelConstrictions &=
       !((!isDefault("CompressTolerance") || !isDefault("SpectrumMin") ||
          !isDefault("SpectrumMax") || !isDefault("SpectrumList") ||
@@ -16,8 +16,10 @@
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidAPI/WorkspaceHistory.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
 #include "MantidDataHandling/ISISRunLogs.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
 #include "MantidDataObjects/LeanElasticPeaksWorkspace.h"
 #include "MantidDataObjects/Peak.h"
 #include "MantidDataObjects/PeakNoShapeFactory.h"
@@ -248,6 +250,11 @@ void LoadNexusProcessed::init() {
       "For multiperiod workspaces. Copy instrument, parameter and x-data "
       "rather than loading it directly for each workspace. Y, E and log "
       "information is always loaded.");
+  declareProperty("LoadDataOnDemand", false,
+                  "If true, the counts and errors of histogram workspaces are "
+                  "read from the file when they are first accessed instead of "
+                  "while loading. Only a limited number of spectra is kept in "
+                  "memory unless they are modified.");
 }
 
 /**
@@ -782,6 +789,10 @@ LoadNexusProcessed::loadEventEntry(NXData &wksp_cls, NXDouble &xbins,
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  // Each event list was given its own X, share those that are identical
+  if (!m_shared_bins)
+    WorkspaceHelpers::shareIdenticalXData(*ws);
+
   return ws;
 }
 
@@ -1521,9 +1532,13 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
   size_t nspectra = data.dim0();
   // process optional spectrum parameters, if set
   checkOptionalProperties(nspectra);
+  const bool onDemand = isLoadedOnDemand(wksp_cls, workspaceType);
   // Actual number of spectra in output workspace (if only a range was going
   // to be loaded)
-  size_t total_specs = calculateWorkspaceSize(nspectra);
+  m_filtered_spec_idxs.clear();
+  size_t total_specs = calculateWorkspaceSize(nspectra, onDemand);
+  if (onDemand)
+    workspaceType = "FileBackedWorkspace2D";
 
   //// Create the 2D workspace for the output
   bool hasFracArea = false;
@@ -1553,6 +1568,10 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
   local_workspace->setYUnitLabel(unitLabel);
 
   readBinMasking(wksp_cls, local_workspace);
+  if (onDemand) {
+    setFileBacking(wksp_cls, xbins, *local_workspace);
+    return local_workspace;
+  }
   NXDataSetTyped<double> errors = wksp_cls.openNXDouble("errors");
   NXDataSetTyped<double> fracarea = errors;
   if (hasFracArea) {
@@ -1712,10 +1731,62 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
                   wsIndex, local_workspace);
       }
     }
+    // Each spectrum was given its own X, share those that are identical
+    WorkspaceHelpers::shareIdenticalXData(*local_workspace);
   }
   return local_workspace;
 }
 
+/**
+ * Check if the counts and errors of a workspace are to be read from the file
+ * on demand, which is only supported for Workspace2D with common bin edges
+ * and without x errors.
+ *
+ * @param wksp_cls Nexus data for the workspace
+ * @param workspaceType The type of workspace being loaded
+ *
+ * @return true if the data is read on demand
+ */
+bool LoadNexusProcessed::isLoadedOnDemand(NXData &wksp_cls,
+                                          const std::string &workspaceType) {
+  const bool onDemand = getProperty("LoadDataOnDemand");
+  if (!onDemand)
+    return false;
+  if (workspaceType != "Workspace2D" || !m_shared_bins ||
+      wksp_cls.isValid("frac_area") || wksp_cls.isValid("xerrors")) {
+    g_log.information() << "Data of " << workspaceType
+                        << " without common bins or with x errors cannot be "
+                           "loaded on demand, loading it into memory.\n";
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Set the X data of a FileBackedWorkspace2D and let it read the counts and
+ * errors of the spectra selected by the spectrum properties from the file.
+ *
+ * @param wksp_cls Nexus data for the workspace
+ * @param xbins bins on the "X" axis
+ * @param local_workspace The FileBackedWorkspace2D
+ */
+void LoadNexusProcessed::setFileBacking(
+    NXData &wksp_cls, NXDouble &xbins,
+    API::MatrixWorkspace &local_workspace) {
+  auto &fileBacked = dynamic_cast<FileBackedWorkspace2D &>(local_workspace);
+  // The data read from the file must be interpreted with the right YMode,
+  // changing it later would read all of it.
+  fileBacked.setDistribution(xbins.attributes("distribution") == "1");
+  std::vector<size_t> rows(m_filtered_spec_idxs.size());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    fileBacked.setSharedX(i, m_xbins.cowData());
+    rows[i] = static_cast<size_t>(m_filtered_spec_idxs[i] - 1);
+  }
+  fileBacked.setFileBacking(std::make_shared<FileBackedHistogramSource>(
+                                getPropertyValue("Filename"), wksp_cls.path()),
+                            rows);
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * Load a single entry into a workspace (event_workspace or workspace2d)
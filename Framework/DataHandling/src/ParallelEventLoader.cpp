@@ -118,16 +118,17 @@ void ParallelEventLoader::loadMPI(DataObjects::EventWorkspace &ws,
 }
 
 /// Load events from given banks into given EventWorkspace using
-/// boost::interprocess.
+/// boost::interprocess, keeping only the events accepted by the filter.
 void ParallelEventLoader::loadMultiProcess(
     DataObjects::EventWorkspace &ws, const std::string &filename,
     const std::string &groupName, const std::vector<std::string> &bankNames,
-    const bool eventIDIsSpectrumNumber, const bool precalcEvents) {
+    const bool eventIDIsSpectrumNumber, const bool precalcEvents,
+    const Parallel::IO::EventLoader::EventFilter &filter) {
   auto eventLists = getResultVector(ws);
   std::vector<int32_t> offsets =
       getOffsets(ws, filename, groupName, bankNames, eventIDIsSpectrumNumber);
   Parallel::IO::EventLoader::load(filename, groupName, bankNames, offsets,
-                                  std::move(eventLists), precalcEvents);
+                                  std::move(eventLists), precalcEvents, filter);
 }
 
 } // namespace DataHandling
@@ -7,18 +7,21 @@
 // SaveNexusProcessed
 // @author Ronald Fowler, based on SaveNexus
 #include "MantidDataHandling/SaveNexusProcessed.h"
+#include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/EnabledWhenWorkspaceIsType.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/IMDEventWorkspace.h"
 #include "MantidAPI/IMDHistoWorkspace.h"
 #include "MantidAPI/WorkspaceHistory.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
 #include "MantidDataObjects/MaskWorkspace.h"
 #include "MantidDataObjects/OffsetsWorkspace.h"
 #include "MantidDataObjects/PeaksWorkspace.h"
 #include "MantidGeometry/Crystal/AngleUnits.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/ListValidator.h"
 #include "MantidNexus/NexusFileIO.h"
 #include <memory>
 #include <utility>
@@ -161,6 +164,14 @@ void SaveNexusProcessed::init() {
       "CompressNexus",
       std::make_unique<EnabledWhenWorkspaceIsType<EventWorkspace>>(
           "InputWorkspace", true));
+
+  const std::vector<std::string> compressionMethods{"Deflate", "None"};
+  declareProperty(
+      "CompressionMethod", "Deflate",
+      std::make_shared<StringListValidator>(compressionMethods),
+      "Compression applied to the histogram data and, if CompressNexus is "
+      "set, to the event data.\n"
+      "None writes fastest but makes larger files.");
 }
 
 /** Get the list of workspace indices to use
@@ -293,6 +304,8 @@ void SaveNexusProcessed::doExec(
   const bool append_to_file = getProperty("Append");
 
   nexusFile->resetProgress(&prog_init);
+  const bool compress = getPropertyValue("CompressionMethod") != "None";
+  nexusFile->setCompression(compress ? ::NeXus::LZW : ::NeXus::NONE);
   nexusFile->openNexusWrite(filename, std::move(entryNumber),
                             append_to_file || keepFile);
 
@@ -341,10 +354,11 @@ void SaveNexusProcessed::doExec(
       cppFile.makeGroup("detector", "NXdetector", true);
 
       cppFile.putAttr("version", 1);
+      const auto compression = compress ? ::NeXus::LZW : ::NeXus::NONE;
       saveSpectraDetectorMapNexus(*matrixWorkspace, &cppFile, indices,
-                                  ::NeXus::LZW);
+                                  compression);
       saveSpectrumNumbersNexus(*matrixWorkspace, &cppFile, indices,
-                               ::NeXus::LZW);
+                               compression);
       cppFile.closeGroup();
       cppFile.closeGroup();
     }
@@ -385,6 +399,7 @@ void SaveNexusProcessed::doExec(
  */
 void SaveNexusProcessed::exec() {
   Workspace_sptr inputWorkspace = getProperty("InputWorkspace");
+  loadWorkspacesBackedByFile({inputWorkspace});
 
   // Then immediately open the file
   auto nexusFile = std::make_shared<Mantid::NeXus::NexusFileIO>();
@@ -584,6 +599,7 @@ bool SaveNexusProcessed::processGroups() {
   // entry for each one. We only have a single input workspace property declared
   // so there will only be a single list of unrolled workspaces
   const auto &workspaces = m_unrolledInputWorkspaces[0];
+  loadWorkspacesBackedByFile(workspaces);
   if (!workspaces.empty()) {
     for (size_t entry = 0; entry < workspaces.size(); entry++) {
       const Workspace_sptr ws = workspaces[entry];
@@ -601,6 +617,31 @@ bool SaveNexusProcessed::processGroups() {
   return true;
 }
 
+/** Load the data of all FileBackedWorkspace2D read from the output file into
+ * memory. The file is overwritten or opened for writing, so the data could
+ * not be read from it any more.
+ * @param workspaces :: the workspaces being saved, which may not be in the
+ * analysis data service
+ */
+void SaveNexusProcessed::loadWorkspacesBackedByFile(
+    std::vector<Workspace_sptr> workspaces) {
+  const std::string filename = getPropertyValue("Filename");
+  const auto stored = AnalysisDataService::Instance().getObjects(
+      Kernel::DataServiceHidden::Include);
+  workspaces.insert(workspaces.end(), stored.cbegin(), stored.cend());
+  for (const auto &workspace : workspaces) {
+    const auto fileBacked =
+        std::dynamic_pointer_cast<FileBackedWorkspace2D>(workspace);
+    if (!fileBacked)
+      continue;
+    const auto loaded = fileBacked->loadIntoMemory(filename);
+    if (loaded > 0)
+      g_log.information() << "Loaded " << loaded << " spectra of "
+                          << workspace->getName() << " into memory before "
+                          << "writing to " << filename << "\n";
+  }
+}
+
 /** Save the spectra detector map to an open NeXus file.
  * @param ws :: Workspace containing spectrum data
  * @param file :: open NeXus file
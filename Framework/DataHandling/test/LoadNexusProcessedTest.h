@@ -18,6 +18,7 @@
 #include "MantidDataHandling/LoadNexusProcessed.h"
 #include "MantidDataHandling/SaveNexusProcessed.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
 #include "MantidDataObjects/LeanElasticPeaksWorkspace.h"
 #include "MantidDataObjects/Peak.h"
 #include "MantidDataObjects/PeakShapeSpherical.h"
@@ -937,6 +938,119 @@ public:
     doTestLoadAndSavePointWS(true);
   }
 
+  void test_LoadDataOnDemand_reads_spectra_from_file() {
+    auto inputWs =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(5, 3, 0.0, 1.0);
+    for (size_t i = 0; i < inputWs->getNumberHistograms(); ++i) {
+      inputWs->mutableY(i) = static_cast<double>(i + 1);
+      inputWs->mutableE(i) = 0.5 * static_cast<double>(i + 1);
+    }
+    SaveNexusProcessed save;
+    save.initialize();
+    save.setProperty("InputWorkspace",
+                     std::dynamic_pointer_cast<MatrixWorkspace>(inputWs));
+    save.setPropertyValue("Filename", "TestLoadDataOnDemand.nxs");
+    const std::string filename = save.getPropertyValue("Filename");
+    TS_ASSERT_THROWS_NOTHING(save.execute());
+
+    LoadNexusProcessed load;
+    load.initialize();
+    load.setPropertyValue("Filename", filename);
+    load.setPropertyValue("OutputWorkspace", "output");
+    load.setProperty("LoadDataOnDemand", true);
+    load.setProperty("SpectrumMin", 2);
+    load.setProperty("SpectrumMax", 4);
+    TS_ASSERT_THROWS_NOTHING(load.execute());
+
+    auto outputWs =
+        AnalysisDataService::Instance().retrieveWS<FileBackedWorkspace2D>(
+            "output");
+    TS_ASSERT(outputWs)
+    TS_ASSERT_EQUALS(outputWs->getNumberHistograms(), 3)
+    TS_ASSERT_EQUALS(outputWs->numberOfFileBackedSpectra(), 3)
+    for (size_t i = 0; i < outputWs->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(outputWs->getSpectrum(i).getSpectrumNo(),
+                       static_cast<int>(i + 2))
+      TS_ASSERT_EQUALS(outputWs->x(i), inputWs->x(i + 1))
+      TS_ASSERT_EQUALS(outputWs->y(i), inputWs->y(i + 1))
+      TS_ASSERT_EQUALS(outputWs->e(i), inputWs->e(i + 1))
+    }
+    // Reading does not load the data into the workspace, modifying does
+    TS_ASSERT_EQUALS(outputWs->numberOfFileBackedSpectra(), 3)
+    outputWs->mutableY(1)[0] = 42.0;
+    TS_ASSERT_EQUALS(outputWs->numberOfFileBackedSpectra(), 2)
+    TS_ASSERT_EQUALS(outputWs->y(1)[0], 42.0)
+    TS_ASSERT_EQUALS(outputWs->y(1)[1], 3.0)
+    TS_ASSERT_EQUALS(outputWs->e(1), inputWs->e(2))
+
+    AnalysisDataService::Instance().remove("output");
+    if (Poco::File(filename).exists())
+      Poco::File(filename).remove();
+  }
+
+  void test_SaveNexusProcessed_can_overwrite_the_file_backing_a_workspace() {
+    auto inputWs =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(3, 4, 0.0, 1.0);
+    for (size_t i = 0; i < inputWs->getNumberHistograms(); ++i) {
+      inputWs->mutableY(i) = static_cast<double>(i + 1);
+      inputWs->mutableE(i) = 0.5 * static_cast<double>(i + 1);
+    }
+    SaveNexusProcessed save;
+    save.initialize();
+    save.setProperty("InputWorkspace",
+                     std::dynamic_pointer_cast<MatrixWorkspace>(inputWs));
+    save.setPropertyValue("Filename", "TestOverwriteOnDemand.nxs");
+    const std::string filename = save.getPropertyValue("Filename");
+    TS_ASSERT_THROWS_NOTHING(save.execute());
+
+    LoadNexusProcessed load;
+    load.initialize();
+    load.setPropertyValue("Filename", filename);
+    load.setPropertyValue("OutputWorkspace", "onDemand");
+    load.setProperty("LoadDataOnDemand", true);
+    TS_ASSERT_THROWS_NOTHING(load.execute());
+    auto onDemandWs =
+        AnalysisDataService::Instance().retrieveWS<FileBackedWorkspace2D>(
+            "onDemand");
+    TS_ASSERT_EQUALS(onDemandWs->numberOfFileBackedSpectra(), 3)
+    // A second workspace backed by the same file, not being saved
+    load.setPropertyValue("OutputWorkspace", "other");
+    TS_ASSERT_THROWS_NOTHING(load.execute());
+    auto otherWs =
+        AnalysisDataService::Instance().retrieveWS<FileBackedWorkspace2D>(
+            "other");
+
+    SaveNexusProcessed overwrite;
+    overwrite.initialize();
+    overwrite.setPropertyValue("InputWorkspace", "onDemand");
+    overwrite.setPropertyValue("Filename", filename);
+    TS_ASSERT_THROWS_NOTHING(overwrite.execute());
+    TS_ASSERT(overwrite.isExecuted());
+    TS_ASSERT_EQUALS(onDemandWs->numberOfFileBackedSpectra(), 0)
+    TS_ASSERT_EQUALS(otherWs->numberOfFileBackedSpectra(), 0)
+
+    LoadNexusProcessed reload;
+    reload.initialize();
+    reload.setPropertyValue("Filename", filename);
+    reload.setPropertyValue("OutputWorkspace", "reloaded");
+    TS_ASSERT_THROWS_NOTHING(reload.execute());
+    auto reloadedWs =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+            "reloaded");
+    for (size_t i = 0; i < inputWs->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(reloadedWs->y(i), inputWs->y(i))
+      TS_ASSERT_EQUALS(reloadedWs->e(i), inputWs->e(i))
+      TS_ASSERT_EQUALS(onDemandWs->y(i), inputWs->y(i))
+      TS_ASSERT_EQUALS(otherWs->e(i), inputWs->e(i))
+    }
+
+    AnalysisDataService::Instance().remove("onDemand");
+    AnalysisDataService::Instance().remove("other");
+    AnalysisDataService::Instance().remove("reloaded");
+    if (Poco::File(filename).exists())
+      Poco::File(filename).remove();
+  }
+
   void test_that_workspace_name_is_loaded() {
     // Arrange
     LoadNexusProcessed loader;
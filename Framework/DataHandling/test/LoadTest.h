@@ -8,7 +8,9 @@
 
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/FileLoaderRegistry.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/NexusFileLoader.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataHandling/Load.h"
 #include "MantidDataObjects/Workspace2D.h"
@@ -332,6 +334,27 @@ public:
     TS_ASSERT_EQUALS(loader.getPropertyValue("LoaderName"), "LoadEventNexus");
   }
 
+  void test_loader_search_reuses_descriptor_of_unchanged_file() {
+    Load loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    const std::string path = loader.getPropertyValue("Filename");
+    auto &registry = FileLoaderRegistry::Instance();
+
+    const auto descriptor = registry.nexusHDF5Descriptor(path);
+    TS_ASSERT_EQUALS(registry.nexusHDF5Descriptor(path), descriptor)
+    const auto chosen = std::dynamic_pointer_cast<NexusFileLoader>(
+        registry.chooseLoader(path));
+    TS_ASSERT(chosen)
+    if (chosen) {
+      TS_ASSERT_EQUALS(chosen->name(), "LoadEventNexus")
+      TS_ASSERT_EQUALS(chosen->getFileInfo(), descriptor)
+    }
+
+    registry.clearCache();
+    TS_ASSERT_DIFFERS(registry.nexusHDF5Descriptor(path), descriptor)
+  }
+
   void testArgusFileWithIncorrectZeroPadding_NoExecute() {
     Load loader;
     loader.initialize();
@@ -30,6 +30,7 @@
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
+#include <H5Cpp.h>
 #include <Poco/File.h>
 #include <Poco/Path.h>
 
@@ -109,6 +110,57 @@ public:
     AnalysisDataService::Instance().remove("testSpace");
   }
 
+  void test_histograms_round_trip_for_each_compression_method() {
+    // Enough data for the spectra to be written in several blocks
+    const size_t nHist(150), nBins(2000);
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(
+        static_cast<int>(nHist), static_cast<int>(nBins), 0.0, 1.0);
+    for (size_t i = 0; i < nHist; ++i) {
+      auto &y = ws->mutableY(i);
+      for (size_t j = 0; j < nBins; ++j)
+        y[j] = static_cast<double>(i * nBins + j);
+      ws->mutableE(i) = static_cast<double>(i);
+    }
+    for (const std::string method : {"Deflate", "None"}) {
+      const std::string outputFile =
+          "SaveNexusProcessedTest_compression_" + method + ".nxs";
+      SaveNexusProcessed saver;
+      saver.initialize();
+      saver.setProperty("InputWorkspace", ws);
+      saver.setPropertyValue("Filename", outputFile);
+      saver.setPropertyValue("CompressionMethod", method);
+      TS_ASSERT_THROWS_NOTHING(saver.execute());
+      TS_ASSERT(saver.isExecuted());
+      const std::string filename = saver.getPropertyValue("Filename");
+      for (const std::string dataset : {"values", "errors"}) {
+        const auto datasetFilters =
+            filters(filename, "/mantid_workspace_1/workspace/" + dataset);
+        if (method == "None")
+          TS_ASSERT(datasetFilters.empty())
+        else
+          TS_ASSERT_EQUALS(datasetFilters,
+                           std::vector<H5Z_filter_t>{H5Z_FILTER_DEFLATE})
+      }
+
+      LoadNexus loader;
+      loader.initialize();
+      loader.setPropertyValue("Filename", filename);
+      loader.setPropertyValue("OutputWorkspace", "loaded");
+      TS_ASSERT_THROWS_NOTHING(loader.execute());
+      auto loaded =
+          AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+              "loaded");
+      TS_ASSERT_EQUALS(loaded->getNumberHistograms(), nHist);
+      for (const size_t i : {size_t{0}, size_t{64}, size_t{65}, nHist - 1}) {
+        TS_ASSERT_EQUALS(loaded->y(i), ws->y(i));
+        TS_ASSERT_EQUALS(loaded->e(i), ws->e(i));
+      }
+      AnalysisDataService::Instance().remove("loaded");
+      if (clearfiles)
+        Poco::File(filename).remove();
+    }
+  }
+
   void testExecOnLoadraw() {
     SaveNexusProcessed algToBeTested;
     std::string inputFile = "LOQ48127.raw";
@@ -924,6 +976,22 @@ public:
   }
 
 private:
+  /// Returns the ids of the HDF5 filters, e.g. the compression, of a dataset
+  std::vector<H5Z_filter_t> filters(const std::string &filename,
+                                    const std::string &dataset) {
+    H5::H5File file(filename, H5F_ACC_RDONLY);
+    const auto properties = file.openDataSet(dataset).getCreatePlist();
+    std::vector<H5Z_filter_t> result;
+    for (int i = 0; i < properties.getNfilters(); ++i) {
+      unsigned int flags, config;
+      size_t numberValues = 0;
+      char name[64];
+      result.emplace_back(properties.getFilter(
+          i, flags, numberValues, nullptr, sizeof(name), name, config));
+    }
+    return result;
+  }
+
   void doTestColumnInfo(::NeXus::File &file, int type,
                         const std::string &interpret_as,
                         const std::string &name) {
@@ -158,6 +158,8 @@ public:
 
   void sortTof() const;
 
+  void sortTofFromRuns(const std::vector<size_t> &runStarts) const;
+
   void sortPulseTime() const;
   void sortPulseTimeTOF() const;
   void sortTimeAtSample(const double &tofFactor, const double &tofShift,
@@ -206,6 +208,7 @@ public:
   bool empty() const;
 
   size_t getMemorySize() const override;
+  void addMemoryUsage(API::MemoryUsage &usage) const override;
 
   virtual size_t histogram_size() const;
 
@@ -19,10 +19,11 @@
 #include <vector>
 
 namespace Mantid {
+namespace API {
+class ISpectrum;
+}
 namespace DataObjects {
 
-class EventList;
-
 //============================================================================
 //============================================================================
 /**
@@ -56,7 +57,9 @@ public:
 //============================================================================
 //============================================================================
 /** This is a container for the MRU (most-recently-used) list
- * of generated histograms.
+ * of generated histograms. It is used by spectra which do not store their Y
+ * and E data as double precision histograms, i.e., EventList and
+ * FloatHistogram1D.
  */
 class DLLExport EventWorkspaceMRU {
 public:
@@ -75,12 +78,12 @@ public:
 
   void clear();
 
-  YType findY(size_t thread_num, const EventList *index);
-  EType findE(size_t thread_num, const EventList *index);
-  void insertY(size_t thread_num, YType data, const EventList *index);
-  void insertE(size_t thread_num, EType data, const EventList *index);
+  YType findY(size_t thread_num, const API::ISpectrum *index);
+  EType findE(size_t thread_num, const API::ISpectrum *index);
+  void insertY(size_t thread_num, YType data, const API::ISpectrum *index);
+  void insertE(size_t thread_num, EType data, const API::ISpectrum *index);
 
-  void deleteIndex(const EventList *index);
+  void deleteIndex(const API::ISpectrum *index);
 
   /** Return how many entries in the Y MRU list are used.
    * Only used in tests. It only returns the 0-th MRU list size.
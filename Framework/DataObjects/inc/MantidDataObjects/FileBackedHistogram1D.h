@@ -0,0 +1,150 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/ISpectrum.h"
+#include "MantidDataObjects/DllConfig.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NeXus {
+class File;
+}
+
+namespace Mantid {
+namespace DataObjects {
+class EventWorkspaceMRU;
+
+/** FileBackedHistogramSource reads single spectra from the "values" and
+  "errors" datasets of a group in a processed NeXus file. The file is opened
+  on the first read and kept open. Reads are serialized since the NeXus API
+  is not thread safe.
+*/
+class MANTID_DATAOBJECTS_DLL FileBackedHistogramSource {
+public:
+  FileBackedHistogramSource(const std::string &filename,
+                            const std::string &groupPath);
+  ~FileBackedHistogramSource();
+
+  void read(const size_t row, std::vector<double> &y,
+            std::vector<double> &e) const;
+
+  /// Returns the canonical path of the file the data is read from
+  const std::string &filename() const { return m_filename; }
+
+  static std::string canonicalPath(const std::string &filename);
+
+private:
+  void readRow(const std::string &name, const size_t row,
+               std::vector<double> &data) const;
+
+  std::string m_filename;
+  std::string m_groupPath;
+  mutable std::unique_ptr<::NeXus::File> m_file;
+  mutable std::mutex m_fileMutex;
+};
+
+/** FileBackedHistogram1D is a spectrum which reads its Y and E data from a
+  processed NeXus file when they are first accessed. X and Dx are held in
+  memory as in Histogram1D.
+
+  As for EventList, data read from the file is kept in the MRU of the parent
+  workspace, so references returned by y() and e() are only valid until the
+  MRU drops them and the memory used is bounded by the size of the MRU. Any
+  modification of Y or E first loads the data permanently into the spectrum,
+  after which it behaves like a Histogram1D.
+*/
+class MANTID_DATAOBJECTS_DLL FileBackedHistogram1D : public API::ISpectrum {
+public:
+  FileBackedHistogram1D(HistogramData::Histogram::XMode xmode,
+                        HistogramData::Histogram::YMode ymode,
+                        EventWorkspaceMRU *mru = nullptr);
+  FileBackedHistogram1D(const FileBackedHistogram1D &other);
+  FileBackedHistogram1D &operator=(const FileBackedHistogram1D &) = delete;
+
+  void setMRU(EventWorkspaceMRU *mru);
+  void setFileBacking(std::shared_ptr<const FileBackedHistogramSource> source,
+                      const size_t row);
+  /// Returns true if Y and E have not been loaded into memory
+  bool isFileBacked() const { return static_cast<bool>(m_source); }
+  /// Returns true if Y and E are read from the file with the given canonical
+  /// path, see FileBackedHistogramSource::canonicalPath()
+  bool isFileBackedBy(const std::string &filename) const {
+    return m_source && m_source->filename() == filename;
+  }
+  void loadIntoMemory();
+
+  void copyDataFrom(const ISpectrum &source) override;
+
+  void setX(const Kernel::cow_ptr<HistogramData::HistogramX> &X) override;
+  MantidVec &dataX() override;
+  const MantidVec &dataX() const override;
+  const MantidVec &readX() const override;
+  Kernel::cow_ptr<HistogramData::HistogramX> ptrX() const override;
+
+  MantidVec &dataDx() override;
+  const MantidVec &dataDx() const override;
+  const MantidVec &readDx() const override;
+
+  void clearData() override;
+
+  MantidVec &dataY() override;
+  MantidVec &dataE() override;
+  const MantidVec &dataY() const override;
+  const MantidVec &dataE() const override;
+
+  /// Returns the number of Y values
+  std::size_t size() const { return m_histogram.size(); }
+
+  size_t getMemorySize() const override;
+
+  HistogramData::Histogram histogram() const override;
+  HistogramData::Counts counts() const override;
+  HistogramData::CountVariances countVariances() const override;
+  HistogramData::CountStandardDeviations
+  countStandardDeviations() const override;
+  HistogramData::Frequencies frequencies() const override;
+  HistogramData::FrequencyVariances frequencyVariances() const override;
+  HistogramData::FrequencyStandardDeviations
+  frequencyStandardDeviations() const override;
+  const HistogramData::HistogramY &y() const override;
+  const HistogramData::HistogramE &e() const override;
+  Kernel::cow_ptr<HistogramData::HistogramY> sharedY() const override;
+  Kernel::cow_ptr<HistogramData::HistogramE> sharedE() const override;
+
+protected:
+  void checkAndSanitizeHistogram(HistogramData::Histogram &histogram) override;
+  void checkIsYAndEWritable() const override;
+
+private:
+  using ISpectrum::copyDataInto;
+  void copyDataInto(Histogram1D &sink) const override;
+
+  const HistogramData::Histogram &histogramRef() const override {
+    return m_histogram;
+  }
+  HistogramData::Histogram &mutableHistogramRef() override;
+
+  void readFromFile(Kernel::cow_ptr<HistogramData::HistogramY> &y,
+                    Kernel::cow_ptr<HistogramData::HistogramE> &e) const;
+  void invalidateMRU() const;
+
+  /// Histogram object holding X and Dx, and Y and E once loaded into memory
+  HistogramData::Histogram m_histogram;
+  /// The file holding Y and E, null once they are loaded into memory
+  std::shared_ptr<const FileBackedHistogramSource> m_source;
+  /// The row of this spectrum in the file
+  size_t m_row{0};
+  /// The MRU of the parent workspace, holding Y and E read from the file
+  EventWorkspaceMRU *m_mru;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
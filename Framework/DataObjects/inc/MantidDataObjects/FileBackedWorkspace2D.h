@@ -0,0 +1,63 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/FileBackedHistogram1D.h"
+#include "MantidDataObjects/MRUHistoWorkspace.h"
+
+namespace Mantid {
+namespace DataObjects {
+/** FileBackedWorkspace2D is a histogram workspace whose Y and E data are read
+  from a processed NeXus file when they are first accessed, see
+  LoadNexusProcessed. X, Dx, the instrument and the logs are held in memory.
+
+  Spectra read from the file are cached in an MRU as done by EventWorkspace,
+  so only a bounded number of spectra is held in memory while the workspace
+  is read. Modifying the Y or E data of a spectrum loads it into memory
+  permanently. Workspaces created from a FileBackedWorkspace2D with
+  WorkspaceFactory or DataObjects::create are in-memory Workspace2D.
+*/
+class MANTID_DATAOBJECTS_DLL FileBackedWorkspace2D
+    : public MRUHistoWorkspace<FileBackedHistogram1D> {
+public:
+  /// Gets the name of the workspace type
+  const std::string id() const override { return "FileBackedWorkspace2D"; }
+
+  FileBackedWorkspace2D(
+      const Parallel::StorageMode storageMode = Parallel::StorageMode::Cloned);
+  FileBackedWorkspace2D &operator=(const FileBackedWorkspace2D &other) = delete;
+
+  /// Returns a clone of the workspace
+  std::unique_ptr<FileBackedWorkspace2D> clone() const {
+    return std::unique_ptr<FileBackedWorkspace2D>(doClone());
+  }
+
+  /// Returns a default-initialized clone of the workspace
+  std::unique_ptr<FileBackedWorkspace2D> cloneEmpty() const {
+    return std::unique_ptr<FileBackedWorkspace2D>(doCloneEmpty());
+  }
+
+  void setFileBacking(std::shared_ptr<const FileBackedHistogramSource> source,
+                      const std::vector<size_t> &rows);
+  size_t numberOfFileBackedSpectra() const;
+  size_t loadIntoMemory(const std::string &filename);
+
+protected:
+  FileBackedWorkspace2D(const FileBackedWorkspace2D &other) = default;
+
+private:
+  FileBackedWorkspace2D *doClone() const override;
+  FileBackedWorkspace2D *doCloneEmpty() const override;
+};
+
+using FileBackedWorkspace2D_sptr = std::shared_ptr<FileBackedWorkspace2D>;
+using FileBackedWorkspace2D_const_sptr =
+    std::shared_ptr<const FileBackedWorkspace2D>;
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -0,0 +1,111 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/ISpectrum.h"
+#include "MantidDataObjects/DllConfig.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+class EventWorkspaceMRU;
+
+/** FloatHistogram1D is a spectrum storing Y and E in single precision. X and
+  Dx are stored in double precision and may be shared as in Histogram1D.
+
+  Y and E are provided in double precision by converting the stored values on
+  access. As for EventList the converted data is kept in the MRU of the
+  parent workspace, so references returned by y() and e() are only valid
+  until the MRU drops them. Any modification of Y or E first loads the data
+  permanently into the spectrum in double precision, after which it behaves
+  like a Histogram1D. setHistogram() stores the data in single precision
+  again.
+*/
+class MANTID_DATAOBJECTS_DLL FloatHistogram1D : public API::ISpectrum {
+public:
+  FloatHistogram1D(HistogramData::Histogram::XMode xmode,
+                   HistogramData::Histogram::YMode ymode,
+                   EventWorkspaceMRU *mru = nullptr);
+  FloatHistogram1D(const FloatHistogram1D &other);
+  FloatHistogram1D &operator=(const FloatHistogram1D &) = delete;
+
+  void setMRU(EventWorkspaceMRU *mru);
+  /// Returns true if Y and E are stored in single precision
+  bool isSinglePrecision() const { return !m_histogram.sharedY(); }
+
+  void copyDataFrom(const ISpectrum &source) override;
+
+  void setX(const Kernel::cow_ptr<HistogramData::HistogramX> &X) override;
+  MantidVec &dataX() override;
+  const MantidVec &dataX() const override;
+  const MantidVec &readX() const override;
+  Kernel::cow_ptr<HistogramData::HistogramX> ptrX() const override;
+
+  MantidVec &dataDx() override;
+  const MantidVec &dataDx() const override;
+  const MantidVec &readDx() const override;
+
+  void clearData() override;
+
+  MantidVec &dataY() override;
+  MantidVec &dataE() override;
+  const MantidVec &dataY() const override;
+  const MantidVec &dataE() const override;
+
+  /// Returns the number of Y values
+  std::size_t size() const {
+    return isSinglePrecision() ? m_y.size() : m_histogram.size();
+  }
+
+  size_t getMemorySize() const override;
+  void addMemoryUsage(API::MemoryUsage &usage) const override;
+
+  HistogramData::Histogram histogram() const override;
+  HistogramData::Counts counts() const override;
+  HistogramData::CountVariances countVariances() const override;
+  HistogramData::CountStandardDeviations
+  countStandardDeviations() const override;
+  HistogramData::Frequencies frequencies() const override;
+  HistogramData::FrequencyVariances frequencyVariances() const override;
+  HistogramData::FrequencyStandardDeviations
+  frequencyStandardDeviations() const override;
+  const HistogramData::HistogramY &y() const override;
+  const HistogramData::HistogramE &e() const override;
+  Kernel::cow_ptr<HistogramData::HistogramY> sharedY() const override;
+  Kernel::cow_ptr<HistogramData::HistogramE> sharedE() const override;
+
+protected:
+  void checkAndSanitizeHistogram(HistogramData::Histogram &histogram) override;
+  void checkIsYAndEWritable() const override;
+
+private:
+  using ISpectrum::copyDataInto;
+  void copyDataInto(Histogram1D &sink) const override;
+
+  const HistogramData::Histogram &histogramRef() const override {
+    return m_histogram;
+  }
+  HistogramData::Histogram &mutableHistogramRef() override {
+    return m_histogram;
+  }
+
+  void loadIntoMemory();
+  void invalidateMRU() const;
+
+  /// Histogram object holding X and Dx, and Y and E once loaded into memory
+  HistogramData::Histogram m_histogram;
+  /// The Y values in single precision, empty once loaded into memory
+  std::vector<float> m_y;
+  /// The E values in single precision, empty once loaded into memory
+  std::vector<float> m_e;
+  /// The MRU of the parent workspace, holding Y and E converted to double
+  EventWorkspaceMRU *m_mru;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
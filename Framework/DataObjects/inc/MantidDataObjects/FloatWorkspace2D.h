@@ -0,0 +1,59 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/FloatHistogram1D.h"
+#include "MantidDataObjects/MRUHistoWorkspace.h"
+
+namespace Mantid {
+namespace DataObjects {
+/** FloatWorkspace2D is a histogram workspace storing Y and E in single
+  precision, halving the memory needed for the data of large workspaces
+  compared to Workspace2D. X and Dx are kept in double precision.
+
+  Y and E are read in double precision through the usual accessors. The
+  converted spectra are cached in an MRU as done by EventWorkspace, so
+  reading a spectrum repeatedly does not repeat the conversion. Modifying
+  the Y or E data of a spectrum in place converts it to double precision
+  permanently, while setHistogram() rounds the values to single precision.
+  Workspaces created from a FloatWorkspace2D with WorkspaceFactory or
+  DataObjects::create are double precision Workspace2D.
+*/
+class MANTID_DATAOBJECTS_DLL FloatWorkspace2D
+    : public MRUHistoWorkspace<FloatHistogram1D> {
+public:
+  /// Gets the name of the workspace type
+  const std::string id() const override { return "FloatWorkspace2D"; }
+
+  FloatWorkspace2D(
+      const Parallel::StorageMode storageMode = Parallel::StorageMode::Cloned);
+  FloatWorkspace2D &operator=(const FloatWorkspace2D &other) = delete;
+
+  /// Returns a clone of the workspace
+  std::unique_ptr<FloatWorkspace2D> clone() const {
+    return std::unique_ptr<FloatWorkspace2D>(doClone());
+  }
+
+  /// Returns a default-initialized clone of the workspace
+  std::unique_ptr<FloatWorkspace2D> cloneEmpty() const {
+    return std::unique_ptr<FloatWorkspace2D>(doCloneEmpty());
+  }
+
+protected:
+  FloatWorkspace2D(const FloatWorkspace2D &other) = default;
+
+private:
+  FloatWorkspace2D *doClone() const override;
+  FloatWorkspace2D *doCloneEmpty() const override;
+};
+
+using FloatWorkspace2D_sptr = std::shared_ptr<FloatWorkspace2D>;
+using FloatWorkspace2D_const_sptr = std::shared_ptr<const FloatWorkspace2D>;
+
+} // namespace DataObjects
+} // namespace Mantid
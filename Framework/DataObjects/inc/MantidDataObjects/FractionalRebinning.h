@@ -61,6 +61,42 @@ MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
     const std::vector<double> &verticalAxis,
     const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
 
+/**
+ * Holds the signal, variance and fractional area rebinned into a
+ * RebinnedOutput by one thread. Each thread rebins into its own buffer
+ * without locking and the buffers are added to the output workspace once
+ * the rebinning is done. The storage is only allocated on first use.
+ */
+class MANTID_DATAOBJECTS_DLL FractionalRebinBuffer {
+public:
+  FractionalRebinBuffer(const DataObjects::RebinnedOutput &outputWS);
+
+  /// Returns the bin edges of the output workspace
+  const std::vector<double> &binEdges() const { return m_binEdges; }
+  void add(const size_t wsIndex, const size_t binIndex, const double signal,
+           const double variance, const double fraction);
+  void addTo(DataObjects::RebinnedOutput &outputWS) const;
+
+  /// Returns the memory in bytes needed by a buffer for outputWS
+  static size_t memorySize(const DataObjects::RebinnedOutput &outputWS);
+
+private:
+  std::vector<double> m_binEdges;
+  size_t m_numberHistograms;
+  size_t m_numberBins;
+  std::vector<double> m_signal;
+  std::vector<double> m_variance;
+  std::vector<double> m_fraction;
+};
+
+/// Rebin the input quadrilateral into a thread's buffer
+MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(
+    const Geometry::Quadrilateral &inputQ,
+    const API::MatrixWorkspace_const_sptr &inputWS, const size_t i,
+    const size_t j, FractionalRebinBuffer &buffer,
+    const std::vector<double> &verticalAxis,
+    const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
+
 /// Set finalize flag after fractional rebinning loop
 MANTID_DATAOBJECTS_DLL void
 finalizeFractionalRebin(DataObjects::RebinnedOutput &outputWS);
@@ -0,0 +1,82 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/HistoWorkspace.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/FileBackedHistogram1D.h"
+#include "MantidDataObjects/FloatHistogram1D.h"
+
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+class EventWorkspaceMRU;
+
+/** MRUHistoWorkspace is the common base of histogram workspaces whose
+  spectra do not hold their Y and E data as double precision vectors, but
+  provide them on access and keep them in an MRU as done by EventWorkspace.
+
+  SpectrumType must be an ISpectrum providing a constructor taking the X and
+  Y modes, a copy constructor, setMRU(EventWorkspaceMRU *) and size(). The
+  template is explicitly instantiated for FloatHistogram1D and
+  FileBackedHistogram1D.
+*/
+template <class SpectrumType>
+class MANTID_DATAOBJECTS_DLL MRUHistoWorkspace : public API::HistoWorkspace {
+public:
+  MRUHistoWorkspace(const Parallel::StorageMode storageMode);
+  MRUHistoWorkspace &operator=(const MRUHistoWorkspace &other) = delete;
+  ~MRUHistoWorkspace() override;
+
+  bool isRaggedWorkspace() const override;
+  /// Children hold their data in memory in double precision
+  bool childrenAreWorkspace2D() const override { return true; }
+  std::size_t size() const override;
+  std::size_t blocksize() const override;
+  std::size_t getNumberBins(const std::size_t &index) const override;
+  std::size_t getMaxNumberBins() const override;
+  std::size_t getNumberHistograms() const override;
+  size_t getMemorySize() const override;
+
+  SpectrumType &getSpectrum(const size_t index) override {
+    invalidateCommonBinsFlag();
+    return getSpectrumWithoutInvalidation(index);
+  }
+  const SpectrumType &getSpectrum(const size_t index) const override;
+
+  void generateHistogram(const std::size_t index, const MantidVec &X,
+                         MantidVec &Y, MantidVec &E,
+                         bool skipError = false) const override;
+
+  void clearMRU() const;
+
+protected:
+  MRUHistoWorkspace(const MRUHistoWorkspace &other);
+
+  void init(const std::size_t &NVectors, const std::size_t &XLength,
+            const std::size_t &YLength) override;
+  void init(const HistogramData::Histogram &histogram) override;
+
+  /// The spectra
+  std::vector<std::unique_ptr<SpectrumType>> m_data;
+
+private:
+  SpectrumType &getSpectrumWithoutInvalidation(const size_t index) override;
+
+  /// The MRU holding the Y and E data provided by the spectra
+  std::unique_ptr<EventWorkspaceMRU> m_mru;
+};
+
+EXTERN_MANTID_DATAOBJECTS template class MANTID_DATAOBJECTS_DLL
+    MRUHistoWorkspace<FloatHistogram1D>;
+EXTERN_MANTID_DATAOBJECTS template class MANTID_DATAOBJECTS_DLL
+    MRUHistoWorkspace<FileBackedHistogram1D>;
+
+} // namespace DataObjects
+} // namespace Mantid
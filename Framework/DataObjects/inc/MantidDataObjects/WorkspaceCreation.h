@@ -111,6 +111,17 @@ MANTID_DATAOBJECTS_DLL std::unique_ptr<EventWorkspace> createHelper();
 template <>
 MANTID_DATAOBJECTS_DLL std::unique_ptr<API::MatrixWorkspace> createHelper();
 
+template <class T> std::unique_ptr<T> createDoublePrecisionHelper() {
+  return {nullptr};
+}
+
+template <>
+MANTID_DATAOBJECTS_DLL std::unique_ptr<API::HistoWorkspace>
+createDoublePrecisionHelper();
+template <>
+MANTID_DATAOBJECTS_DLL std::unique_ptr<API::MatrixWorkspace>
+createDoublePrecisionHelper();
+
 // Dummy specialization, should never be called, must exist for compilation.
 template <>
 MANTID_DATAOBJECTS_DLL std::unique_ptr<API::MatrixWorkspace>
@@ -155,12 +166,18 @@ std::unique_ptr<T> create(const P &parent, const IndexArg &indexArg,
     // Drop events, create Workspace2D or T whichever is more derived.
     ws = detail::createHelper<T>();
   } else {
-    try {
-      // If parent is more derived than T: create type(parent)
-      ws = dynamic_cast<const T &>(parent).cloneEmpty();
-    } catch (std::bad_cast &) {
-      // If T is more derived than parent: create T
-      ws = detail::createConcreteHelper<T>();
+    // Children of single precision or file backed workspaces are in-memory
+    // double precision, unless T requests otherwise.
+    if (parent.childrenAreWorkspace2D())
+      ws = detail::createDoublePrecisionHelper<T>();
+    if (!ws) {
+      try {
+        // If parent is more derived than T: create type(parent)
+        ws = dynamic_cast<const T &>(parent).cloneEmpty();
+      } catch (std::bad_cast &) {
+        // If T is more derived than parent: create T
+        ws = detail::createConcreteHelper<T>();
+      }
     }
   }
 
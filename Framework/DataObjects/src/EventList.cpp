@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventList.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/MemoryUsage.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidKernel/DateAndTime.h"
@@ -18,11 +19,13 @@
 // qualifier applied to function type has no meaning; ignored
 #pragma warning(disable : 4180)
 #endif
+#include "tbb/parallel_invoke.h"
 #include "tbb/parallel_sort.h"
 #ifdef _MSC_VER
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -44,6 +47,43 @@ namespace {
 
 const double SEC_TO_NANO = 1.e9;
 
+/**
+ * Merge consecutive sorted runs of events with a tree of pairwise merges.
+ * The two halves of the tree are merged concurrently.
+ * @param events :: the events containing the runs
+ * @param runBounds :: the index of the first event of each run, followed by
+ * the number of events
+ * @param first :: the first run to merge
+ * @param last :: one past the last run to merge
+ */
+template <class T>
+void mergeSortedRuns(std::vector<T> &events,
+                     const std::vector<size_t> &runBounds, const size_t first,
+                     const size_t last) {
+  if (last - first < 2)
+    return;
+  const size_t middle = first + (last - first) / 2;
+  tbb::parallel_invoke(
+      [&] { mergeSortedRuns(events, runBounds, first, middle); },
+      [&] { mergeSortedRuns(events, runBounds, middle, last); });
+  std::inplace_merge(events.begin() + runBounds[first],
+                     events.begin() + runBounds[middle],
+                     events.begin() + runBounds[last]);
+}
+
+/**
+ * Sort events made of consecutive runs that are each sorted
+ * @param events :: the events to sort
+ * @param runStarts :: the index of the first event of each run
+ */
+template <class T>
+void sortFromRuns(std::vector<T> &events,
+                  const std::vector<size_t> &runStarts) {
+  std::vector<size_t> runBounds(runStarts);
+  runBounds.emplace_back(events.size());
+  mergeSortedRuns(events, runBounds, 0, runStarts.size());
+}
+
 /**
  * Calculate the corrected full time in nanoseconds
  * @param event : The event with pulse time and time-of-flight
@@ -1019,6 +1059,35 @@ void EventList::sortTof() const {
   this->order = TOF_SORT;
 }
 
+// --------------------------------------------------------------------------
+/** Sort events by TOF when they consist of consecutive runs that are each
+ * sorted by TOF, e.g. after appending TOF sorted event lists. The runs are
+ * merged pairwise, which takes O(N log(runs)) rather than O(N log N).
+ * @param runStarts :: the index of the first event of each run, in
+ * increasing order and starting with 0
+ */
+void EventList::sortTofFromRuns(const std::vector<size_t> &runStarts) const {
+  if (this->order == TOF_SORT)
+    return; // nothing to do
+
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  if (this->order == TOF_SORT)
+    return;
+
+  switch (eventType) {
+  case TOF:
+    sortFromRuns(events, runStarts);
+    break;
+  case WEIGHTED:
+    sortFromRuns(weightedEvents, runStarts);
+    break;
+  case WEIGHTED_NOTIME:
+    sortFromRuns(weightedEventsNoTime, runStarts);
+    break;
+  }
+  this->order = TOF_SORT;
+}
+
 // --------------------------------------------------------------------------
 /**
  * Sort events by time at sample
@@ -1247,6 +1316,17 @@ size_t EventList::getMemorySize() const {
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
 
+// --------------------------------------------------------------------------
+/** Add the memory used by the events and the X data of this list. The
+ * histogrammed Y and E data held in the MRU is not counted.
+ * @param usage :: the memory usage to add to
+ */
+void EventList::addMemoryUsage(API::MemoryUsage &usage) const {
+  ISpectrum::addMemoryUsage(usage);
+  usage.add(API::MemoryUsage::Data::Events, this,
+            getMemorySize() - sizeof(EventList), false);
+}
+
 // --------------------------------------------------------------------------
 /** Return the size of the histogram data.
  * @return the size of the histogram representation of the data (size of Y) **/
@@ -90,7 +90,7 @@ void EventWorkspaceMRU::clear() {
  * @return pointer to the TypeWithMarker that has the data; NULL if not found.
  */
 Kernel::cow_ptr<HistogramData::HistogramY>
-EventWorkspaceMRU::findY(size_t thread_num, const EventList *index) {
+EventWorkspaceMRU::findY(size_t thread_num, const API::ISpectrum *index) {
   Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
   auto result = m_bufferedDataY[thread_num]->find(
       reinterpret_cast<std::uintptr_t>(index));
@@ -106,7 +106,7 @@ EventWorkspaceMRU::findY(size_t thread_num, const EventList *index) {
  * @return pointer to the TypeWithMarker that has the data; NULL if not found.
  */
 Kernel::cow_ptr<HistogramData::HistogramE>
-EventWorkspaceMRU::findE(size_t thread_num, const EventList *index) {
+EventWorkspaceMRU::findE(size_t thread_num, const API::ISpectrum *index) {
   Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
   auto result = m_bufferedDataE[thread_num]->find(
       reinterpret_cast<std::uintptr_t>(index));
@@ -122,7 +122,7 @@ EventWorkspaceMRU::findE(size_t thread_num, const EventList *index) {
  * @param index :: index of the data to insert
  */
 void EventWorkspaceMRU::insertY(size_t thread_num, YType data,
-                                const EventList *index) {
+                                const API::ISpectrum *index) {
   Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
   auto yWithMarker = std::make_shared<TypeWithMarker<YType>>(
       reinterpret_cast<std::uintptr_t>(index));
@@ -138,7 +138,7 @@ void EventWorkspaceMRU::insertY(size_t thread_num, YType data,
  * @param index :: index of the data to insert
  */
 void EventWorkspaceMRU::insertE(size_t thread_num, EType data,
-                                const EventList *index) {
+                                const API::ISpectrum *index) {
   Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
   auto eWithMarker = std::make_shared<TypeWithMarker<EType>>(
       reinterpret_cast<std::uintptr_t>(index));
@@ -151,7 +151,7 @@ void EventWorkspaceMRU::insertE(size_t thread_num, EType data,
  *
  * @param index :: index to delete.
  */
-void EventWorkspaceMRU::deleteIndex(const EventList *index) {
+void EventWorkspaceMRU::deleteIndex(const API::ISpectrum *index) {
   {
     Poco::ScopedReadRWLock _lock1(m_changeMruListsMutexE);
     for (auto &data : m_bufferedDataE) {
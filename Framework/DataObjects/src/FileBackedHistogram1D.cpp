@@ -0,0 +1,386 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/FileBackedHistogram1D.h"
+#include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidDataObjects/Histogram1D.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <Poco/Path.h>
+#include <boost/filesystem.hpp>
+
+// clang-format off
+#include <nexus/NeXusFile.hpp>
+#include <nexus/NeXusException.hpp>
+// clang-format on
+
+namespace Mantid {
+namespace DataObjects {
+
+//----------------------------------------------------------------------------
+// FileBackedHistogramSource
+//----------------------------------------------------------------------------
+/**
+ * @param filename :: The full path to the processed NeXus file
+ * @param groupPath :: The path of the group holding the values and errors,
+ * e.g. /mantid_workspace_1/workspace
+ */
+FileBackedHistogramSource::FileBackedHistogramSource(
+    const std::string &filename, const std::string &groupPath)
+    : m_filename(canonicalPath(filename)), m_groupPath(groupPath) {}
+
+FileBackedHistogramSource::~FileBackedHistogramSource() = default;
+
+/** Returns the absolute path of a file with symbolic links, "." and ".."
+ * resolved, such that different paths to the same file compare equal. If the
+ * file does not exist the path is only made absolute.
+ * @param filename :: The path of the file
+ */
+std::string
+FileBackedHistogramSource::canonicalPath(const std::string &filename) {
+  boost::system::error_code error;
+  const auto path = boost::filesystem::canonical(filename, error);
+  if (error)
+    return Poco::Path(filename).makeAbsolute().toString();
+  return path.string();
+}
+
+/** Read the values and errors of a single spectrum.
+ * @param row :: The index of the spectrum in the file
+ * @param y :: Output, the values
+ * @param e :: Output, the errors
+ */
+void FileBackedHistogramSource::read(const size_t row, std::vector<double> &y,
+                                     std::vector<double> &e) const {
+  std::lock_guard<std::mutex> _lock(m_fileMutex);
+  try {
+    if (!m_file) {
+      m_file = std::make_unique<::NeXus::File>(m_filename);
+      m_file->openPath(m_groupPath);
+    }
+    readRow("values", row, y);
+    readRow("errors", row, e);
+  } catch (::NeXus::Exception &exc) {
+    m_file.reset();
+    throw Kernel::Exception::FileError(
+        "Unable to read spectrum " + std::to_string(row) + ": " + exc.what(),
+        m_filename);
+  }
+}
+
+/// Read one row of the 2D dataset name in the open group
+void FileBackedHistogramSource::readRow(const std::string &name,
+                                        const size_t row,
+                                        std::vector<double> &data) const {
+  m_file->openData(name);
+  const auto info = m_file->getInfo();
+  if (info.dims.size() != 2) {
+    m_file->closeData();
+    throw std::runtime_error("Dataset " + name + " is not two dimensional");
+  }
+  const std::vector<int64_t> start{static_cast<int64_t>(row), 0};
+  const std::vector<int64_t> size{1, info.dims[1]};
+  data.resize(static_cast<size_t>(info.dims[1]));
+  m_file->getSlab(data.data(), start, size);
+  m_file->closeData();
+}
+
+//----------------------------------------------------------------------------
+// FileBackedHistogram1D
+//----------------------------------------------------------------------------
+FileBackedHistogram1D::FileBackedHistogram1D(
+    HistogramData::Histogram::XMode xmode,
+    HistogramData::Histogram::YMode ymode, EventWorkspaceMRU *mru)
+    : API::ISpectrum(), m_histogram(xmode, ymode), m_mru(mru) {
+  if (ymode == HistogramData::Histogram::YMode::Counts) {
+    m_histogram.setCounts(0);
+    m_histogram.setCountStandardDeviations(0);
+  } else if (ymode == HistogramData::Histogram::YMode::Frequencies) {
+    m_histogram.setFrequencies(0);
+    m_histogram.setFrequencyStandardDeviations(0);
+  } else {
+    throw std::logic_error(
+        "FileBackedHistogram1D: YMode must be Counts or Frequencies");
+  }
+}
+
+/// Copy constructor. The MRU is not copied, the new spectrum has none.
+FileBackedHistogram1D::FileBackedHistogram1D(
+    const FileBackedHistogram1D &other)
+    : API::ISpectrum(other), m_histogram(other.m_histogram),
+      m_source(other.m_source), m_row(other.m_row), m_mru(nullptr) {}
+
+/** Sets the MRU list for this spectrum
+ * @param mru :: the MRU of the workspace containing this spectrum
+ */
+void FileBackedHistogram1D::setMRU(EventWorkspaceMRU *mru) { m_mru = mru; }
+
+/** Drop Y and E from memory and read them from a file on access instead. The
+ * number of values in the file must match the size of the X data.
+ * @param source :: the file holding the data
+ * @param row :: the index of this spectrum in the file
+ */
+void FileBackedHistogram1D::setFileBacking(
+    std::shared_ptr<const FileBackedHistogramSource> source,
+    const size_t row) {
+  invalidateMRU();
+  m_source = std::move(source);
+  m_row = row;
+  m_histogram.setSharedY(nullptr);
+  m_histogram.setSharedE(nullptr);
+}
+
+void FileBackedHistogram1D::copyDataFrom(const ISpectrum &source) {
+  setHistogram(source.histogram());
+}
+
+void FileBackedHistogram1D::copyDataInto(Histogram1D &sink) const {
+  sink.setHistogram(histogram());
+}
+
+void FileBackedHistogram1D::setX(
+    const Kernel::cow_ptr<HistogramData::HistogramX> &X) {
+  loadIntoMemory();
+  m_histogram.setX(X);
+}
+
+MantidVec &FileBackedHistogram1D::dataX() {
+  loadIntoMemory();
+  return m_histogram.dataX();
+}
+
+const MantidVec &FileBackedHistogram1D::dataX() const {
+  return m_histogram.dataX();
+}
+
+const MantidVec &FileBackedHistogram1D::readX() const {
+  return m_histogram.readX();
+}
+
+Kernel::cow_ptr<HistogramData::HistogramX> FileBackedHistogram1D::ptrX() const {
+  return m_histogram.ptrX();
+}
+
+MantidVec &FileBackedHistogram1D::dataDx() { return m_histogram.dataDx(); }
+
+const MantidVec &FileBackedHistogram1D::dataDx() const {
+  return m_histogram.dataDx();
+}
+
+const MantidVec &FileBackedHistogram1D::readDx() const {
+  return m_histogram.readDx();
+}
+
+/// Zero the data (Y&E) in this spectrum, without reading it from the file
+void FileBackedHistogram1D::clearData() {
+  if (m_source) {
+    invalidateMRU();
+    m_source.reset();
+    m_histogram.setSharedY(
+        Kernel::make_cow<HistogramData::HistogramY>(m_histogram.size(), 0.0));
+    m_histogram.setSharedE(
+        Kernel::make_cow<HistogramData::HistogramE>(m_histogram.size(), 0.0));
+    return;
+  }
+  auto &yValues = m_histogram.dataY();
+  std::fill(yValues.begin(), yValues.end(), 0.0);
+  auto &eValues = m_histogram.dataE();
+  std::fill(eValues.begin(), eValues.end(), 0.0);
+}
+
+MantidVec &FileBackedHistogram1D::dataY() {
+  loadIntoMemory();
+  return m_histogram.dataY();
+}
+
+MantidVec &FileBackedHistogram1D::dataE() {
+  loadIntoMemory();
+  return m_histogram.dataE();
+}
+
+/// Deprecated, use y() instead. Returns the y data const
+const MantidVec &FileBackedHistogram1D::dataY() const { return y().rawData(); }
+
+/// Deprecated, use e() instead. Returns the error data const
+const MantidVec &FileBackedHistogram1D::dataE() const { return e().rawData(); }
+
+/// Gets the memory size of the data held in memory, excluding the MRU
+size_t FileBackedHistogram1D::getMemorySize() const {
+  size_t total = readX().size() * sizeof(double);
+  if (!m_source)
+    total += (m_histogram.y().size() + m_histogram.e().size()) * sizeof(double);
+  return total + sizeof(FileBackedHistogram1D);
+}
+
+/// Returns the Histogram, reading Y and E if necessary.
+HistogramData::Histogram FileBackedHistogram1D::histogram() const {
+  if (!m_source)
+    return m_histogram;
+  HistogramData::Histogram result(m_histogram);
+  result.setSharedY(sharedY());
+  result.setSharedE(sharedE());
+  return result;
+}
+
+HistogramData::Counts FileBackedHistogram1D::counts() const {
+  return histogram().counts();
+}
+
+HistogramData::CountVariances FileBackedHistogram1D::countVariances() const {
+  return histogram().countVariances();
+}
+
+HistogramData::CountStandardDeviations
+FileBackedHistogram1D::countStandardDeviations() const {
+  return histogram().countStandardDeviations();
+}
+
+HistogramData::Frequencies FileBackedHistogram1D::frequencies() const {
+  return histogram().frequencies();
+}
+
+HistogramData::FrequencyVariances
+FileBackedHistogram1D::frequencyVariances() const {
+  return histogram().frequencyVariances();
+}
+
+HistogramData::FrequencyStandardDeviations
+FileBackedHistogram1D::frequencyStandardDeviations() const {
+  return histogram().frequencyStandardDeviations();
+}
+
+const HistogramData::HistogramY &FileBackedHistogram1D::y() const {
+  if (!m_source)
+    return m_histogram.y();
+  if (!m_mru)
+    throw std::runtime_error("'FileBackedHistogram1D::y()' called with no MRU "
+                             "set. This is not allowed.");
+  // The data read from file is stored in the MRU, returning a reference is
+  // fine as long as it stays there.
+  return *sharedY();
+}
+
+const HistogramData::HistogramE &FileBackedHistogram1D::e() const {
+  if (!m_source)
+    return m_histogram.e();
+  if (!m_mru)
+    throw std::runtime_error("'FileBackedHistogram1D::e()' called with no MRU "
+                             "set. This is not allowed.");
+  return *sharedE();
+}
+
+Kernel::cow_ptr<HistogramData::HistogramY>
+FileBackedHistogram1D::sharedY() const {
+  if (!m_source)
+    return m_histogram.sharedY();
+  const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+  Kernel::cow_ptr<HistogramData::HistogramY> yData(nullptr);
+  if (m_mru) {
+    m_mru->ensureEnoughBuffersY(thread);
+    yData = m_mru->findY(thread, this);
+  }
+  if (!yData) {
+    Kernel::cow_ptr<HistogramData::HistogramE> eData(nullptr);
+    readFromFile(yData, eData);
+  }
+  return yData;
+}
+
+Kernel::cow_ptr<HistogramData::HistogramE>
+FileBackedHistogram1D::sharedE() const {
+  if (!m_source)
+    return m_histogram.sharedE();
+  const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+  Kernel::cow_ptr<HistogramData::HistogramE> eData(nullptr);
+  if (m_mru) {
+    m_mru->ensureEnoughBuffersE(thread);
+    eData = m_mru->findE(thread, this);
+  }
+  if (!eData) {
+    Kernel::cow_ptr<HistogramData::HistogramY> yData(nullptr);
+    readFromFile(yData, eData);
+  }
+  return eData;
+}
+
+/** Drops the file backing if a complete histogram is set, so the data in the
+ * file is never read.
+ * @param histogram :: the histogram being set
+ */
+void FileBackedHistogram1D::checkAndSanitizeHistogram(
+    HistogramData::Histogram &histogram) {
+  if (!histogram.sharedY()) {
+    throw std::invalid_argument(
+        "FileBackedHistogram1D: invalid input: Y data set to nullptr");
+  }
+  if (!histogram.sharedE()) {
+    throw std::invalid_argument(
+        "FileBackedHistogram1D: invalid input: E data set to nullptr");
+  }
+  invalidateMRU();
+  m_source.reset();
+}
+
+/// Y and E are always writable, this loads them into memory first.
+void FileBackedHistogram1D::checkIsYAndEWritable() const {
+  // Called by the non-const accessors of ISpectrum only, before they modify
+  // the data, so the object is never really const here.
+  const_cast<FileBackedHistogram1D *>(this)->loadIntoMemory();
+}
+
+/// Loads Y and E into memory before returning the histogram for modification
+HistogramData::Histogram &FileBackedHistogram1D::mutableHistogramRef() {
+  loadIntoMemory();
+  return m_histogram;
+}
+
+/** Read Y and E from the file and store them in the MRU.
+ * @param y :: Output, the Y data
+ * @param e :: Output, the E data
+ */
+void FileBackedHistogram1D::readFromFile(
+    Kernel::cow_ptr<HistogramData::HistogramY> &y,
+    Kernel::cow_ptr<HistogramData::HistogramE> &e) const {
+  std::vector<double> yValues;
+  std::vector<double> eValues;
+  m_source->read(m_row, yValues, eValues);
+  if (yValues.size() != m_histogram.size() ||
+      eValues.size() != m_histogram.size())
+    throw std::runtime_error("FileBackedHistogram1D: the size of the data in " +
+                             m_source->filename() +
+                             " does not match the X data");
+  y = Kernel::make_cow<HistogramData::HistogramY>(std::move(yValues));
+  e = Kernel::make_cow<HistogramData::HistogramE>(std::move(eValues));
+  if (m_mru) {
+    const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+    m_mru->ensureEnoughBuffersY(thread);
+    m_mru->ensureEnoughBuffersE(thread);
+    m_mru->insertY(thread, y, this);
+    m_mru->insertE(thread, e, this);
+  }
+}
+
+/// Read Y and E from the file and keep them in this spectrum
+void FileBackedHistogram1D::loadIntoMemory() {
+  if (!m_source)
+    return;
+  const auto yData = sharedY();
+  const auto eData = sharedE();
+  invalidateMRU();
+  m_source.reset();
+  m_histogram.setSharedY(yData);
+  m_histogram.setSharedE(eData);
+}
+
+/// Remove the data of this spectrum from the MRU
+void FileBackedHistogram1D::invalidateMRU() const {
+  if (m_mru)
+    m_mru->deleteIndex(this);
+}
+
+} // namespace DataObjects
+} // namespace Mantid
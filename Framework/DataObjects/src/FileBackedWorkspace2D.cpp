@@ -0,0 +1,70 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
+#include "MantidAPI/WorkspaceFactory.h"
+
+#include <algorithm>
+
+namespace Mantid {
+namespace DataObjects {
+
+DECLARE_WORKSPACE(FileBackedWorkspace2D)
+
+FileBackedWorkspace2D::FileBackedWorkspace2D(
+    const Parallel::StorageMode storageMode)
+    : MRUHistoWorkspace<FileBackedHistogram1D>(storageMode) {}
+
+/** Read the Y and E data of all spectra from a file on access instead of
+ * holding them in memory. X and Dx must already be set.
+ * @param source :: the file holding the data
+ * @param rows :: the index in the file of each spectrum in the workspace
+ */
+void FileBackedWorkspace2D::setFileBacking(
+    std::shared_ptr<const FileBackedHistogramSource> source,
+    const std::vector<size_t> &rows) {
+  if (rows.size() != m_data.size())
+    throw std::invalid_argument("FileBackedWorkspace2D::setFileBacking: the "
+                                "number of rows does not match the number of "
+                                "spectra");
+  for (size_t i = 0; i < m_data.size(); ++i)
+    m_data[i]->setFileBacking(source, rows[i]);
+}
+
+/// Returns the number of spectra whose Y and E are not loaded into memory
+size_t FileBackedWorkspace2D::numberOfFileBackedSpectra() const {
+  return std::count_if(m_data.cbegin(), m_data.cend(), [](const auto &spec) {
+    return spec->isFileBacked();
+  });
+}
+
+/** Load the Y and E data of the spectra read from a given file into memory,
+ * so the workspace does not depend on that file any more.
+ * @param filename :: the path of the file
+ * @return the number of spectra loaded into memory
+ */
+size_t FileBackedWorkspace2D::loadIntoMemory(const std::string &filename) {
+  const auto path = FileBackedHistogramSource::canonicalPath(filename);
+  size_t loaded = 0;
+  for (auto &spec : m_data) {
+    if (spec->isFileBackedBy(path)) {
+      spec->loadIntoMemory();
+      ++loaded;
+    }
+  }
+  return loaded;
+}
+
+FileBackedWorkspace2D *FileBackedWorkspace2D::doClone() const {
+  return new FileBackedWorkspace2D(*this);
+}
+
+FileBackedWorkspace2D *FileBackedWorkspace2D::doCloneEmpty() const {
+  return new FileBackedWorkspace2D(storageMode());
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -0,0 +1,273 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/FloatHistogram1D.h"
+#include "MantidAPI/MemoryUsage.h"
+#include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidDataObjects/Histogram1D.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+template <class T>
+void storeAsFloat(const T &source, std::vector<float> &destination) {
+  destination.resize(source.size());
+  std::transform(source.cbegin(), source.cend(), destination.begin(),
+                 [](const double value) { return static_cast<float>(value); });
+}
+} // namespace
+
+FloatHistogram1D::FloatHistogram1D(HistogramData::Histogram::XMode xmode,
+                                   HistogramData::Histogram::YMode ymode,
+                                   EventWorkspaceMRU *mru)
+    : API::ISpectrum(), m_histogram(xmode, ymode), m_mru(mru) {
+  if (ymode != HistogramData::Histogram::YMode::Counts &&
+      ymode != HistogramData::Histogram::YMode::Frequencies)
+    throw std::logic_error(
+        "FloatHistogram1D: YMode must be Counts or Frequencies");
+}
+
+/// Copy constructor. The MRU is not copied, the new spectrum has none.
+FloatHistogram1D::FloatHistogram1D(const FloatHistogram1D &other)
+    : API::ISpectrum(other), m_histogram(other.m_histogram), m_y(other.m_y),
+      m_e(other.m_e), m_mru(nullptr) {}
+
+/** Sets the MRU list for this spectrum
+ * @param mru :: the MRU of the workspace containing this spectrum
+ */
+void FloatHistogram1D::setMRU(EventWorkspaceMRU *mru) { m_mru = mru; }
+
+void FloatHistogram1D::copyDataFrom(const ISpectrum &source) {
+  setHistogram(source.histogram());
+}
+
+void FloatHistogram1D::copyDataInto(Histogram1D &sink) const {
+  sink.setHistogram(histogram());
+}
+
+void FloatHistogram1D::setX(
+    const Kernel::cow_ptr<HistogramData::HistogramX> &X) {
+  m_histogram.setX(X);
+}
+
+MantidVec &FloatHistogram1D::dataX() { return m_histogram.dataX(); }
+
+const MantidVec &FloatHistogram1D::dataX() const {
+  return m_histogram.dataX();
+}
+
+const MantidVec &FloatHistogram1D::readX() const {
+  return m_histogram.readX();
+}
+
+Kernel::cow_ptr<HistogramData::HistogramX> FloatHistogram1D::ptrX() const {
+  return m_histogram.ptrX();
+}
+
+MantidVec &FloatHistogram1D::dataDx() { return m_histogram.dataDx(); }
+
+const MantidVec &FloatHistogram1D::dataDx() const {
+  return m_histogram.dataDx();
+}
+
+const MantidVec &FloatHistogram1D::readDx() const {
+  return m_histogram.readDx();
+}
+
+/// Zero the data (Y&E) in this spectrum
+void FloatHistogram1D::clearData() {
+  if (isSinglePrecision()) {
+    std::fill(m_y.begin(), m_y.end(), 0.0f);
+    std::fill(m_e.begin(), m_e.end(), 0.0f);
+    invalidateMRU();
+    return;
+  }
+  auto &yValues = m_histogram.dataY();
+  std::fill(yValues.begin(), yValues.end(), 0.0);
+  auto &eValues = m_histogram.dataE();
+  std::fill(eValues.begin(), eValues.end(), 0.0);
+}
+
+MantidVec &FloatHistogram1D::dataY() {
+  loadIntoMemory();
+  return m_histogram.dataY();
+}
+
+MantidVec &FloatHistogram1D::dataE() {
+  loadIntoMemory();
+  return m_histogram.dataE();
+}
+
+/// Deprecated, use y() instead. Returns the y data const
+const MantidVec &FloatHistogram1D::dataY() const { return y().rawData(); }
+
+/// Deprecated, use e() instead. Returns the error data const
+const MantidVec &FloatHistogram1D::dataE() const { return e().rawData(); }
+
+/// Gets the memory size of Y and E, excluding X and data held in the MRU
+size_t FloatHistogram1D::getMemorySize() const {
+  size_t total = (m_y.capacity() + m_e.capacity()) * sizeof(float);
+  if (!isSinglePrecision())
+    total += (m_histogram.y().size() + m_histogram.e().size()) * sizeof(double);
+  return total + sizeof(FloatHistogram1D);
+}
+
+/// Add the memory used by the single precision Y and E and the X data
+void FloatHistogram1D::addMemoryUsage(API::MemoryUsage &usage) const {
+  ISpectrum::addMemoryUsage(usage);
+  usage.add(API::MemoryUsage::Data::Y, &m_y, m_y.capacity() * sizeof(float),
+            false);
+  usage.add(API::MemoryUsage::Data::E, &m_e, m_e.capacity() * sizeof(float),
+            false);
+}
+
+/// Returns the Histogram with Y and E converted to double precision.
+HistogramData::Histogram FloatHistogram1D::histogram() const {
+  if (!isSinglePrecision())
+    return m_histogram;
+  HistogramData::Histogram result(m_histogram);
+  result.setSharedY(sharedY());
+  result.setSharedE(sharedE());
+  return result;
+}
+
+HistogramData::Counts FloatHistogram1D::counts() const {
+  return histogram().counts();
+}
+
+HistogramData::CountVariances FloatHistogram1D::countVariances() const {
+  return histogram().countVariances();
+}
+
+HistogramData::CountStandardDeviations
+FloatHistogram1D::countStandardDeviations() const {
+  return histogram().countStandardDeviations();
+}
+
+HistogramData::Frequencies FloatHistogram1D::frequencies() const {
+  return histogram().frequencies();
+}
+
+HistogramData::FrequencyVariances
+FloatHistogram1D::frequencyVariances() const {
+  return histogram().frequencyVariances();
+}
+
+HistogramData::FrequencyStandardDeviations
+FloatHistogram1D::frequencyStandardDeviations() const {
+  return histogram().frequencyStandardDeviations();
+}
+
+const HistogramData::HistogramY &FloatHistogram1D::y() const {
+  if (!isSinglePrecision())
+    return m_histogram.y();
+  if (!m_mru)
+    throw std::runtime_error(
+        "'FloatHistogram1D::y()' called with no MRU set. This is not allowed.");
+  // The converted data is stored in the MRU, returning a reference is fine
+  // as long as it stays there.
+  return *sharedY();
+}
+
+const HistogramData::HistogramE &FloatHistogram1D::e() const {
+  if (!isSinglePrecision())
+    return m_histogram.e();
+  if (!m_mru)
+    throw std::runtime_error(
+        "'FloatHistogram1D::e()' called with no MRU set. This is not allowed.");
+  return *sharedE();
+}
+
+Kernel::cow_ptr<HistogramData::HistogramY> FloatHistogram1D::sharedY() const {
+  if (!isSinglePrecision())
+    return m_histogram.sharedY();
+  const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+  Kernel::cow_ptr<HistogramData::HistogramY> yData(nullptr);
+  if (m_mru) {
+    m_mru->ensureEnoughBuffersY(thread);
+    yData = m_mru->findY(thread, this);
+  }
+  if (!yData) {
+    yData = Kernel::make_cow<HistogramData::HistogramY>(m_y.cbegin(),
+                                                        m_y.cend());
+    if (m_mru)
+      m_mru->insertY(thread, yData, this);
+  }
+  return yData;
+}
+
+Kernel::cow_ptr<HistogramData::HistogramE> FloatHistogram1D::sharedE() const {
+  if (!isSinglePrecision())
+    return m_histogram.sharedE();
+  const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+  Kernel::cow_ptr<HistogramData::HistogramE> eData(nullptr);
+  if (m_mru) {
+    m_mru->ensureEnoughBuffersE(thread);
+    eData = m_mru->findE(thread, this);
+  }
+  if (!eData) {
+    eData = Kernel::make_cow<HistogramData::HistogramE>(m_e.cbegin(),
+                                                        m_e.cend());
+    if (m_mru)
+      m_mru->insertE(thread, eData, this);
+  }
+  return eData;
+}
+
+/** Store the Y and E data of a histogram that is about to be set in single
+ * precision and remove it from the histogram. Missing Y or E data is set to
+ * zero.
+ * @param histogram :: the histogram being set
+ */
+void FloatHistogram1D::checkAndSanitizeHistogram(
+    HistogramData::Histogram &histogram) {
+  if (histogram.yMode() == HistogramData::Histogram::YMode::Uninitialized)
+    histogram.setYMode(m_histogram.yMode());
+  if (histogram.sharedY())
+    storeAsFloat(histogram.y(), m_y);
+  else
+    m_y.assign(histogram.size(), 0.0f);
+  if (histogram.sharedE())
+    storeAsFloat(histogram.e(), m_e);
+  else
+    m_e.assign(histogram.size(), 0.0f);
+  histogram.setSharedY(nullptr);
+  histogram.setSharedE(nullptr);
+  invalidateMRU();
+}
+
+/// Y and E are always writable, this loads them into memory first.
+void FloatHistogram1D::checkIsYAndEWritable() const {
+  // Called by the non-const accessors of ISpectrum only, before they modify
+  // the data, so the object is never really const here.
+  const_cast<FloatHistogram1D *>(this)->loadIntoMemory();
+}
+
+/// Convert Y and E to double precision and keep them in this spectrum
+void FloatHistogram1D::loadIntoMemory() {
+  if (!isSinglePrecision())
+    return;
+  invalidateMRU();
+  m_histogram.setSharedY(
+      Kernel::make_cow<HistogramData::HistogramY>(m_y.cbegin(), m_y.cend()));
+  m_histogram.setSharedE(
+      Kernel::make_cow<HistogramData::HistogramE>(m_e.cbegin(), m_e.cend()));
+  std::vector<float>().swap(m_y);
+  std::vector<float>().swap(m_e);
+}
+
+/// Remove the converted data of this spectrum from the MRU
+void FloatHistogram1D::invalidateMRU() const {
+  if (m_mru)
+    m_mru->deleteIndex(this);
+}
+
+} // namespace DataObjects
+} // namespace Mantid
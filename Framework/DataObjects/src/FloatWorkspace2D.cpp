@@ -0,0 +1,27 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/FloatWorkspace2D.h"
+#include "MantidAPI/WorkspaceFactory.h"
+
+namespace Mantid {
+namespace DataObjects {
+
+DECLARE_WORKSPACE(FloatWorkspace2D)
+
+FloatWorkspace2D::FloatWorkspace2D(const Parallel::StorageMode storageMode)
+    : MRUHistoWorkspace<FloatHistogram1D>(storageMode) {}
+
+FloatWorkspace2D *FloatWorkspace2D::doClone() const {
+  return new FloatWorkspace2D(*this);
+}
+
+FloatWorkspace2D *FloatWorkspace2D::doCloneEmpty() const {
+  return new FloatWorkspace2D(storageMode());
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -7,7 +7,6 @@
 #include "MantidDataObjects/FractionalRebinning.h"
 
 #include "MantidAPI/Progress.h"
-#include "MantidGeometry/Math/ConvexPolygon.h"
 #include "MantidGeometry/Math/PolygonIntersection.h"
 #include "MantidGeometry/Math/Quadrilateral.h"
 #include "MantidKernel/V2D.h"
@@ -317,7 +316,6 @@ void calcTrapezoidYIntersections(const std::vector<double> &xAxis,
   // Step 2 - loop over x, creating one-bin wide strips
   V2D nll(ll), nul(ul), nur, nlr, l0, r0, l1, r1;
   double area(0.);
-  ConvexPolygon poly;
   areaInfos.reserve(nx * ny);
   size_t yj0, yj1;
   for (size_t xi = x_start; xi < x_end; ++xi) {
@@ -471,18 +469,14 @@ void calcGeneralIntersections(const std::vector<double> &xAxis,
                               const size_t qend, const size_t x_start,
                               const size_t x_end,
                               std::vector<AreaInfo> &areaInfos) {
-  ConvexPolygon intersectOverlap;
+  RectangleOverlap overlap;
   areaInfos.reserve((qend - qstart) * (x_end - x_start));
   for (size_t yi = qstart; yi < qend; ++yi) {
     const double vlo = yAxis[yi];
     const double vhi = yAxis[yi + 1];
     for (size_t xi = x_start; xi < x_end; ++xi) {
-      intersectOverlap.clear();
-      if (intersection(
-              Quadrilateral(V2D(xAxis[xi], vlo), V2D(xAxis[xi + 1], vlo),
-                            V2D(xAxis[xi + 1], vhi), V2D(xAxis[xi], vhi)),
-              inputQ, intersectOverlap)) {
-        areaInfos.emplace_back(xi, yi, intersectOverlap.area());
+      if (intersection(inputQ, xAxis[xi], xAxis[xi + 1], vlo, vhi, overlap)) {
+        areaInfos.emplace_back(xi, yi, overlap.area);
       }
     }
   }
@@ -551,28 +545,18 @@ void rebinToOutput(const Quadrilateral &inputQ,
     return;
 
   const auto &inE = inputWS->e(i);
-  // It seems to be more efficient to construct this once and clear it before
-  // each calculation in the loop
-  ConvexPolygon intersectOverlap;
+  RectangleOverlap overlap;
   for (size_t y = qstart; y < qend; ++y) {
     const double vlo = verticalAxis[y];
     const double vhi = verticalAxis[y + 1];
     for (size_t xi = x_start; xi < x_end; ++xi) {
-      intersectOverlap.clear();
-      if (intersection(Quadrilateral(V2D(X[xi], vlo), V2D(X[xi + 1], vlo),
-                                     V2D(X[xi + 1], vhi), V2D(X[xi], vhi)),
-                       inputQ, intersectOverlap)) {
-        const double overlapArea = intersectOverlap.area();
-        if (overlapArea == 0.) {
-          continue;
-        }
-        const double weight = overlapArea / inputQ.area();
+      if (intersection(inputQ, X[xi], X[xi + 1], vlo, vhi, overlap)) {
+        const double weight = overlap.area / inputQ.area();
         double yValue = inY[j];
         yValue *= weight;
         double eValue = inE[j];
         if (inputWS->isDistribution()) {
-          const double overlapWidth =
-              intersectOverlap.maxX() - intersectOverlap.minX();
+          const double overlapWidth = overlap.maxX - overlap.minX;
           yValue *= overlapWidth;
           eValue *= overlapWidth;
         }
@@ -589,29 +573,15 @@ void rebinToOutput(const Quadrilateral &inputQ,
   }
 }
 
-/**
- * Rebin the input quadrilateral to the output grid
- * The quadrilateral must have a CLOCKWISE winding.
- * @param inputQ The input polygon (Polygon winding must be clockwise)
- * @param inputWS The input workspace containing the input intensity values
- * @param i The indexiin the vertical axis direction that inputQ references
- * @param j The index in the horizontal axis direction that inputQ references
- * @param outputWS A pointer to the output workspace that accumulates the data
- *        Note that the error array of the output workspace contains the
- *        **variance** and not the errors (standard deviations).
- * @param verticalAxis A vector containing the output vertical axis bin
- * boundaries
- * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
- * It is used to take into account the input area fractions when calcuting
- * the final output fractions.
- * This can be null to indicate that the input was a standard 2D workspace.
- */
-void rebinToFractionalOutput(const Quadrilateral &inputQ,
-                             const MatrixWorkspace_const_sptr &inputWS,
-                             const size_t i, const size_t j,
-                             RebinnedOutput &outputWS,
-                             const std::vector<double> &verticalAxis,
-                             const RebinnedOutput_const_sptr &inputRB) {
+namespace {
+template <class Accumulate>
+void rebinToFractionalOutputImpl(const Quadrilateral &inputQ,
+                                 const MatrixWorkspace_const_sptr &inputWS,
+                                 const size_t i, const size_t j,
+                                 const std::vector<double> &X,
+                                 const std::vector<double> &verticalAxis,
+                                 const RebinnedOutput_const_sptr &inputRB,
+                                 const Accumulate &accumulate) {
   const auto &inX = inputWS->binEdges(i);
   const auto &inY = inputWS->y(i);
   const auto &inE = inputWS->e(i);
@@ -619,7 +589,6 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
   if (std::isnan(signal))
     return;
 
-  const auto &X = outputWS.x(0).rawData();
   size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0),
       x_end(X.size() - 1);
   if (!getIntersectionRegion(X, verticalAxis, inputQ, qstart, qend, x_start,
@@ -679,17 +648,138 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
       continue;
     }
     const double weight = ai.weight / inputQArea;
-    PARALLEL_CRITICAL(overlap) {
-      // The mutable calls must be in the critical section
-      // so that any calls from omp sections can write to the
-      // output workspace safely
-      outputWS.mutableY(ai.wsIndex)[ai.binIndex] += signal * weight;
-      outputWS.mutableE(ai.wsIndex)[ai.binIndex] += variance * weight;
-      outputWS.dataF(ai.wsIndex)[ai.binIndex] += weight * inputWeight;
+    accumulate(ai.wsIndex, ai.binIndex, signal * weight, variance * weight,
+               weight * inputWeight);
+  }
+}
+} // namespace
+
+/**
+ * Rebin the input quadrilateral to the output grid
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS A pointer to the output workspace that accumulates the data
+ *        Note that the error array of the output workspace contains the
+ *        **variance** and not the errors (standard deviations).
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
+ * It is used to take into account the input area fractions when calcuting
+ * the final output fractions.
+ * This can be null to indicate that the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ,
+                             const MatrixWorkspace_const_sptr &inputWS,
+                             const size_t i, const size_t j,
+                             RebinnedOutput &outputWS,
+                             const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  rebinToFractionalOutputImpl(
+      inputQ, inputWS, i, j, outputWS.x(0).rawData(), verticalAxis, inputRB,
+      [&outputWS](const size_t wsIndex, const size_t binIndex,
+                  const double signal, const double variance,
+                  const double fraction) {
+        PARALLEL_CRITICAL(overlap) {
+          // The mutable calls must be in the critical section
+          // so that any calls from omp sections can write to the
+          // output workspace safely
+          outputWS.mutableY(wsIndex)[binIndex] += signal;
+          outputWS.mutableE(wsIndex)[binIndex] += variance;
+          outputWS.dataF(wsIndex)[binIndex] += fraction;
+        }
+      });
+}
+
+/**
+ * Rebin the input quadrilateral to the output grid of a buffer, see the
+ * overload taking a RebinnedOutput. No locking is done, so the buffer must
+ * only be used by one thread.
+ * @param inputQ The input polygon (Polygon winding must be Clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param buffer The buffer of the thread
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace,
+ * or null if the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ,
+                             const MatrixWorkspace_const_sptr &inputWS,
+                             const size_t i, const size_t j,
+                             FractionalRebinBuffer &buffer,
+                             const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  rebinToFractionalOutputImpl(
+      inputQ, inputWS, i, j, buffer.binEdges(), verticalAxis, inputRB,
+      [&buffer](const size_t wsIndex, const size_t binIndex,
+                const double signal, const double variance,
+                const double fraction) {
+        buffer.add(wsIndex, binIndex, signal, variance, fraction);
+      });
+}
+
+/**
+ * Constructs an empty buffer for the given output workspace
+ * @param outputWS The workspace the buffer will be added to
+ */
+FractionalRebinBuffer::FractionalRebinBuffer(const RebinnedOutput &outputWS)
+    : m_binEdges(outputWS.x(0).rawData()),
+      m_numberHistograms(outputWS.getNumberHistograms()),
+      m_numberBins(outputWS.blocksize()) {}
+
+/**
+ * Adds to a bin of the buffer
+ * @param wsIndex The workspace index of the bin
+ * @param binIndex The index of the bin in the spectrum
+ * @param signal The signal to add
+ * @param variance The variance to add
+ * @param fraction The fractional area to add
+ */
+void FractionalRebinBuffer::add(const size_t wsIndex, const size_t binIndex,
+                                const double signal, const double variance,
+                                const double fraction) {
+  if (m_signal.empty()) {
+    const auto size = m_numberHistograms * m_numberBins;
+    m_signal.resize(size, 0.);
+    m_variance.resize(size, 0.);
+    m_fraction.resize(size, 0.);
+  }
+  const size_t index = wsIndex * m_numberBins + binIndex;
+  m_signal[index] += signal;
+  m_variance[index] += variance;
+  m_fraction[index] += fraction;
+}
+
+/**
+ * Adds the contents of the buffer to the output workspace
+ * @param outputWS The workspace given to the constructor
+ */
+void FractionalRebinBuffer::addTo(RebinnedOutput &outputWS) const {
+  if (m_signal.empty())
+    return;
+  PARALLEL_FOR_IF(Kernel::threadSafe(outputWS))
+  for (int64_t i = 0; i < static_cast<int64_t>(m_numberHistograms); ++i) {
+    auto &Y = outputWS.mutableY(i);
+    auto &E = outputWS.mutableE(i);
+    auto &F = outputWS.dataF(i);
+    const size_t offset = static_cast<size_t>(i) * m_numberBins;
+    for (size_t j = 0; j < m_numberBins; ++j) {
+      Y[j] += m_signal[offset + j];
+      E[j] += m_variance[offset + j];
+      F[j] += m_fraction[offset + j];
     }
   }
 }
 
+size_t FractionalRebinBuffer::memorySize(const RebinnedOutput &outputWS) {
+  return 3 * outputWS.getNumberHistograms() * outputWS.blocksize() *
+         sizeof(double);
+}
+
 /**
  * Called at the completion of the fractional rebinning loop
  * to the set the finalize and hasSqrdError flags in the output workspace.
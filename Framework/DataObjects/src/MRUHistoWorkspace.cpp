@@ -0,0 +1,253 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/MRUHistoWorkspace.h"
+#include "MantidAPI/RefAxis.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/SpectraAxis.h"
+#include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidDataObjects/FileBackedHistogram1D.h"
+#include "MantidDataObjects/FloatHistogram1D.h"
+#include "MantidHistogramData/LinearGenerator.h"
+#include "MantidKernel/VectorHelper.h"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+namespace Mantid {
+namespace DataObjects {
+
+template <class SpectrumType>
+MRUHistoWorkspace<SpectrumType>::MRUHistoWorkspace(
+    const Parallel::StorageMode storageMode)
+    : HistoWorkspace(storageMode),
+      m_mru(std::make_unique<EventWorkspaceMRU>()) {}
+
+template <class SpectrumType>
+MRUHistoWorkspace<SpectrumType>::MRUHistoWorkspace(
+    const MRUHistoWorkspace &other)
+    : HistoWorkspace(other), m_mru(std::make_unique<EventWorkspaceMRU>()) {
+  m_data.resize(other.m_data.size());
+  for (size_t i = 0; i < m_data.size(); ++i) {
+    m_data[i] = std::make_unique<SpectrumType>(*(other.m_data[i]));
+    m_data[i]->setMRU(m_mru.get());
+  }
+}
+
+template <class SpectrumType>
+MRUHistoWorkspace<SpectrumType>::~MRUHistoWorkspace() = default;
+
+/**
+ * Sets the size of the workspace and initializes arrays to zero
+ * @param NVectors :: The number of spectra in the workspace
+ * @param XLength :: The number of X data points/bin boundaries in each vector
+ * @param YLength :: The number of data/error points in each vector
+ */
+template <class SpectrumType>
+void MRUHistoWorkspace<SpectrumType>::init(const std::size_t &NVectors,
+                                           const std::size_t &XLength,
+                                           const std::size_t &YLength) {
+  HistogramData::Histogram histogram(
+      HistogramData::getHistogramXMode(XLength, YLength),
+      HistogramData::Histogram::YMode::Counts);
+  histogram.setSharedX(Kernel::make_cow<HistogramData::HistogramX>(
+      XLength, HistogramData::LinearGenerator(1.0, 1.0)));
+  histogram.setCounts(YLength, 0.0);
+  histogram.setCountStandardDeviations(YLength, 0.0);
+  SpectrumType spec(histogram.xMode(), histogram.yMode());
+  spec.setHistogram(histogram);
+
+  m_data.resize(NVectors);
+  for (size_t i = 0; i < m_data.size(); ++i) {
+    m_data[i] = std::make_unique<SpectrumType>(spec);
+    m_data[i]->setMRU(m_mru.get());
+    // Default spectrum number = starts at 1, for workspace index 0.
+    m_data[i]->setSpectrumNo(specnum_t(i + 1));
+  }
+
+  m_axes.resize(2);
+  m_axes[0] = std::make_unique<API::RefAxis>(this);
+  m_axes[1] = std::make_unique<API::SpectraAxis>(this);
+}
+
+/**
+ * Initializes all spectra with the given histogram. Missing Y and E data is
+ * set to zero.
+ * @param histogram :: The histogram used for all spectra
+ */
+template <class SpectrumType>
+void MRUHistoWorkspace<SpectrumType>::init(
+    const HistogramData::Histogram &histogram) {
+  HistogramData::Histogram initializedHistogram(histogram);
+  if (initializedHistogram.yMode() ==
+      HistogramData::Histogram::YMode::Uninitialized)
+    initializedHistogram.setYMode(HistogramData::Histogram::YMode::Counts);
+  const bool frequencies = initializedHistogram.yMode() ==
+                           HistogramData::Histogram::YMode::Frequencies;
+  const auto numberOfBins = initializedHistogram.size();
+  if (!initializedHistogram.sharedY()) {
+    if (frequencies)
+      initializedHistogram.setFrequencies(numberOfBins, 0.0);
+    else
+      initializedHistogram.setCounts(numberOfBins, 0.0);
+  }
+  if (!initializedHistogram.sharedE()) {
+    if (frequencies)
+      initializedHistogram.setFrequencyStandardDeviations(numberOfBins, 0.0);
+    else
+      initializedHistogram.setCountStandardDeviations(numberOfBins, 0.0);
+  }
+  SpectrumType spec(initializedHistogram.xMode(),
+                    initializedHistogram.yMode());
+  spec.setHistogram(initializedHistogram);
+
+  m_data.resize(numberOfDetectorGroups());
+  for (auto &i : m_data) {
+    i = std::make_unique<SpectrumType>(spec);
+    i->setMRU(m_mru.get());
+  }
+
+  m_axes.resize(2);
+  m_axes[0] = std::make_unique<API::RefAxis>(this);
+  m_axes[1] = std::make_unique<API::SpectraAxis>(this);
+}
+
+/// Returns true if the workspace has differently sized spectra
+template <class SpectrumType>
+bool MRUHistoWorkspace<SpectrumType>::isRaggedWorkspace() const {
+  if (m_data.empty())
+    throw std::runtime_error("There is no data in the " + id() +
+                             ", therefore cannot determine if it is ragged.");
+  const auto numberOfBins = m_data[0]->size();
+  return std::any_of(m_data.cbegin(), m_data.cend(),
+                     [numberOfBins](const auto &histogram) {
+                       return numberOfBins != histogram->size();
+                     });
+}
+
+/// Returns the total number of Y values
+template <class SpectrumType>
+size_t MRUHistoWorkspace<SpectrumType>::size() const {
+  return std::accumulate(m_data.cbegin(), m_data.cend(), size_t{0},
+                         [](const size_t value, const auto &histogram) {
+                           return value + histogram->size();
+                         });
+}
+
+/// Returns the number of bins, throws if the workspace is ragged
+template <class SpectrumType>
+size_t MRUHistoWorkspace<SpectrumType>::blocksize() const {
+  if (m_data.empty())
+    return 0;
+  const auto numberOfBins = m_data[0]->size();
+  if (isRaggedWorkspace())
+    throw std::length_error(
+        "blocksize undefined because size of histograms is not equal");
+  return numberOfBins;
+}
+
+/// Returns the number of bins for a given histogram index
+template <class SpectrumType>
+std::size_t MRUHistoWorkspace<SpectrumType>::getNumberBins(
+    const std::size_t &index) const {
+  if (index < m_data.size())
+    return m_data[index]->size();
+  throw std::invalid_argument(
+      "Could not find number of bins in a histogram at index " +
+      std::to_string(index) + ": index is too large.");
+}
+
+/// Returns the maximum number of bins in a workspace (works on ragged data)
+template <class SpectrumType>
+std::size_t MRUHistoWorkspace<SpectrumType>::getMaxNumberBins() const {
+  if (m_data.empty())
+    return 0;
+  return (*std::max_element(m_data.cbegin(), m_data.cend(),
+                            [](const auto &a, const auto &b) {
+                              return a->size() < b->size();
+                            }))
+      ->size();
+}
+
+template <class SpectrumType>
+size_t MRUHistoWorkspace<SpectrumType>::getNumberHistograms() const {
+  return m_data.size();
+}
+
+/// Returns the amount of memory used in bytes, excluding the MRU
+template <class SpectrumType>
+size_t MRUHistoWorkspace<SpectrumType>::getMemorySize() const {
+  size_t total = std::accumulate(
+      m_data.cbegin(), m_data.cend(), size_t{0},
+      [](size_t total, auto &spec) { return total + spec->getMemorySize(); });
+  total += run().getMemorySize();
+  total += this->getMemorySizeForXAxes();
+  return total;
+}
+
+/// Return reference to the spectrum at the given workspace index.
+template <class SpectrumType>
+SpectrumType &MRUHistoWorkspace<SpectrumType>::getSpectrumWithoutInvalidation(
+    const size_t index) {
+  auto &spec = const_cast<SpectrumType &>(
+      static_cast<const MRUHistoWorkspace &>(*this).getSpectrum(index));
+  spec.setMatrixWorkspace(this, index);
+  return spec;
+}
+
+/// Return const reference to the spectrum at the given workspace index.
+template <class SpectrumType>
+const SpectrumType &
+MRUHistoWorkspace<SpectrumType>::getSpectrum(const size_t index) const {
+  if (index >= m_data.size()) {
+    std::ostringstream ss;
+    ss << id() << "::getSpectrum, histogram number " << index
+       << " out of range " << m_data.size();
+    throw std::range_error(ss.str());
+  }
+  return *m_data[index];
+}
+
+/** Rebin a particular spectrum to a new histogram bin boundaries.
+ * @param index :: workspace index to generate
+ * @param X :: input X vector of the bin boundaries.
+ * @param Y :: output vector to be filled with the Y data.
+ * @param E :: output vector to be filled with the Error data
+ * @param skipError :: ignored, the Error is always calculated.
+ */
+template <class SpectrumType>
+void MRUHistoWorkspace<SpectrumType>::generateHistogram(
+    const std::size_t index, const MantidVec &X, MantidVec &Y, MantidVec &E,
+    bool skipError) const {
+  UNUSED_ARG(skipError);
+  if (X.size() <= 1)
+    throw std::runtime_error(id() + "::generateHistogram(): X vector must be "
+                                    "at least length 2");
+  const auto histogram = getSpectrum(index).histogram();
+  Y.resize(X.size() - 1, 0);
+  E.resize(X.size() - 1, 0);
+  Kernel::VectorHelper::rebin(histogram.binEdges().rawData(),
+                              histogram.y().rawData(),
+                              histogram.e().rawData(), X, Y, E,
+                              histogram.xMode() ==
+                                  HistogramData::Histogram::XMode::Points ||
+                                  isDistribution());
+}
+
+/// Clears the MRU holding the Y and E data provided by the spectra
+template <class SpectrumType>
+void MRUHistoWorkspace<SpectrumType>::clearMRU() const {
+  m_mru->clear();
+}
+
+///@cond TEMPLATE
+template class MANTID_DATAOBJECTS_DLL MRUHistoWorkspace<FloatHistogram1D>;
+template class MANTID_DATAOBJECTS_DLL MRUHistoWorkspace<FileBackedHistogram1D>;
+///@endcond TEMPLATE
+
+} // namespace DataObjects
+} // namespace Mantid
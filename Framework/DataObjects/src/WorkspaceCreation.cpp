@@ -29,6 +29,16 @@ template <> std::unique_ptr<API::MatrixWorkspace> createHelper() {
   return {nullptr};
 }
 
+template <>
+std::unique_ptr<API::HistoWorkspace> createDoublePrecisionHelper() {
+  return std::make_unique<Workspace2D>();
+}
+
+template <>
+std::unique_ptr<API::MatrixWorkspace> createDoublePrecisionHelper() {
+  return std::make_unique<Workspace2D>();
+}
+
 template <> std::unique_ptr<API::MatrixWorkspace> createConcreteHelper() {
   throw std::runtime_error(
       "Attempt to create instance of abstract type MatrixWorkspace");
@@ -762,6 +762,31 @@ public:
     }
   }
 
+  void test_sortTofFromRuns_all_types() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      EventList sum;
+      sum.switchTo(static_cast<EventType>(this_type));
+      std::vector<size_t> runStarts;
+      for (size_t run = 0; run < 5; run++) {
+        EventList part;
+        for (size_t i = 0; i < 20; i++)
+          part += TofEvent(static_cast<double>((i * 7 + run * 3) % 50), 0);
+        part.switchTo(static_cast<EventType>(this_type));
+        part.sortTof();
+        runStarts.emplace_back(sum.getNumberEvents());
+        sum += part;
+      }
+      TS_ASSERT(!sum.isSortedByTof());
+      sum.sortTofFromRuns(runStarts);
+      TS_ASSERT(sum.isSortedByTof());
+      TS_ASSERT_EQUALS(sum.getNumberEvents(), 100);
+      for (size_t i = 1; i < 100; i++) {
+        TSM_ASSERT_LESS_THAN_EQUALS(this_type, sum.getEvent(i - 1).tof(),
+                                    sum.getEvent(i).tof());
+      }
+    }
+  }
+
   void test_SortPulseTime_simple() {
     el.sortPulseTime();
     vector<TofEvent> rel = el.getEvents();
@@ -0,0 +1,125 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidDataObjects/FileBackedWorkspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using namespace Mantid::HistogramData;
+
+class FileBackedWorkspace2DTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FileBackedWorkspace2DTest *createSuite() {
+    return new FileBackedWorkspace2DTest();
+  }
+  static void destroySuite(FileBackedWorkspace2DTest *suite) { delete suite; }
+
+  void test_create_from_factory() {
+    auto ws = makeWorkspace();
+    TS_ASSERT_EQUALS(ws->id(), "FileBackedWorkspace2D")
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), 3)
+    TS_ASSERT_EQUALS(ws->blocksize(), 4)
+    TS_ASSERT_EQUALS(ws->x(0).size(), 5)
+    TS_ASSERT_EQUALS(ws->y(2), HistogramY(4, 0.0))
+    TS_ASSERT_EQUALS(ws->e(2), HistogramE(4, 0.0))
+    TS_ASSERT_EQUALS(ws->numberOfFileBackedSpectra(), 0)
+  }
+
+  void test_data_in_memory_can_be_modified() {
+    auto ws = makeWorkspace();
+    ws->mutableY(1)[2] = 3.0;
+    ws->setHistogram(2, ws->binEdges(2), Counts(4, 5.0));
+    TS_ASSERT_EQUALS(ws->y(1)[2], 3.0)
+    TS_ASSERT_EQUALS(ws->y(2), HistogramY(4, 5.0))
+  }
+
+  void test_setFileBacking_requires_row_for_each_spectrum() {
+    auto ws = makeWorkspace();
+    TS_ASSERT_THROWS(ws->setFileBacking(makeMissingSource(), {0, 1}),
+                     const std::invalid_argument &)
+  }
+
+  void test_data_is_only_read_when_accessed() {
+    auto ws = makeWorkspace();
+    ws->setFileBacking(makeMissingSource(), {0, 1, 2});
+    TS_ASSERT_EQUALS(ws->numberOfFileBackedSpectra(), 3)
+    // X and the sizes are in memory
+    TS_ASSERT_EQUALS(ws->blocksize(), 4)
+    TS_ASSERT_EQUALS(ws->x(0).size(), 5)
+    TS_ASSERT_THROWS(ws->y(0), const std::runtime_error &)
+    // Replacing or clearing the data does not read it
+    ws->setHistogram(1, ws->binEdges(1), Counts(4, 2.0));
+    ws->getSpectrum(2).clearData();
+    TS_ASSERT_EQUALS(ws->numberOfFileBackedSpectra(), 1)
+    TS_ASSERT_EQUALS(ws->y(1), HistogramY(4, 2.0))
+    TS_ASSERT_EQUALS(ws->e(2), HistogramE(4, 0.0))
+  }
+
+  void test_children_are_Workspace2D() {
+    auto ws = makeWorkspace();
+    const auto fromFactory = WorkspaceFactory::Instance().create(ws);
+    TS_ASSERT_EQUALS(fromFactory->id(), "Workspace2D")
+    const auto created = create<HistoWorkspace>(*ws);
+    TS_ASSERT_EQUALS(created->id(), "Workspace2D")
+    TS_ASSERT_EQUALS(created->x(0), ws->x(0))
+  }
+
+  void test_clone_keeps_file_backing() {
+    auto ws = makeWorkspace();
+    ws->setFileBacking(makeMissingSource(), {0, 1, 2});
+    ws->setHistogram(0, ws->binEdges(0), Counts(4, 1.0));
+    const auto cloned = ws->clone();
+    TS_ASSERT_EQUALS(cloned->numberOfFileBackedSpectra(), 2)
+    TS_ASSERT_EQUALS(cloned->y(0), HistogramY(4, 1.0))
+  }
+
+  void test_file_backing_matches_other_paths_to_the_same_file() {
+    namespace fs = boost::filesystem;
+    const fs::path dir("FileBackedWorkspace2DTest_dir");
+    fs::create_directory(dir);
+    std::ofstream((dir / "data.nxs").string()).close();
+    const auto link = dir / "link.nxs";
+    fs::remove(link);
+    fs::create_symlink("data.nxs", link);
+    const auto source = std::make_shared<FileBackedHistogramSource>(
+        (dir / "data.nxs").string(), "/mantid_workspace_1/workspace");
+    FileBackedHistogram1D spectrum(Histogram::XMode::BinEdges,
+                                   Histogram::YMode::Counts);
+    spectrum.setFileBacking(source, 0);
+    const auto canonical = [](const fs::path &path) {
+      return FileBackedHistogramSource::canonicalPath(path.string());
+    };
+    TS_ASSERT(spectrum.isFileBackedBy(canonical(link)))
+    TS_ASSERT(spectrum.isFileBackedBy(
+        canonical(dir / ".." / dir / "." / "data.nxs")))
+    TS_ASSERT(!spectrum.isFileBackedBy(canonical(dir / "other.nxs")))
+    fs::remove_all(dir);
+  }
+
+private:
+  FileBackedWorkspace2D_sptr makeWorkspace() {
+    return std::dynamic_pointer_cast<FileBackedWorkspace2D>(
+        WorkspaceFactory::Instance().create("FileBackedWorkspace2D", 3, 5,
+                                            4));
+  }
+
+  std::shared_ptr<FileBackedHistogramSource> makeMissingSource() {
+    return std::make_shared<FileBackedHistogramSource>(
+        "FileBackedWorkspace2DTest_missing.nxs",
+        "/mantid_workspace_1/workspace");
+  }
+};
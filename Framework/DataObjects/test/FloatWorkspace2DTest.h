@@ -0,0 +1,136 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidDataObjects/FloatWorkspace2D.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using namespace Mantid::HistogramData;
+
+class FloatWorkspace2DTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FloatWorkspace2DTest *createSuite() {
+    return new FloatWorkspace2DTest();
+  }
+  static void destroySuite(FloatWorkspace2DTest *suite) { delete suite; }
+
+  void test_create_from_factory() {
+    auto ws = makeWorkspace();
+    TS_ASSERT_EQUALS(ws->id(), "FloatWorkspace2D")
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), 3)
+    TS_ASSERT_EQUALS(ws->blocksize(), 4)
+    TS_ASSERT_EQUALS(ws->x(0).size(), 5)
+    TS_ASSERT_EQUALS(ws->y(2), HistogramY(4, 0.0))
+    TS_ASSERT_EQUALS(ws->e(2), HistogramE(4, 0.0))
+  }
+
+  void test_setHistogram_rounds_to_single_precision() {
+    auto ws = makeWorkspace();
+    const double value = 0.1;
+    ws->setHistogram(1, BinEdges{0.0, 1.0, 2.0, 3.0, 4.0},
+                     Counts(4, value), CountStandardDeviations(4, 2.0));
+    TS_ASSERT_EQUALS(ws->x(1)[4], 4.0)
+    TS_ASSERT_EQUALS(ws->y(1)[3],
+                     static_cast<double>(static_cast<float>(value)))
+    TS_ASSERT_DELTA(ws->y(1)[3], value, 1e-7)
+    TS_ASSERT_EQUALS(ws->e(1)[0], 2.0)
+    TS_ASSERT_EQUALS(ws->y(0)[0], 0.0)
+    TS_ASSERT_EQUALS(ws->histogram(1).yMode(), Histogram::YMode::Counts)
+  }
+
+  void test_modifying_in_place_converts_to_double_precision() {
+    auto ws = makeWorkspace();
+    const auto &spectrum =
+        static_cast<const FloatWorkspace2D &>(*ws).getSpectrum(0);
+    ws->setHistogram(0, ws->binEdges(0), Counts(4, 0.1));
+    TS_ASSERT(spectrum.isSinglePrecision())
+    const auto rounded = static_cast<double>(static_cast<float>(0.1));
+    auto &y = ws->mutableY(0);
+    TS_ASSERT(!spectrum.isSinglePrecision())
+    TS_ASSERT_EQUALS(y[0], rounded)
+    y[0] = 0.1;
+    ws->dataE(0)[1] = 0.2;
+    TS_ASSERT_EQUALS(ws->y(0)[0], 0.1)
+    TS_ASSERT_EQUALS(ws->y(0)[1], rounded)
+    TS_ASSERT_EQUALS(ws->e(0)[1], 0.2)
+    TS_ASSERT(static_cast<const FloatWorkspace2D &>(*ws)
+                  .getSpectrum(1)
+                  .isSinglePrecision())
+  }
+
+  void test_convertToFrequencies() {
+    auto ws = makeWorkspace();
+    ws->setHistogram(0, BinEdges{0.0, 2.0, 4.0, 6.0, 8.0}, Counts(4, 4.0),
+                     CountStandardDeviations(4, 2.0));
+    ws->getSpectrum(0).convertToFrequencies();
+    TS_ASSERT_EQUALS(ws->histogram(0).yMode(), Histogram::YMode::Frequencies)
+    TS_ASSERT_EQUALS(ws->y(0), HistogramY(4, 2.0))
+    TS_ASSERT_EQUALS(ws->e(0), HistogramE(4, 1.0))
+  }
+
+  void test_setHistogram_after_modification_stores_single_precision() {
+    auto ws = makeWorkspace();
+    ws->mutableY(2)[0] = 1.0;
+    ws->setHistogram(2, ws->binEdges(2), Counts(4, 0.1));
+    const auto &spectrum =
+        static_cast<const FloatWorkspace2D &>(*ws).getSpectrum(2);
+    TS_ASSERT(spectrum.isSinglePrecision())
+    TS_ASSERT_EQUALS(ws->y(2)[0],
+                     static_cast<double>(static_cast<float>(0.1)))
+  }
+
+  void test_children_are_double_precision() {
+    auto ws = makeWorkspace();
+    ws->setHistogram(0, ws->binEdges(0), Counts(4, 3.0));
+    const auto fromFactory = WorkspaceFactory::Instance().create(ws);
+    TS_ASSERT_EQUALS(fromFactory->id(), "Workspace2D")
+    const auto created = create<HistoWorkspace>(*ws);
+    TS_ASSERT_EQUALS(created->id(), "Workspace2D")
+    TS_ASSERT_EQUALS(created->x(0), ws->x(0))
+    const auto single = create<FloatWorkspace2D>(*ws);
+    TS_ASSERT_EQUALS(single->id(), "FloatWorkspace2D")
+  }
+
+  void test_create_from_Workspace2D() {
+    const auto parent = create<Workspace2D>(2, Histogram(BinEdges(3)));
+    const auto ws = create<FloatWorkspace2D>(*parent);
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), 2)
+    TS_ASSERT_EQUALS(ws->blocksize(), 2)
+    TS_ASSERT_EQUALS(ws->y(1), HistogramY(2, 0.0))
+  }
+
+  void test_memory_is_smaller_than_Workspace2D() {
+    const auto ws = WorkspaceFactory::Instance().create("FloatWorkspace2D",
+                                                        100, 1001, 1000);
+    const auto doublePrecision = WorkspaceFactory::Instance().create(ws);
+    TS_ASSERT_LESS_THAN(ws->getMemorySize(), doublePrecision->getMemorySize())
+  }
+
+  void test_clone() {
+    auto ws = makeWorkspace();
+    ws->setHistogram(2, ws->binEdges(2), Counts(4, 5.0));
+    const auto cloned = std::dynamic_pointer_cast<FloatWorkspace2D>(
+        MatrixWorkspace_sptr(ws->clone()));
+    TS_ASSERT(cloned)
+    TS_ASSERT_EQUALS(cloned->y(2), HistogramY(4, 5.0))
+    ws->setHistogram(2, ws->binEdges(2), Counts(4, 1.0));
+    TS_ASSERT_EQUALS(cloned->y(2), HistogramY(4, 5.0))
+  }
+
+private:
+  MatrixWorkspace_sptr makeWorkspace() {
+    return WorkspaceFactory::Instance().create("FloatWorkspace2D", 3, 5, 4);
+  }
+};
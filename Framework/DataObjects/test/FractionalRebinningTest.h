@@ -0,0 +1,80 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/FractionalRebinning.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidHistogramData/LinearGenerator.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+using namespace Mantid::DataObjects;
+using namespace Mantid::HistogramData;
+using Mantid::API::MatrixWorkspace_const_sptr;
+using Mantid::Geometry::Quadrilateral;
+using Mantid::Kernel::V2D;
+
+class FractionalRebinningTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FractionalRebinningTest *createSuite() {
+    return new FractionalRebinningTest();
+  }
+  static void destroySuite(FractionalRebinningTest *suite) { delete suite; }
+
+  void test_buffer_gives_same_output_as_direct_rebinning() {
+    MatrixWorkspace_const_sptr input =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(3, 4, 0.0, 1.0);
+    const std::vector<double> verticalAxis{0.0, 0.7, 1.5, 2.2, 3.0};
+    auto direct = makeOutput(verticalAxis.size() - 1);
+    auto buffered = makeOutput(verticalAxis.size() - 1);
+    FractionalRebinning::FractionalRebinBuffer buffer(*buffered);
+
+    for (size_t i = 0; i < input->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < input->blocksize(); ++j) {
+        // Sheared polygons as produced by SofQWNormalisedPolygon
+        const auto x0 = static_cast<double>(j);
+        const auto y0 = 0.5 * static_cast<double>(i) + 0.1 * x0;
+        const Quadrilateral polygon(V2D(x0, y0), V2D(x0 + 1.0, y0 + 0.1),
+                                    V2D(x0 + 1.0, y0 + 0.6),
+                                    V2D(x0, y0 + 0.5));
+        FractionalRebinning::rebinToFractionalOutput(polygon, input, i, j,
+                                                     *direct, verticalAxis);
+        FractionalRebinning::rebinToFractionalOutput(polygon, input, i, j,
+                                                     buffer, verticalAxis);
+      }
+    }
+    buffer.addTo(*buffered);
+
+    double total = 0.0;
+    for (size_t i = 0; i < direct->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < direct->blocksize(); ++j) {
+        TS_ASSERT_DELTA(buffered->y(i)[j], direct->y(i)[j], 1e-12)
+        TS_ASSERT_DELTA(buffered->e(i)[j], direct->e(i)[j], 1e-12)
+        TS_ASSERT_DELTA(buffered->dataF(i)[j], direct->dataF(i)[j], 1e-12)
+        total += direct->y(i)[j];
+      }
+    }
+    TS_ASSERT(total > 0.0)
+  }
+
+  void test_unused_buffer_does_not_change_output() {
+    auto output = makeOutput(2);
+    FractionalRebinning::FractionalRebinBuffer buffer(*output);
+    buffer.addTo(*output);
+    TS_ASSERT_EQUALS(output->y(1), HistogramY(5, 0.0))
+    TS_ASSERT_EQUALS(output->dataF(1), std::vector<double>(5, 0.0))
+  }
+
+private:
+  RebinnedOutput_sptr makeOutput(const size_t nHist) {
+    return create<RebinnedOutput>(
+        nHist, BinEdges(6, LinearGenerator(-0.5, 1.0)));
+  }
+};
@@ -25,6 +25,7 @@ class V3D;
 namespace Geometry {
 class IComponent;
 class IObject;
+class SolidAngleCache;
 } // namespace Geometry
 
 namespace Beamline {
@@ -51,6 +52,9 @@ private:
   std::shared_ptr<std::vector<std::shared_ptr<const Geometry::IObject>>>
       m_shapes;
 
+  /// Cache of shape solid angles, shared by all copies sharing m_shapes
+  std::shared_ptr<SolidAngleCache> m_solidAngleCache;
+
   BoundingBox componentBoundingBox(const size_t index,
                                    const BoundingBox *reference) const;
 
@@ -135,6 +139,7 @@ public:
 
   double solidAngle(const size_t componentIndex,
                     const Kernel::V3D &observer) const;
+  void clearSolidAngleCache() const;
   BoundingBox boundingBox(const size_t componentIndex,
                           const BoundingBox *reference = nullptr) const;
   Beamline::ComponentType componentType(const size_t componentIndex) const;
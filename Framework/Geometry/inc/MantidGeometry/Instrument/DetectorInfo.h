@@ -26,6 +26,7 @@ namespace API {
 class SpectrumInfo;
 }
 namespace Geometry {
+class DetectorSpatialIndex;
 class IDetector;
 class Instrument;
 
@@ -102,6 +103,8 @@ public:
 
   const Geometry::IDetector &detector(const size_t index) const;
 
+  const DetectorSpatialIndex &spatialIndex() const;
+
   // This does not really belong into DetectorInfo, but it seems to be useful
   // while Instrument-2.0 does not exist.
   Kernel::V3D sourcePosition() const;
@@ -142,6 +145,12 @@ private:
   mutable std::vector<std::shared_ptr<const Geometry::IDetector>>
       m_lastDetector;
   mutable std::vector<size_t> m_lastIndex;
+
+  /// Lazily built spatial index, shared between copies with equal positions
+  mutable std::shared_ptr<const DetectorSpatialIndex> m_spatialIndex;
+  /// Position version of the Beamline::DetectorInfo the index was built from
+  mutable uint64_t m_spatialIndexVersion{0};
+  mutable std::mutex m_spatialIndexMutex;
 };
 
 using DetectorInfoIt = DetectorInfoIterator<DetectorInfo>;
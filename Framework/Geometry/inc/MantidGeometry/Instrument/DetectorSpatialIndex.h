@@ -0,0 +1,75 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class DetectorInfo;
+
+/** DetectorSpatialIndex is a static k-d tree over the positions of all
+  non-monitor detectors of a DetectorInfo.
+
+  It supports k-nearest-neighbour and fixed-radius queries returning detector
+  indices together with their distance from the query point, sorted by
+  increasing distance. Unlike the ANN based NearestNeighbours, all queries are
+  const and do not touch any global state, so they may be issued concurrently
+  from OpenMP loops.
+
+  The index keeps a snapshot of the detector positions it was built from.
+  DetectorInfo::spatialIndex() caches an index until the positions change.
+  Masking is not taken into account, since it typically changes much more
+  often than positions; callers should filter results using
+  DetectorInfo::isMasked if required.
+*/
+class MANTID_GEOMETRY_DLL DetectorSpatialIndex {
+public:
+  /// A query result: detector index and distance from the query point
+  using Neighbour = std::pair<size_t, double>;
+
+  explicit DetectorSpatialIndex(const DetectorInfo &detectorInfo);
+
+  size_t size() const;
+
+  std::vector<Neighbour> nearest(const Kernel::V3D &point,
+                                 const size_t k) const;
+  std::vector<Neighbour> nearest(const Kernel::V3D &point, const size_t k,
+                                 const Kernel::V3D &scale) const;
+  std::vector<Neighbour> inRadius(const Kernel::V3D &point,
+                                  const double radius) const;
+  std::vector<Neighbour> neighbours(const size_t detectorIndex,
+                                    const size_t k) const;
+  std::vector<Neighbour> neighboursInRadius(const size_t detectorIndex,
+                                            const double radius) const;
+
+private:
+  void build(const size_t begin, const size_t end);
+  void searchNearest(const size_t begin, const size_t end,
+                     const Kernel::V3D &point, const Kernel::V3D &invScale,
+                     const size_t k, std::vector<Neighbour> &heap) const;
+  void searchRadius(const size_t begin, const size_t end,
+                    const Kernel::V3D &point, const double radiusSq,
+                    std::vector<Neighbour> &result) const;
+
+  /// Positions of all detectors in detector-index order, used for validation
+  std::vector<Kernel::V3D> m_detectorPositions;
+  /// Positions of the indexed detectors in tree order
+  std::vector<Kernel::V3D> m_points;
+  /// Detector indices in tree order
+  std::vector<size_t> m_indices;
+  /// Split axis of the node stored at each tree position
+  std::vector<uint8_t> m_splitAxes;
+};
+
+} // namespace Geometry
+} // namespace Mantid
@@ -0,0 +1,72 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+namespace Mantid {
+namespace Geometry {
+class IObject;
+
+/** SolidAngleCache memoizes shape solid angles keyed by the shape, the
+  observer position in the frame of the shape and the scale factor.
+
+  Since the key captures every input of the calculation the cache never needs
+  to be invalidated: moving or rotating a component simply produces a
+  different key. Repeated solid-angle calculations, e.g. after a calibration
+  that moved only some tubes of an instrument, therefore only compute the
+  values for components whose geometry relative to the observer changed.
+
+  The shapes must outlive the cache, which is why ComponentInfo shares its
+  cache only with copies that share its shapes. Lookups are thread-safe; the
+  map is sharded to keep lock contention low in parallel loops.
+
+  The number of entries is bounded by the SolidAngle.CacheMB configuration
+  key. Once a shard is full, an eighth of its entries is evicted.
+*/
+class MANTID_GEOMETRY_DLL SolidAngleCache {
+public:
+  SolidAngleCache();
+  explicit SolidAngleCache(const size_t maxSize);
+
+  double solidAngle(const IObject &shape, const Kernel::V3D &observer,
+                    const Kernel::V3D &scaleFactor);
+  size_t size() const;
+  void clear();
+
+private:
+  static double computeSolidAngle(const IObject &shape,
+                                  const Kernel::V3D &observer,
+                                  const Kernel::V3D &scaleFactor);
+
+  struct Key {
+    const IObject *shape;
+    std::array<double, 6> coordinates;
+    bool operator==(const Key &other) const {
+      return shape == other.shape && coordinates == other.coordinates;
+    }
+  };
+  struct KeyHash {
+    size_t operator()(const Key &key) const;
+  };
+  struct Shard {
+    mutable std::mutex mutex;
+    std::unordered_map<Key, double, KeyHash> values;
+  };
+  static constexpr size_t NumShards = 32;
+  std::array<Shard, NumShards> m_shards;
+  /// Maximum number of entries per shard, 0 if caching is disabled
+  const size_t m_maxShardSize;
+};
+
+} // namespace Geometry
+} // namespace Mantid
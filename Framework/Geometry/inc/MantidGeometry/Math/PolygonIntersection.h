@@ -17,11 +17,25 @@ namespace Geometry {
 // Forward declarations
 //------------------------------------------------------------------------------
 class ConvexPolygon;
+class Quadrilateral;
+
+/// Area and horizontal extent of the overlap of a polygon and a rectangle
+struct RectangleOverlap {
+  double area = 0.;
+  double minX = 0.;
+  double maxX = 0.;
+};
 
 /// Compute the instersection of two convex polygons.
 bool MANTID_GEOMETRY_DLL intersection(const ConvexPolygon &P,
                                       const ConvexPolygon &Q,
                                       ConvexPolygon &out);
 
+/// Compute the intersection of a quadrilateral and an axis-aligned rectangle.
+bool MANTID_GEOMETRY_DLL intersection(const Quadrilateral &P,
+                                      const double xLower, const double xUpper,
+                                      const double yLower, const double yUpper,
+                                      RectangleOverlap &out);
+
 } // namespace Geometry
 } // namespace Mantid
@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/SolidAngleCache.h"
 #include "MantidBeamline/ComponentInfo.h"
 #include "MantidBeamline/ComponentType.h"
 #include "MantidGeometry/IComponent.h"
@@ -67,7 +68,8 @@ ComponentInfo::ComponentInfo(
     : m_componentInfo(std::move(componentInfo)),
       m_componentIds(std::move(componentIds)),
       m_compIDToIndex(std::move(componentIdToIndexMap)),
-      m_shapes(std::move(shapes)) {
+      m_shapes(std::move(shapes)),
+      m_solidAngleCache(std::make_shared<SolidAngleCache>()) {
 
   if (m_componentIds->size() != m_compIDToIndex->size()) {
     throw std::invalid_argument("Inconsistent ID and Mapping input containers "
@@ -98,7 +100,8 @@ ComponentInfo::cloneWithoutDetectorInfo() const {
 ComponentInfo::ComponentInfo(const ComponentInfo &other)
     : m_componentInfo(other.m_componentInfo->cloneWithoutDetectorInfo()),
       m_componentIds(other.m_componentIds),
-      m_compIDToIndex(other.m_compIDToIndex), m_shapes(other.m_shapes) {}
+      m_compIDToIndex(other.m_compIDToIndex), m_shapes(other.m_shapes),
+      m_solidAngleCache(other.m_solidAngleCache) {}
 
 // Defined as default in source for forward declaration with std::unique_ptr.
 ComponentInfo::~ComponentInfo() = default;
@@ -299,16 +302,16 @@ double ComponentInfo::solidAngle(const size_t componentIndex,
   // This is the observer position in the shape's coordinate system.
   const Kernel::V3D relativeObserver =
       toShapeFrame(observer, *m_componentInfo, componentIndex);
-  const Kernel::V3D scaleFactor = this->scaleFactor(componentIndex);
-  if ((scaleFactor - Kernel::V3D(1.0, 1.0, 1.0)).norm() < 1e-12)
-    return shape(componentIndex).solidAngle(relativeObserver);
-  else {
-    // This function will scale the object shape when calculating the solid
-    // angle.
-    return shape(componentIndex).solidAngle(relativeObserver, scaleFactor);
-  }
+  // Shapes are shared by many components, so identical relative geometry
+  // (e.g. unchanged tubes after a partial calibration) hits the cache.
+  return m_solidAngleCache->solidAngle(shape(componentIndex), relativeObserver,
+                                       scaleFactor(componentIndex));
 }
 
+/// Frees the solid angles cached by solidAngle(), which are shared with all
+/// copies of this ComponentInfo.
+void ComponentInfo::clearSolidAngleCache() const { m_solidAngleCache->clear(); }
+
 /**
  * Grow the bounding box on the basis that the component described by index is a
  * regular grid in a trapezoid, thus the bounding box can be fully described by
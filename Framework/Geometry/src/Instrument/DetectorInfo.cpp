@@ -11,6 +11,7 @@
 #include "MantidGeometry/Instrument/Detector.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/Instrument/DetectorInfoIterator.h"
+#include "MantidGeometry/Instrument/DetectorSpatialIndex.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidKernel/EigenConversionHelpers.h"
 #include "MantidKernel/Exception.h"
@@ -58,7 +59,11 @@ DetectorInfo::DetectorInfo(const DetectorInfo &other)
       m_instrument(other.m_instrument), m_detectorIDs(other.m_detectorIDs),
       m_detIDToIndex(other.m_detIDToIndex),
       m_lastDetector(PARALLEL_GET_MAX_THREADS),
-      m_lastIndex(PARALLEL_GET_MAX_THREADS, -1) {}
+      m_lastIndex(PARALLEL_GET_MAX_THREADS, -1) {
+  std::lock_guard<std::mutex> lock(other.m_spatialIndexMutex);
+  m_spatialIndex = other.m_spatialIndex;
+  m_spatialIndexVersion = other.m_spatialIndexVersion;
+}
 
 /// Assigns the contents of the non-wrapping part of `rhs` to this.
 DetectorInfo &DetectorInfo::operator=(const DetectorInfo &rhs) {
@@ -454,6 +459,22 @@ const Geometry::IDetector &DetectorInfo::detector(const size_t index) const {
   return getDetector(index);
 }
 
+/** Returns a spatial index over the positions of all non-monitor detectors.
+ *
+ * The index is built on first use and cached. It is rebuilt only if detector
+ * positions have changed since, including changes made through ComponentInfo,
+ * e.g., when moving a bank. Validating the cached index takes constant time.
+ * The reference is invalidated by any subsequent non-const access. */
+const DetectorSpatialIndex &DetectorInfo::spatialIndex() const {
+  std::lock_guard<std::mutex> lock(m_spatialIndexMutex);
+  const auto version = m_detectorInfo->positionVersion();
+  if (!m_spatialIndex || m_spatialIndexVersion != version) {
+    m_spatialIndex = std::make_shared<const DetectorSpatialIndex>(*this);
+    m_spatialIndexVersion = version;
+  }
+  return *m_spatialIndex;
+}
+
 /// Returns the source position.
 Kernel::V3D DetectorInfo::sourcePosition() const {
   return Kernel::toV3D(m_detectorInfo->sourcePosition());
@@ -0,0 +1,237 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Instrument/DetectorSpatialIndex.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Geometry {
+
+namespace {
+/// Heap ordering putting the furthest candidate at the front
+bool closer(const DetectorSpatialIndex::Neighbour &a,
+            const DetectorSpatialIndex::Neighbour &b) {
+  return a.second < b.second;
+}
+
+/// Convert squared distances to distances and sort by increasing distance
+void finalize(std::vector<DetectorSpatialIndex::Neighbour> &result) {
+  std::sort(result.begin(), result.end(), closer);
+  for (auto &item : result)
+    item.second = std::sqrt(item.second);
+}
+} // namespace
+
+/** Build the index from the current positions of all non-monitor detectors.
+ *
+ * @param detectorInfo :: DetectorInfo providing positions and monitor flags
+ * @throw std::runtime_error if the beamline has scanning detectors
+ */
+DetectorSpatialIndex::DetectorSpatialIndex(const DetectorInfo &detectorInfo) {
+  if (detectorInfo.isScanning())
+    throw std::runtime_error("DetectorSpatialIndex: scanning detectors are "
+                             "not supported");
+  const auto nDetectors = detectorInfo.size();
+  m_detectorPositions.reserve(nDetectors);
+  m_indices.reserve(nDetectors);
+  for (size_t i = 0; i < nDetectors; ++i) {
+    m_detectorPositions.emplace_back(detectorInfo.position(i));
+    if (!detectorInfo.isMonitor(i))
+      m_indices.emplace_back(i);
+  }
+  m_splitAxes.resize(m_indices.size(), 0);
+  build(0, m_indices.size());
+  m_points.reserve(m_indices.size());
+  for (const auto index : m_indices)
+    m_points.emplace_back(m_detectorPositions[index]);
+}
+
+/// Returns the number of detectors in the index (monitors are excluded).
+size_t DetectorSpatialIndex::size() const { return m_indices.size(); }
+
+/** Find the k detectors closest to a point.
+ *
+ * @param point :: the query position
+ * @param k :: the number of detectors to return
+ * @return up to k (detector index, distance) pairs sorted by distance
+ */
+std::vector<DetectorSpatialIndex::Neighbour>
+DetectorSpatialIndex::nearest(const Kernel::V3D &point, const size_t k) const {
+  return nearest(point, k, Kernel::V3D(1.0, 1.0, 1.0));
+}
+
+/** Find the k detectors closest to a point, measuring distances in coordinates
+ * divided by `scale`. This matches searches done in units of the pixel size,
+ * e.g., by WorkspaceNearestNeighbours.
+ *
+ * @param point :: the query position
+ * @param k :: the number of detectors to return
+ * @param scale :: the positive length of one unit along each axis
+ * @return up to k (detector index, scaled distance) pairs sorted by scaled
+ * distance
+ */
+std::vector<DetectorSpatialIndex::Neighbour>
+DetectorSpatialIndex::nearest(const Kernel::V3D &point, const size_t k,
+                              const Kernel::V3D &scale) const {
+  if (!(scale.X() > 0.0 && scale.Y() > 0.0 && scale.Z() > 0.0))
+    throw std::invalid_argument(
+        "DetectorSpatialIndex::nearest: scale must be positive");
+  std::vector<Neighbour> result;
+  if (k == 0)
+    return result;
+  result.reserve(std::min(k, size()));
+  const Kernel::V3D invScale(1.0 / scale.X(), 1.0 / scale.Y(),
+                             1.0 / scale.Z());
+  searchNearest(0, size(), point, invScale, k, result);
+  finalize(result);
+  return result;
+}
+
+/** Find all detectors within a given distance of a point.
+ *
+ * @param point :: the query position
+ * @param radius :: the search radius (inclusive)
+ * @return (detector index, distance) pairs sorted by distance
+ */
+std::vector<DetectorSpatialIndex::Neighbour>
+DetectorSpatialIndex::inRadius(const Kernel::V3D &point,
+                               const double radius) const {
+  if (radius < 0.0)
+    throw std::invalid_argument(
+        "DetectorSpatialIndex::inRadius: radius must not be negative");
+  std::vector<Neighbour> result;
+  searchRadius(0, size(), point, radius * radius, result);
+  finalize(result);
+  return result;
+}
+
+/// Returns the k nearest neighbours of a detector, excluding the detector
+/// itself.
+std::vector<DetectorSpatialIndex::Neighbour>
+DetectorSpatialIndex::neighbours(const size_t detectorIndex,
+                                 const size_t k) const {
+  auto result = nearest(m_detectorPositions.at(detectorIndex), k + 1);
+  const auto self =
+      std::find_if(result.begin(), result.end(), [&](const Neighbour &item) {
+        return item.first == detectorIndex;
+      });
+  if (self != result.end())
+    result.erase(self);
+  if (result.size() > k)
+    result.resize(k);
+  return result;
+}
+
+/// Returns all neighbours of a detector within radius, excluding the detector
+/// itself.
+std::vector<DetectorSpatialIndex::Neighbour>
+DetectorSpatialIndex::neighboursInRadius(const size_t detectorIndex,
+                                         const double radius) const {
+  auto result = inRadius(m_detectorPositions.at(detectorIndex), radius);
+  result.erase(std::remove_if(result.begin(), result.end(),
+                              [&](const Neighbour &item) {
+                                return item.first == detectorIndex;
+                              }),
+               result.end());
+  return result;
+}
+
+/** Recursively partition m_indices[begin, end) around the median of the axis
+ * with the largest extent. The median is stored at the middle position so the
+ * tree is implicit in the array layout. */
+void DetectorSpatialIndex::build(const size_t begin, const size_t end) {
+  if (end - begin < 2)
+    return;
+  Kernel::V3D lower(m_detectorPositions[m_indices[begin]]);
+  Kernel::V3D upper(lower);
+  for (size_t i = begin + 1; i < end; ++i) {
+    const auto &pos = m_detectorPositions[m_indices[i]];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      lower[axis] = std::min(lower[axis], pos[axis]);
+      upper[axis] = std::max(upper[axis], pos[axis]);
+    }
+  }
+  const auto extent = upper - lower;
+  uint8_t axis = 0;
+  if (extent[1] > extent[axis])
+    axis = 1;
+  if (extent[2] > extent[axis])
+    axis = 2;
+
+  const size_t mid = begin + (end - begin) / 2;
+  std::nth_element(m_indices.begin() + begin, m_indices.begin() + mid,
+                   m_indices.begin() + end, [&](size_t a, size_t b) {
+                     return m_detectorPositions[a][axis] <
+                            m_detectorPositions[b][axis];
+                   });
+  m_splitAxes[mid] = axis;
+  build(begin, mid);
+  build(mid + 1, end);
+}
+
+/// Depth-first k-NN search keeping the best candidates in a max-heap of
+/// squared scaled distances.
+void DetectorSpatialIndex::searchNearest(const size_t begin, const size_t end,
+                                         const Kernel::V3D &point,
+                                         const Kernel::V3D &invScale,
+                                         const size_t k,
+                                         std::vector<Neighbour> &heap) const {
+  if (begin >= end)
+    return;
+  const size_t mid = begin + (end - begin) / 2;
+  const auto &node = m_points[mid];
+  const double distSq = ((node - point) * invScale).norm2();
+  if (heap.size() < k) {
+    heap.emplace_back(m_indices[mid], distSq);
+    std::push_heap(heap.begin(), heap.end(), closer);
+  } else if (distSq < heap.front().second) {
+    std::pop_heap(heap.begin(), heap.end(), closer);
+    heap.back() = Neighbour(m_indices[mid], distSq);
+    std::push_heap(heap.begin(), heap.end(), closer);
+  }
+
+  const auto axis = m_splitAxes[mid];
+  const double diff = (point[axis] - node[axis]) * invScale[axis];
+  const bool leftFirst = diff < 0.0;
+  if (leftFirst)
+    searchNearest(begin, mid, point, invScale, k, heap);
+  else
+    searchNearest(mid + 1, end, point, invScale, k, heap);
+  if (heap.size() < k || diff * diff < heap.front().second) {
+    if (leftFirst)
+      searchNearest(mid + 1, end, point, invScale, k, heap);
+    else
+      searchNearest(begin, mid, point, invScale, k, heap);
+  }
+}
+
+/// Depth-first fixed-radius search collecting squared distances.
+void DetectorSpatialIndex::searchRadius(const size_t begin, const size_t end,
+                                        const Kernel::V3D &point,
+                                        const double radiusSq,
+                                        std::vector<Neighbour> &result) const {
+  if (begin >= end)
+    return;
+  const size_t mid = begin + (end - begin) / 2;
+  const auto &node = m_points[mid];
+  const double distSq = (node - point).norm2();
+  if (distSq <= radiusSq)
+    result.emplace_back(m_indices[mid], distSq);
+
+  const auto axis = m_splitAxes[mid];
+  const double diff = point[axis] - node[axis];
+  if (diff <= 0.0 || diff * diff <= radiusSq)
+    searchRadius(begin, mid, point, radiusSq, result);
+  if (diff >= 0.0 || diff * diff <= radiusSq)
+    searchRadius(mid + 1, end, point, radiusSq, result);
+}
+
+} // namespace Geometry
+} // namespace Mantid
@@ -0,0 +1,123 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Instrument/SolidAngleCache.h"
+#include "MantidGeometry/Objects/IObject.h"
+#include "MantidKernel/ConfigService.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+namespace Mantid {
+namespace Geometry {
+
+namespace {
+/// Default memory (in MB) used for cached solid angles
+constexpr int DEFAULT_CACHE_MB = 4;
+/// Approximate memory used per entry including hash-map node overhead
+constexpr size_t BYTES_PER_ENTRY = 128;
+
+/// Returns the maximum number of entries set by SolidAngle.CacheMB.
+size_t configuredMaxSize() {
+  const auto sizeMB = Kernel::ConfigService::Instance()
+                          .getValue<int>("SolidAngle.CacheMB")
+                          .get_value_or(DEFAULT_CACHE_MB);
+  if (sizeMB <= 0)
+    return 0;
+  return static_cast<size_t>(sizeMB) * 1024 * 1024 / BYTES_PER_ENTRY;
+}
+} // namespace
+
+/// Creates a cache bounded by the SolidAngle.CacheMB configuration key.
+SolidAngleCache::SolidAngleCache() : SolidAngleCache(configuredMaxSize()) {}
+
+/// @param maxSize :: approximate upper limit of the number of cached values,
+/// 0 disables caching
+SolidAngleCache::SolidAngleCache(const size_t maxSize)
+    : m_maxShardSize(
+          maxSize == 0 ? 0 : std::max(maxSize / NumShards, size_t(1))) {}
+
+/** Return the solid angle of `shape` seen from `observer`, computing and
+ * storing it if it is not in the cache yet.
+ *
+ * @param shape :: the shape, which must outlive the cache
+ * @param observer :: observer position in the frame of the shape
+ * @param scaleFactor :: scale factor applied to the shape
+ * @return the solid angle in steradians
+ */
+double SolidAngleCache::solidAngle(const IObject &shape,
+                                   const Kernel::V3D &observer,
+                                   const Kernel::V3D &scaleFactor) {
+  if (m_maxShardSize == 0)
+    return computeSolidAngle(shape, observer, scaleFactor);
+  const Key key{&shape,
+                {{observer.X(), observer.Y(), observer.Z(), scaleFactor.X(),
+                  scaleFactor.Y(), scaleFactor.Z()}}};
+  auto &shard = m_shards[KeyHash()(key) % NumShards];
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto it = shard.values.find(key);
+    if (it != shard.values.end())
+      return it->second;
+  }
+
+  // Compute outside the lock. Two threads may compute the same value, which
+  // is harmless since the result is deterministic.
+  const double value = computeSolidAngle(shape, observer, scaleFactor);
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if (shard.values.size() >= m_maxShardSize) {
+    // Evict part of the shard rather than all of it, such that a working set
+    // slightly larger than the cache still mostly hits. Iteration order is
+    // unrelated to insertion order, so this evicts arbitrary entries.
+    const auto nEvict = std::max(shard.values.size() / 8, size_t(1));
+    auto last = shard.values.begin();
+    std::advance(last, nEvict);
+    shard.values.erase(shard.values.begin(), last);
+  }
+  shard.values.emplace(key, value);
+  return value;
+}
+
+double SolidAngleCache::computeSolidAngle(const IObject &shape,
+                                          const Kernel::V3D &observer,
+                                          const Kernel::V3D &scaleFactor) {
+  if ((scaleFactor - Kernel::V3D(1.0, 1.0, 1.0)).norm() < 1e-12)
+    return shape.solidAngle(observer);
+  return shape.solidAngle(observer, scaleFactor);
+}
+
+/// Returns the number of cached values.
+size_t SolidAngleCache::size() const {
+  size_t total = 0;
+  for (const auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    total += shard.values.size();
+  }
+  return total;
+}
+
+/// Removes all cached values.
+void SolidAngleCache::clear() {
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.values.clear();
+  }
+}
+
+size_t SolidAngleCache::KeyHash::operator()(const Key &key) const {
+  size_t seed = std::hash<const IObject *>()(key.shape);
+  for (const auto coordinate : key.coordinates) {
+    // Combine as in boost::hash_combine
+    seed ^= std::hash<double>()(coordinate) + 0x9e3779b9 + (seed << 6) +
+            (seed >> 2);
+  }
+  return seed;
+}
+
+} // namespace Geometry
+} // namespace Mantid
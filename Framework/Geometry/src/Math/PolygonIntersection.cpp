@@ -10,9 +10,14 @@
 #include "MantidGeometry/Math/PolygonIntersection.h"
 #include "MantidGeometry/Math/ConvexPolygon.h"
 #include "MantidGeometry/Math/PolygonEdge.h"
+#include "MantidGeometry/Math/Quadrilateral.h"
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/V2D.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 using namespace Mantid::Kernel;
 
 namespace Mantid {
@@ -67,6 +72,112 @@ void advanceVertex(ConvexPolygon::Iterator &iter, ConvexPolygon &out,
   }
 }
 
+/**
+ * Vertices of a polygon being clipped against a rectangle. Clipping a convex
+ * quadrilateral against each of the 4 edges adds at most one vertex per edge,
+ * so the capacity is fixed and no dynamic allocation is required.
+ */
+struct ClipBuffer {
+  static constexpr size_t capacity = 8;
+  /// The X (index 0) and Y (index 1) coordinates of the vertices
+  std::array<std::array<double, capacity>, 2> coords;
+  size_t npoints = 0;
+};
+
+/**
+ * Clip a convex polygon against one edge of a rectangle using the
+ * Sutherland-Hodgman algorithm
+ * @param in :: The polygon to clip
+ * @param out :: A reference to the clipped polygon
+ * @param bound :: The position of the edge along the given axis
+ * @tparam Axis :: 0 to clip in X, 1 to clip in Y
+ * @tparam Lower :: True if the points above the bound are kept
+ * @return False if the clipped polygon does not fit in the buffer, which
+ * only happens if rounding made the polygon slightly concave
+ */
+template <size_t Axis, bool Lower>
+bool clipToBound(const ClipBuffer &in, ClipBuffer &out, const double bound) {
+  const auto &clipped = in.coords[Axis];
+  const auto &other = in.coords[1 - Axis];
+  const auto inside = [bound](const double value) {
+    return Lower ? value >= bound : value <= bound;
+  };
+  out.npoints = 0;
+  if (in.npoints == 0)
+    return true;
+  size_t previous = in.npoints - 1;
+  bool previousIsInside = inside(clipped[previous]);
+  for (size_t current = 0; current < in.npoints; ++current) {
+    const bool currentIsInside = inside(clipped[current]);
+    if (currentIsInside != previousIsInside) {
+      // The edge crosses the bound, add the crossing point
+      if (out.npoints == ClipBuffer::capacity)
+        return false;
+      const double fraction = (bound - clipped[previous]) /
+                              (clipped[current] - clipped[previous]);
+      out.coords[Axis][out.npoints] = bound;
+      out.coords[1 - Axis][out.npoints] =
+          other[previous] + fraction * (other[current] - other[previous]);
+      ++out.npoints;
+    }
+    if (currentIsInside) {
+      if (out.npoints == ClipBuffer::capacity)
+        return false;
+      out.coords[Axis][out.npoints] = clipped[current];
+      out.coords[1 - Axis][out.npoints] = other[current];
+      ++out.npoints;
+    }
+    previous = current;
+    previousIsInside = currentIsInside;
+  }
+  return true;
+}
+
+/**
+ * Check whether a quadrilateral is convex, i.e. all of the turns between
+ * consecutive edges are in the same direction. Collinear edges are allowed.
+ * @param P :: The quadrilateral, with either winding
+ * @return True if the quadrilateral is convex
+ */
+bool isConvex(const Quadrilateral &P) {
+  bool clockwise = false;
+  bool antiClockwise = false;
+  for (size_t i = 0; i < 4; ++i) {
+    const V2D edge = P[(i + 1) % 4] - P[i];
+    const V2D next = P[(i + 2) % 4] - P[(i + 1) % 4];
+    const double turn = edge.X() * next.Y() - edge.Y() * next.X();
+    clockwise |= turn < 0.;
+    antiClockwise |= turn > 0.;
+  }
+  return !(clockwise && antiClockwise);
+}
+
+/**
+ * Compute the overlap of a quadrilateral and an axis-aligned rectangle using
+ * the general intersection of two polygons
+ * @param P :: The quadrilateral
+ * @param xLower :: The lower X edge of the rectangle
+ * @param xUpper :: The upper X edge of the rectangle
+ * @param yLower :: The lower Y edge of the rectangle
+ * @param yUpper :: The upper Y edge of the rectangle
+ * @param out :: A reference to the area and horizontal extent of the overlap
+ * @return True if the overlap has a non-zero area, false otherwise
+ */
+bool polygonOverlap(const Quadrilateral &P, const double xLower,
+                    const double xUpper, const double yLower,
+                    const double yUpper, RectangleOverlap &out) {
+  ConvexPolygon overlap;
+  if (!intersection(Quadrilateral(xLower, xUpper, yLower, yUpper), P,
+                    overlap))
+    return false;
+  out.area = overlap.area();
+  if (out.area == 0.)
+    return false;
+  out.minX = overlap.minX();
+  out.maxX = overlap.maxX();
+  return true;
+}
+
 } // Anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -212,5 +323,65 @@ bool MANTID_GEOMETRY_DLL intersection(const ConvexPolygon &P,
   return false;
 }
 
+/**
+ * Compute the overlap of a quadrilateral and an axis-aligned rectangle by
+ * clipping the quadrilateral against each edge of the rectangle. The
+ * vertices are held in fixed size buffers on the stack so, unlike the
+ * general intersection of two polygons, no memory is allocated. This makes
+ * it suitable for the inner loops of the fractional rebinning algorithms.
+ * Non-convex quadrilaterals fall back to the general intersection.
+ * @param P The quadrilateral, with either winding
+ * @param xLower The lower X edge of the rectangle
+ * @param xUpper The upper X edge of the rectangle
+ * @param yLower The lower Y edge of the rectangle
+ * @param yUpper The upper Y edge of the rectangle
+ * @param out A reference to the area and horizontal extent of the overlap.
+ * Only valid if true is returned.
+ * @return True if the overlap has a non-zero area, false otherwise
+ */
+bool MANTID_GEOMETRY_DLL intersection(const Quadrilateral &P,
+                                      const double xLower, const double xUpper,
+                                      const double yLower, const double yUpper,
+                                      RectangleOverlap &out) {
+  if (P.maxX() <= xLower || P.minX() >= xUpper || P.maxY() <= yLower ||
+      P.minY() >= yUpper)
+    return false;
+
+  // Clipping is only valid for convex shapes, e.g. a bowtie would have the
+  // areas of its loops subtracted, so use the general intersection instead
+  if (!isConvex(P))
+    return polygonOverlap(P, xLower, xUpper, yLower, yUpper, out);
+
+  ClipBuffer first, second;
+  for (size_t i = 0; i < 4; ++i) {
+    first.coords[0][i] = P[i].X();
+    first.coords[1][i] = P[i].Y();
+  }
+  first.npoints = 4;
+  if (!(clipToBound<0, true>(first, second, xLower) &&
+        clipToBound<0, false>(second, first, xUpper) &&
+        clipToBound<1, true>(first, second, yLower) &&
+        clipToBound<1, false>(second, first, yUpper)))
+    return polygonOverlap(P, xLower, xUpper, yLower, yUpper, out);
+  const size_t npoints = first.npoints;
+  if (npoints < 3)
+    return false;
+
+  // Shoelace formula over the contiguous coordinate arrays
+  const auto &x = first.coords[0];
+  const auto &y = first.coords[1];
+  double twiceArea = x[npoints - 1] * y[0] - x[0] * y[npoints - 1];
+  for (size_t i = 0; i + 1 < npoints; ++i) {
+    twiceArea += x[i] * y[i + 1] - x[i + 1] * y[i];
+  }
+  out.area = 0.5 * std::abs(twiceArea);
+  if (out.area == 0.)
+    return false;
+  const auto extent = std::minmax_element(x.cbegin(), x.cbegin() + npoints);
+  out.minX = *extent.first;
+  out.maxX = *extent.second;
+  return true;
+}
+
 } // namespace Geometry
 } // namespace Mantid
@@ -230,62 +230,37 @@ double cuboidSolidAngle(const V3D &observer, const std::vector<V3D> &vectors) {
   // triangles defining the 6 surfaces of the bounding box. Using a consistent
   // ordering of points the "away facing" triangles give -ve contributions to
   // the solid angle and hence are ignored.
-  std::vector<V3D> pts;
-  pts.reserve(8);
   const V3D dx = vectors[1] - vectors[0];
   const V3D dz = vectors[3] - vectors[0];
-  pts.emplace_back(vectors[2]);
-  pts.emplace_back(vectors[2] + dx);
-  pts.emplace_back(vectors[1]);
-  pts.emplace_back(vectors[0]);
-  pts.emplace_back(vectors[2] + dz);
-  pts.emplace_back(vectors[2] + dz + dx);
-  pts.emplace_back(vectors[1] + dz);
-  pts.emplace_back(vectors[0] + dz);
-
-  constexpr unsigned int ntriangles(12);
-  std::vector<std::vector<int>> triMap(ntriangles, std::vector<int>(3, 0));
-  triMap[0][0] = 1;
-  triMap[0][1] = 4;
-  triMap[0][2] = 3;
-  triMap[1][0] = 3;
-  triMap[1][1] = 2;
-  triMap[1][2] = 1;
-  triMap[2][0] = 5;
-  triMap[2][1] = 6;
-  triMap[2][2] = 7;
-  triMap[3][0] = 7;
-  triMap[3][1] = 8;
-  triMap[3][2] = 5;
-  triMap[4][0] = 1;
-  triMap[4][1] = 2;
-  triMap[4][2] = 6;
-  triMap[5][0] = 6;
-  triMap[5][1] = 5;
-  triMap[5][2] = 1;
-  triMap[6][0] = 2;
-  triMap[6][1] = 3;
-  triMap[6][2] = 7;
-  triMap[7][0] = 7;
-  triMap[7][1] = 6;
-  triMap[7][2] = 2;
-  triMap[8][0] = 3;
-  triMap[8][1] = 4;
-  triMap[8][2] = 8;
-  triMap[9][0] = 8;
-  triMap[9][1] = 7;
-  triMap[9][2] = 3;
-  triMap[10][0] = 1;
-  triMap[10][1] = 5;
-  triMap[10][2] = 8;
-  triMap[11][0] = 8;
-  triMap[11][1] = 4;
-  triMap[11][2] = 1;
+  const std::array<V3D, 8> pts{{vectors[2], vectors[2] + dx, vectors[1],
+                                vectors[0], vectors[2] + dz,
+                                vectors[2] + dz + dx, vectors[1] + dz,
+                                vectors[0] + dz}};
+
+  constexpr std::array<std::array<int, 3>, 12> triMap{
+      {{{1, 4, 3}},
+       {{3, 2, 1}},
+       {{5, 6, 7}},
+       {{7, 8, 5}},
+       {{1, 2, 6}},
+       {{6, 5, 1}},
+       {{2, 3, 7}},
+       {{7, 6, 2}},
+       {{3, 4, 8}},
+       {{8, 7, 3}},
+       {{1, 5, 8}},
+       {{8, 4, 1}}}};
   double sangle = 0.0;
-  for (unsigned int i = 0; i < ntriangles; i++) {
-    const double sa =
-        triangleSolidAngle(pts[triMap[i][0] - 1], pts[triMap[i][1] - 1],
-                           pts[triMap[i][2] - 1], observer);
+  for (const auto &triangle : triMap) {
+    const V3D &a = pts[triangle[0] - 1];
+    const V3D &b = pts[triangle[1] - 1];
+    const V3D &c = pts[triangle[2] - 1];
+    // The sign of the solid angle is the sign of the triple product, so away
+    // facing triangles can be skipped without evaluating the full formula
+    if ((a - observer).scalar_prod((b - observer).cross_prod(c - observer)) <
+        0.0)
+      continue;
+    const double sa = triangleSolidAngle(a, b, c, observer);
     if (sa > 0)
       sangle += sa;
   }
@@ -309,56 +284,55 @@ double cylinderSolidAngle(const V3D &observer, const V3D &centre,
   // stacked cylinders give the correct value of solid angle (i.e shadowing is
   // loosely taken into account by this method) Any triangle that has a normal
   // facing away from the observer gives a negative solid angle and is excluded
-  // For simplicity the triangulation points are constructed such that the cone
-  // axis points up the +Z axis and then rotated into their final position
-
-  // Required rotation
+  // For simplicity the triangulation points are constructed such that the
+  // cylinder axis points up the +Z axis. Rather than rotating every point into
+  // its final position the observer is rotated into this frame.
   constexpr V3D initial_axis(0., 0., 1.0);
-  const Quat transform(initial_axis, axis);
+  Quat transform(initial_axis, axis);
+  transform.inverse();
+  V3D localObserver = observer - centre;
+  transform.rotate(localObserver);
 
-  // Do the base cap which is a point at the centre and nslices points around it
   constexpr double angle_step =
       2 * M_PI / static_cast<double>(Cylinder::g_NSLICES);
+  // The facets of a slice lie in a plane at this distance from the axis. Only
+  // facets with the observer outside of their plane face the observer.
+  const double facetDistance = radius * std::cos(0.5 * angle_step);
 
   const double z_step = height / Cylinder::g_NSTACKS;
-  double z0(0.0), z1(z_step);
   double solid_angle(0.0);
-  for (int st = 1; st <= Cylinder::g_NSTACKS; ++st) {
-    if (st == Cylinder::g_NSTACKS)
-      z1 = height;
-
-    for (int sl = 0; sl < Cylinder::g_NSLICES; ++sl) {
-      double x = radius * std::cos(angle_step * sl);
-      double y = radius * std::sin(angle_step * sl);
-      V3D pt1 = V3D(x, y, z0);
-      V3D pt2 = V3D(x, y, z1);
-      int vertex = (sl + 1) % Cylinder::g_NSLICES;
-      x = radius * std::cos(angle_step * vertex);
-      y = radius * std::sin(angle_step * vertex);
-      V3D pt3 = V3D(x, y, z0);
-      V3D pt4 = V3D(x, y, z1);
-      // Rotations
-      transform.rotate(pt1);
-      transform.rotate(pt3);
-      transform.rotate(pt2);
-      transform.rotate(pt4);
-
-      pt1 += centre;
-      pt2 += centre;
-      pt3 += centre;
-      pt4 += centre;
-
-      double sa = triangleSolidAngle(pt1, pt4, pt3, observer);
+  for (int sl = 0; sl < Cylinder::g_NSLICES; ++sl) {
+    const double midAngle = angle_step * (sl + 0.5);
+    if (localObserver.X() * std::cos(midAngle) +
+            localObserver.Y() * std::sin(midAngle) <=
+        facetDistance)
+      continue;
+    const double x0 = radius * std::cos(angle_step * sl);
+    const double y0 = radius * std::sin(angle_step * sl);
+    const int vertex = (sl + 1) % Cylinder::g_NSLICES;
+    const double x1 = radius * std::cos(angle_step * vertex);
+    const double y1 = radius * std::sin(angle_step * vertex);
+
+    double z0(0.0), z1(z_step);
+    for (int st = 1; st <= Cylinder::g_NSTACKS; ++st) {
+      if (st == Cylinder::g_NSTACKS)
+        z1 = height;
+      const V3D pt1(x0, y0, z0);
+      const V3D pt2(x0, y0, z1);
+      const V3D pt3(x1, y1, z0);
+      const V3D pt4(x1, y1, z1);
+
+      double sa = triangleSolidAngle(pt1, pt4, pt3, localObserver);
       if (sa > 0.0) {
         solid_angle += sa;
       }
-      sa = triangleSolidAngle(pt1, pt2, pt4, observer);
+      sa = triangleSolidAngle(pt1, pt2, pt4, localObserver);
       if (sa > 0.0) {
         solid_angle += sa;
       }
+      z0 = z1;
+      z1 += z_step;
     }
-    z0 = z1;
-    z1 += z_step;
   }
 
   return solid_angle;
@@ -0,0 +1,168 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/DetectorSpatialIndex.h"
+#include "MantidGeometry/Instrument/InstrumentVisitor.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+namespace {
+std::vector<DetectorSpatialIndex::Neighbour>
+bruteForce(const DetectorInfo &detInfo, const V3D &point) {
+  std::vector<DetectorSpatialIndex::Neighbour> result;
+  for (size_t i = 0; i < detInfo.size(); ++i)
+    if (!detInfo.isMonitor(i))
+      result.emplace_back(i, detInfo.position(i).distance(point));
+  std::stable_sort(result.begin(), result.end(),
+                   [](const auto &a, const auto &b) {
+                     return a.second < b.second;
+                   });
+  return result;
+}
+} // namespace
+
+class DetectorSpatialIndexTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static DetectorSpatialIndexTest *createSuite() {
+    return new DetectorSpatialIndexTest();
+  }
+  static void destroySuite(DetectorSpatialIndexTest *suite) { delete suite; }
+
+  DetectorSpatialIndexTest() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(2, 10);
+    m_wrappers = InstrumentVisitor::makeWrappers(*instrument);
+  }
+
+  void test_size_excludes_monitors() {
+    const auto &detInfo = *m_wrappers.second;
+    const DetectorSpatialIndex index(detInfo);
+    size_t nonMonitors = 0;
+    for (size_t i = 0; i < detInfo.size(); ++i)
+      if (!detInfo.isMonitor(i))
+        ++nonMonitors;
+    TS_ASSERT_EQUALS(index.size(), nonMonitors);
+  }
+
+  void test_nearest_matches_brute_force() {
+    const auto &detInfo = *m_wrappers.second;
+    const DetectorSpatialIndex index(detInfo);
+    const V3D point = detInfo.position(17) + V3D(0.001, -0.002, 0.0005);
+    const auto expected = bruteForce(detInfo, point);
+    const auto result = index.nearest(point, 5);
+    TS_ASSERT_EQUALS(result.size(), 5);
+    for (size_t i = 0; i < result.size(); ++i)
+      TS_ASSERT_DELTA(result[i].second, expected[i].second, 1e-12);
+    TS_ASSERT_EQUALS(result.front().first, 17);
+  }
+
+  void test_inRadius_matches_brute_force() {
+    const auto &detInfo = *m_wrappers.second;
+    const DetectorSpatialIndex index(detInfo);
+    const V3D point = detInfo.position(42);
+    const double radius = 0.02;
+    const auto expected = bruteForce(detInfo, point);
+    const auto count = std::count_if(
+        expected.begin(), expected.end(),
+        [radius](const auto &item) { return item.second <= radius; });
+    const auto result = index.inRadius(point, radius);
+    TS_ASSERT_EQUALS(result.size(), count);
+    for (const auto &item : result)
+      TS_ASSERT(item.second <= radius);
+    TS_ASSERT_THROWS(index.inRadius(point, -1.0),
+                     const std::invalid_argument &);
+  }
+
+  void test_neighbours_excludes_self() {
+    const auto &detInfo = *m_wrappers.second;
+    const DetectorSpatialIndex index(detInfo);
+    // Interior pixel of a 10x10 bank with 8 mm spacing has 4 neighbours at
+    // 8 mm and 4 at 8*sqrt(2) mm.
+    const auto result = index.neighbours(55, 8);
+    TS_ASSERT_EQUALS(result.size(), 8);
+    for (const auto &item : result)
+      TS_ASSERT_DIFFERS(item.first, 55);
+    TS_ASSERT_DELTA(result[3].second, 0.008, 1e-9);
+    TS_ASSERT_DELTA(result[4].second, 0.008 * std::sqrt(2.0), 1e-9);
+    const auto inRadius = index.neighboursInRadius(55, 0.0081);
+    TS_ASSERT_EQUALS(inRadius.size(), 4);
+  }
+
+  void test_detectorInfo_caches_index() {
+    const auto &detInfo = *m_wrappers.second;
+    const auto &first = detInfo.spatialIndex();
+    const auto &second = detInfo.spatialIndex();
+    TS_ASSERT_EQUALS(&first, &second);
+  }
+
+  void test_detectorInfo_rebuilds_index_after_move() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(1, 4);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &detInfo = *wrappers.second;
+    const V3D farAway(100.0, 100.0, 100.0);
+    TS_ASSERT_DIFFERS(detInfo.spatialIndex().nearest(farAway, 1)[0].second,
+                      0.0);
+    detInfo.setPosition(3, farAway);
+    const auto result = detInfo.spatialIndex().nearest(farAway, 1);
+    TS_ASSERT_EQUALS(result[0].first, 3);
+    TS_ASSERT_DELTA(result[0].second, 0.0, 1e-12);
+  }
+
+  void test_index_rebuilt_after_component_move() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(1, 4);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &compInfo = *wrappers.first;
+    auto &detInfo = *wrappers.second;
+    const auto position = detInfo.position(0);
+    TS_ASSERT_DELTA(detInfo.spatialIndex().nearest(position, 1)[0].second, 0.0,
+                    1e-12);
+    const auto bank = compInfo.parent(0);
+    compInfo.setPosition(bank, compInfo.position(bank) + V3D(0.0, 0.0, 1.0));
+    const auto result = detInfo.spatialIndex().nearest(position, 1);
+    TS_ASSERT_DELTA(result[0].second, 1.0, 1e-12);
+  }
+
+  void test_nearest_with_scale() {
+    const auto &index = m_wrappers.second->spatialIndex();
+    const auto &detInfo = *m_wrappers.second;
+    const auto point = detInfo.position(0);
+    // Stretching one axis changes which neighbours are nearest
+    const V3D scale(1.0, 1000.0, 1000.0);
+    std::vector<double> expected;
+    for (size_t i = 0; i < detInfo.size(); ++i)
+      if (!detInfo.isMonitor(i))
+        expected.emplace_back(
+            ((detInfo.position(i) - point) * V3D(1.0, 1e-3, 1e-3)).norm());
+    std::sort(expected.begin(), expected.end());
+    const auto result = index.nearest(point, 3, scale);
+    TS_ASSERT_EQUALS(result.size(), 3);
+    for (size_t i = 0; i < result.size(); ++i) {
+      const auto offset = detInfo.position(result[i].first) - point;
+      TS_ASSERT_DELTA(result[i].second,
+                      (offset * V3D(1.0, 1e-3, 1e-3)).norm(), 1e-12);
+      TS_ASSERT_DELTA(result[i].second, expected[i], 1e-12);
+    }
+    TS_ASSERT_THROWS(index.nearest(point, 3, V3D(1.0, 0.0, 1.0)),
+                     const std::invalid_argument &);
+  }
+
+private:
+  std::pair<std::unique_ptr<ComponentInfo>, std::unique_ptr<DetectorInfo>>
+      m_wrappers;
+};
@@ -10,10 +10,12 @@
 #include "MantidGeometry/Math/Quadrilateral.h"
 
 #include <cxxtest/TestSuite.h>
+#include <vector>
 
 using Mantid::Geometry::ConvexPolygon;
 using Mantid::Geometry::intersection;
 using Mantid::Geometry::Quadrilateral;
+using Mantid::Geometry::RectangleOverlap;
 using Mantid::Kernel::V2D;
 
 class PolygonIntersectionTest : public CxxTest::TestSuite {
@@ -215,6 +217,99 @@ public:
     TS_ASSERT(intersection(squareOne, squareTwo, overlap));
     TS_ASSERT(overlap.isValid());
   }
+
+  void test_Rectangle_Overlap_Of_Axis_Aligned_Squares() {
+    Quadrilateral square(0.0, 2.0, 0.0, 2.0);
+    RectangleOverlap overlap;
+    TS_ASSERT(intersection(square, 1.0, 3.0, 1.0, 3.0, overlap));
+    TS_ASSERT_DELTA(overlap.area, 1.0, 1e-12);
+    TS_ASSERT_DELTA(overlap.minX, 1.0, 1e-12);
+    TS_ASSERT_DELTA(overlap.maxX, 2.0, 1e-12);
+  }
+
+  void test_Rectangle_Overlap_Matches_General_Intersection() {
+    // Sheared and rotated quadrilaterals with a clockwise winding
+    const std::vector<Quadrilateral> quads{
+        Quadrilateral(V2D(0.2, 0.1), V2D(1.7, 0.4), V2D(1.7, 1.9),
+                      V2D(0.2, 1.6)),
+        Quadrilateral(V2D(1.0, -0.3), V2D(2.4, 1.0), V2D(1.0, 2.3),
+                      V2D(-0.4, 1.0)),
+        Quadrilateral(V2D(0.5, 0.5), V2D(1.5, 0.6), V2D(1.4, 1.3),
+                      V2D(0.6, 1.2))};
+    for (const auto &quad : quads) {
+      double total = 0.;
+      for (double x = -0.5; x < 2.5; x += 0.5) {
+        for (double y = -0.5; y < 2.5; y += 0.5) {
+          const Quadrilateral bin(x, x + 0.5, y, y + 0.5);
+          ConvexPolygon expected;
+          RectangleOverlap overlap;
+          if (intersection(quad, x, x + 0.5, y, y + 0.5, overlap)) {
+            TS_ASSERT(intersection(bin, quad, expected));
+            TS_ASSERT_DELTA(overlap.area, expected.area(), 1e-12);
+            TS_ASSERT_DELTA(overlap.minX, expected.minX(), 1e-12);
+            TS_ASSERT_DELTA(overlap.maxX, expected.maxX(), 1e-12);
+            total += overlap.area;
+          } else if (intersection(bin, quad, expected)) {
+            TS_ASSERT_DELTA(expected.area(), 0.0, 1e-12);
+          }
+        }
+      }
+      TS_ASSERT_DELTA(total, quad.area(), 1e-12);
+    }
+  }
+
+  void test_Rectangle_Overlap_With_A_Vertex_Clipped_At_Each_Edge() {
+    // Each corner of the diamond is cut off, leaving an octagon
+    Quadrilateral diamond(V2D(2.0, 0.0), V2D(0.0, 2.0), V2D(-2.0, 0.0),
+                          V2D(0.0, -2.0));
+    RectangleOverlap overlap;
+    TS_ASSERT(intersection(diamond, -1.5, 1.5, -1.5, 1.5, overlap));
+    TS_ASSERT_DELTA(overlap.area, 7.0, 1e-12);
+    TS_ASSERT_DELTA(overlap.minX, -1.5, 1e-12);
+    TS_ASSERT_DELTA(overlap.maxX, 1.5, 1e-12);
+  }
+
+  void test_Rectangle_Overlap_Of_Disjoint_Or_Touching_Shapes_Is_Empty() {
+    Quadrilateral square(0.0, 1.0, 0.0, 1.0);
+    RectangleOverlap overlap;
+    TS_ASSERT(!intersection(square, 2.0, 3.0, 0.0, 1.0, overlap));
+    TS_ASSERT(!intersection(square, 1.0, 2.0, 0.0, 1.0, overlap));
+    TS_ASSERT(!intersection(square, 0.0, 1.0, -1.0, 0.0, overlap));
+  }
+
+  void test_Rectangle_Overlap_Of_Non_Convex_Quad_Uses_General_Intersection() {
+    // An arrowhead with a reflex vertex at (1.0, 0.6)
+    Quadrilateral dart(V2D(0.1, 0.1), V2D(1.0, 0.6), V2D(1.9, 0.1),
+                       V2D(1.0, 1.9));
+    checkRectangleOverlapMatchesGeneralIntersection(dart);
+  }
+
+  void test_Rectangle_Overlap_Of_Bowtie_Quad_Uses_General_Intersection() {
+    // Self-intersecting with the crossing at (1.0, 1.0)
+    Quadrilateral bowtie(V2D(0.1, 0.1), V2D(1.9, 1.9), V2D(1.9, 0.1),
+                         V2D(0.1, 1.9));
+    checkRectangleOverlapMatchesGeneralIntersection(bowtie);
+  }
+
+private:
+  void checkRectangleOverlapMatchesGeneralIntersection(
+      const Quadrilateral &quad) {
+    for (double x = -0.5; x < 2.5; x += 0.5) {
+      for (double y = -0.5; y < 2.5; y += 0.5) {
+        const Quadrilateral bin(x, x + 0.5, y, y + 0.5);
+        ConvexPolygon expected;
+        RectangleOverlap overlap;
+        if (intersection(quad, x, x + 0.5, y, y + 0.5, overlap)) {
+          TS_ASSERT(intersection(bin, quad, expected));
+          TS_ASSERT_DELTA(overlap.area, expected.area(), 1e-12);
+          TS_ASSERT_DELTA(overlap.minX, expected.minX(), 1e-12);
+          TS_ASSERT_DELTA(overlap.maxX, expected.maxX(), 1e-12);
+        } else if (intersection(bin, quad, expected)) {
+          TS_ASSERT_DELTA(expected.area(), 0.0, 1e-12);
+        }
+      }
+    }
+  }
 };
 
 //------------------------------------------------------------------------
@@ -238,4 +333,13 @@ public:
       intersection(squareOne, squareTwo, overlap);
     }
   }
+
+  void test_Rectangle_Overlap_Of_Large_Number() {
+    const size_t niters(100000);
+    RectangleOverlap overlap;
+    for (size_t i = 0; i < niters; ++i) {
+      Quadrilateral squareOne(0.0, 2.0, 0.0, 2.0);
+      intersection(squareOne, 1.0, 3.0, 1.0, 3.0, overlap);
+    }
+  }
 };
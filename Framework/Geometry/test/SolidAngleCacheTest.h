@@ -0,0 +1,111 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/InstrumentVisitor.h"
+#include "MantidGeometry/Instrument/SolidAngleCache.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+class SolidAngleCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SolidAngleCacheTest *createSuite() {
+    return new SolidAngleCacheTest();
+  }
+  static void destroySuite(SolidAngleCacheTest *suite) { delete suite; }
+
+  void test_values_match_shape() {
+    auto cylinder = ComponentCreationHelper::createCappedCylinder(
+        0.01, 0.2, V3D(0.0, -0.1, 0.0), V3D(0.0, 1.0, 0.0), "tube");
+    SolidAngleCache cache;
+    const V3D observer(0.3, 0.05, -2.0);
+    const V3D unitScale(1.0, 1.0, 1.0);
+    TS_ASSERT_EQUALS(cache.solidAngle(*cylinder, observer, unitScale),
+                     cylinder->solidAngle(observer));
+    const V3D scale(1.0, 2.0, 1.0);
+    TS_ASSERT_EQUALS(cache.solidAngle(*cylinder, observer, scale),
+                     cylinder->solidAngle(observer, scale));
+  }
+
+  void test_repeated_queries_are_cached() {
+    auto cuboid = ComponentCreationHelper::createCuboid(0.01, 0.02, 0.005);
+    SolidAngleCache cache;
+    const V3D unitScale(1.0, 1.0, 1.0);
+    const double first = cache.solidAngle(*cuboid, V3D(0, 0, -1), unitScale);
+    TS_ASSERT_EQUALS(cache.size(), 1);
+    TS_ASSERT_EQUALS(cache.solidAngle(*cuboid, V3D(0, 0, -1), unitScale),
+                     first);
+    TS_ASSERT_EQUALS(cache.size(), 1);
+    cache.solidAngle(*cuboid, V3D(0, 0.1, -1), unitScale);
+    TS_ASSERT_EQUALS(cache.size(), 2);
+    cache.clear();
+    TS_ASSERT_EQUALS(cache.size(), 0);
+  }
+
+  void test_size_is_bounded() {
+    auto cuboid = ComponentCreationHelper::createCuboid(0.01);
+    SolidAngleCache cache(64);
+    const V3D unitScale(1.0, 1.0, 1.0);
+    for (int i = 0; i < 1000; ++i)
+      cache.solidAngle(*cuboid, V3D(0.001 * i, 0.0, -1.0), unitScale);
+    TS_ASSERT_LESS_THAN_EQUALS(cache.size(), 64);
+  }
+
+  void test_full_cache_evicts_only_part() {
+    auto cuboid = ComponentCreationHelper::createCuboid(0.01);
+    SolidAngleCache cache(32 * 64);
+    const V3D unitScale(1.0, 1.0, 1.0);
+    for (int i = 0; i < 10000; ++i)
+      cache.solidAngle(*cuboid, V3D(0.001 * i, 0.0, -1.0), unitScale);
+    TS_ASSERT_LESS_THAN_EQUALS(cache.size(), 32 * 64);
+    // Every shard is full or close to it, not emptied
+    TS_ASSERT_LESS_THAN(32 * 64 / 2, cache.size());
+  }
+
+  void test_zero_size_disables_caching() {
+    auto cuboid = ComponentCreationHelper::createCuboid(0.01);
+    SolidAngleCache cache(0);
+    const V3D observer(0, 0, -1);
+    const V3D unitScale(1.0, 1.0, 1.0);
+    TS_ASSERT_EQUALS(cache.solidAngle(*cuboid, observer, unitScale),
+                     cuboid->solidAngle(observer));
+    TS_ASSERT_EQUALS(cache.size(), 0);
+  }
+
+  void test_componentInfo_clearSolidAngleCache() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(1);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &compInfo = *wrappers.first;
+    const auto samplePos = compInfo.samplePosition();
+    const double before = compInfo.solidAngle(0, samplePos);
+    compInfo.clearSolidAngleCache();
+    TS_ASSERT_EQUALS(compInfo.solidAngle(0, samplePos), before);
+  }
+
+  void test_componentInfo_solid_angle_after_move() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(1);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &compInfo = *wrappers.first;
+    auto &detInfo = *wrappers.second;
+    const auto samplePos = compInfo.samplePosition();
+    const double before = compInfo.solidAngle(0, samplePos);
+    TS_ASSERT_EQUALS(compInfo.solidAngle(0, samplePos), before);
+    // Move the detector twice as far away from the sample
+    detInfo.setPosition(0, samplePos + (detInfo.position(0) - samplePos) * 2.0);
+    TS_ASSERT_LESS_THAN(compInfo.solidAngle(0, samplePos), before);
+  }
+};
@@ -6,13 +6,46 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidHistogramData/BinEdges.h"
 #include "MantidHistogramData/DllConfig.h"
+
+#include <vector>
+
 namespace Mantid {
 namespace HistogramData {
 class Histogram;
-class BinEdges;
 
 MANTID_HISTOGRAMDATA_DLL Histogram rebin(const Histogram &input,
                                          const BinEdges &binEdges);
+
+/** Rebinner rebins histograms from one set of bin edges to another, giving
+  the same result as rebin(). The overlaps of the input and output bins are
+  computed once on construction and stored as a sparse matrix, so rebinning
+  many histograms with the same bin edges, e.g. all spectra of a workspace
+  with common bins, does not repeat the search for overlapping bins.
+*/
+class MANTID_HISTOGRAMDATA_DLL Rebinner {
+public:
+  Rebinner(const BinEdges &input, const BinEdges &output);
+
+  Histogram rebin(const Histogram &input) const;
+
+private:
+  Histogram rebinCounts(const Histogram &input) const;
+  Histogram rebinFrequencies(const Histogram &input) const;
+
+  /// The output bin edges
+  BinEdges m_output;
+  /// The number of input bins
+  size_t m_inputSize;
+  /// The overlaps of output bin i are in [m_offsets[i], m_offsets[i + 1])
+  std::vector<size_t> m_offsets;
+  /// The input bin of each overlap
+  std::vector<size_t> m_inputIndices;
+  /// The width of each overlap
+  std::vector<double> m_overlaps;
+  /// The width of the input bin of each overlap
+  std::vector<double> m_inputWidths;
+};
 } // namespace HistogramData
 } // namespace Mantid
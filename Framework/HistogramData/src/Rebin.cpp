@@ -162,5 +162,140 @@ Histogram rebin(const Histogram &input, const BinEdges &binEdges) {
     throw std::runtime_error("YMode must be defined for input histogram.");
 }
 
+/** Computes the overlaps of the input and output bins.
+ * @param input :: bin edges of the histograms to be rebinned.
+ * @param output :: bin edges of the rebinned histograms.
+ * @throws InvalidBinEdgesError for non-positive input/output bin widths
+ */
+Rebinner::Rebinner(const BinEdges &input, const BinEdges &output)
+    : m_output(output), m_inputSize(input.size() < 2 ? 0 : input.size() - 1) {
+  auto &xold = input.rawData();
+  auto &xnew = output.rawData();
+  const size_t size_ynew = xnew.size() < 2 ? 0 : xnew.size() - 1;
+  m_offsets.assign(size_ynew + 1, 0);
+
+  size_t iold = 0;
+  size_t inew = 0;
+  // Same walk over the bins as rebinCounts and rebinFrequencies above
+  while ((inew < size_ynew) && (iold < m_inputSize)) {
+    auto xo_low = xold[iold];
+    auto xo_high = xold[iold + 1];
+    auto xn_low = xnew[inew];
+    auto xn_high = xnew[inew + 1];
+    auto owidth = xo_high - xo_low;
+    auto nwidth = xn_high - xn_low;
+
+    if (owidth <= 0.0 || nwidth <= 0.0) {
+      if (xo_high == -DBL_MAX && xo_low == -DBL_MAX) {
+        throw InvalidBinEdgesError(
+            "One or more x-values was unusually low "
+            "(below -1e100). This usually occurs when a "
+            "monitor spectrum has not been masked after "
+            "ConvertUnits has been run on the workspace");
+      } else {
+        throw InvalidBinEdgesError("Negative or zero bin widths not allowed.");
+      }
+    }
+
+    if (xn_high <= xo_low)
+      inew++; /* old and new bins do not overlap */
+    else if (xo_high <= xn_low)
+      iold++; /* old and new bins do not overlap */
+    else {
+      // delta is the overlap of the bins on the x axis
+      auto delta = xo_high < xn_high ? xo_high : xn_high;
+      delta -= xo_low > xn_low ? xo_low : xn_low;
+
+      ++m_offsets[inew + 1];
+      m_inputIndices.emplace_back(iold);
+      m_overlaps.emplace_back(delta);
+      m_inputWidths.emplace_back(owidth);
+
+      if (xn_high > xo_high) {
+        iold++;
+      } else {
+        inew++;
+      }
+    }
+  }
+  std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+}
+
+/** Rebins a histogram using the precomputed bin overlaps.
+ * @param input :: input histogram data to be rebinned. Its bin edges must be
+ * those passed as input to the constructor.
+ * @returns The rebinned histogram.
+ * @throws std::runtime_error if the input histogram xmode is not BinEdges,
+ * the input yMode is undefined or the size of the input does not match
+ */
+Histogram Rebinner::rebin(const Histogram &input) const {
+  if (input.xMode() != Histogram::XMode::BinEdges)
+    throw std::runtime_error(
+        "XMode must be Histogram::XMode::BinEdges for input histogram");
+  if (input.size() != m_inputSize)
+    throw std::runtime_error(
+        "Size of input histogram does not match the Rebinner.");
+  if (input.yMode() == Histogram::YMode::Counts)
+    return rebinCounts(input);
+  else if (input.yMode() == Histogram::YMode::Frequencies)
+    return rebinFrequencies(input);
+  else
+    throw std::runtime_error("YMode must be defined for input histogram.");
+}
+
+Histogram Rebinner::rebinCounts(const Histogram &input) const {
+  auto &yold = input.y();
+  auto &eold = input.e();
+
+  const size_t size_ynew = m_offsets.size() - 1;
+  Counts newCounts(size_ynew);
+  CountVariances newCountVariances(size_ynew);
+  auto &ynew = newCounts.mutableData();
+  auto &enew = newCountVariances.mutableData();
+
+  for (size_t inew = 0; inew < size_ynew; ++inew) {
+    double y = 0.0;
+    double e = 0.0;
+    for (size_t k = m_offsets[inew]; k < m_offsets[inew + 1]; ++k) {
+      const auto iold = m_inputIndices[k];
+      y += yold[iold] * m_overlaps[k] / m_inputWidths[k];
+      e += eold[iold] * eold[iold] * m_overlaps[k] / m_inputWidths[k];
+    }
+    ynew[inew] = y;
+    enew[inew] = e;
+  }
+
+  return Histogram(m_output, newCounts,
+                   CountStandardDeviations(std::move(newCountVariances)));
+}
+
+Histogram Rebinner::rebinFrequencies(const Histogram &input) const {
+  auto &yold = input.y();
+  auto &eold = input.e();
+
+  auto &xnew = m_output.rawData();
+  const size_t size_ynew = m_offsets.size() - 1;
+  Frequencies newFrequencies(size_ynew);
+  FrequencyStandardDeviations newFrequencyStdDev(size_ynew);
+  auto &ynew = newFrequencies.mutableData();
+  auto &enew = newFrequencyStdDev.mutableData();
+
+  for (size_t inew = 0; inew < size_ynew; ++inew) {
+    double y = 0.0;
+    double e = 0.0;
+    for (size_t k = m_offsets[inew]; k < m_offsets[inew + 1]; ++k) {
+      const auto iold = m_inputIndices[k];
+      y += yold[iold] * m_overlaps[k];
+      e += eold[iold] * eold[iold] * m_overlaps[k] * m_inputWidths[k];
+    }
+    auto width = xnew[inew + 1] - xnew[inew];
+    auto factor = 1 / width;
+    ynew[inew] = y * factor;
+    enew[inew] = sqrt(e) * factor;
+  }
+
+  return Histogram(m_output, newFrequencies, newFrequencyStdDev);
+}
+
 } // namespace HistogramData
 } // namespace Mantid
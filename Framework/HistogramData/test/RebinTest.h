@@ -388,6 +388,50 @@ public:
     TS_ASSERT_EQUALS(outFreq.e()[2], 0);
   }
 
+  void testRebinnerMatchesRebin() {
+    const std::vector<BinEdges> outputs{
+        BinEdges(10, LinearGenerator(0, 0.5)),
+        BinEdges(4, LinearGenerator(-1, 3.5)),
+        BinEdges{0.5, 1.25, 3.0, 3.1, 7.0, 12.0},
+        BinEdges{20.0, 21.0, 22.0}};
+    const auto counts = getCountsHistogram();
+    const auto frequencies = getFrequencyHistogram();
+    for (const auto &edges : outputs) {
+      const Rebinner rebinner(counts.binEdges(), edges);
+      for (const auto &input : {counts, frequencies}) {
+        const auto expected = rebin(input, edges);
+        const auto result = rebinner.rebin(input);
+        TS_ASSERT_EQUALS(result.yMode(), expected.yMode());
+        TS_ASSERT_EQUALS(result.x(), expected.x());
+        TS_ASSERT_EQUALS(result.y(), expected.y());
+        TS_ASSERT_EQUALS(result.e(), expected.e());
+      }
+    }
+  }
+
+  void testRebinnerSharesOutputBinEdges() {
+    BinEdges edges(4, LinearGenerator(0, 3));
+    const Rebinner rebinner(getCountsHistogram().binEdges(), edges);
+    const auto result = rebinner.rebin(getCountsHistogram());
+    TS_ASSERT_EQUALS(result.sharedX(), edges.cowData());
+  }
+
+  void testRebinnerFailsBinEdgesInvalid() {
+    std::vector<double> binEdges{1, 2, 3, 3, 5, 7};
+    BinEdges edges(std::move(binEdges));
+    TS_ASSERT_THROWS(Rebinner(getCountsHistogram().binEdges(), edges),
+                     const InvalidBinEdgesError &);
+    TS_ASSERT_THROWS(Rebinner(edges, BinEdges(10, LinearGenerator(0, 0.5))),
+                     const InvalidBinEdgesError &);
+  }
+
+  void testRebinnerFailsSizeMismatch() {
+    const Rebinner rebinner(BinEdges(5, LinearGenerator(0, 1)),
+                            BinEdges(3, LinearGenerator(0, 2)));
+    TS_ASSERT_THROWS(rebinner.rebin(getCountsHistogram()),
+                     const std::runtime_error &);
+  }
+
 private:
   Histogram getCountsHistogram() {
     return Histogram(BinEdges(10, LinearGenerator(0, 1)),
@@ -443,6 +487,18 @@ public:
       rebin(histFreq, lgBins);
   }
 
+  void testRebinnerCountsSmallerBins() {
+    const Rebinner rebinner(hist.binEdges(), smBins);
+    for (size_t i = 0; i < nIters; i++)
+      rebinner.rebin(hist);
+  }
+
+  void testRebinnerCountsLargerBins() {
+    const Rebinner rebinner(hist.binEdges(), lgBins);
+    for (size_t i = 0; i < nIters; i++)
+      rebinner.rebin(hist);
+  }
+
 private:
   const size_t binSize = 10000;
   const size_t nIters = 10000;
@@ -9,6 +9,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <set>
 #include <stdexcept>
 #include <vector>
@@ -137,6 +138,21 @@ IndexSet<T>::IndexSet(int64_t min, int64_t max, size_t fullRange) {
 template <class T>
 IndexSet<T>::IndexSet(const std::vector<size_t> &indices, size_t fullRange)
     : m_isRange(false) {
+  // Strictly increasing indices are unique without sorting, and if they are
+  // contiguous they are stored as a range.
+  if (std::adjacent_find(indices.begin(), indices.end(),
+                         std::greater_equal<size_t>()) == indices.end()) {
+    if (!indices.empty() && indices.back() >= fullRange)
+      throw std::out_of_range("IndexSet: specified index is out of range");
+    m_size = indices.size();
+    if (m_size == 0 || indices.back() - indices.front() + 1 == m_size) {
+      m_isRange = true;
+      m_min = m_size == 0 ? 0 : indices.front();
+    } else {
+      m_indices = indices;
+    }
+    return;
+  }
   // Validate indices, using m_indices as buffer (reassigned later).
   m_indices = indices;
   std::sort(m_indices.begin(), m_indices.end());
@@ -60,6 +60,8 @@ public:
 private:
   bool isPartitioned() const;
   void checkUniqueSpectrumNumbers() const;
+  void setupSpectrumNumberLookup();
+  size_t globalIndexOf(const SpectrumNumber spectrumNumber) const;
   // Not thread-safe! Use only in combination with std::call_once!
   void setupSpectrumNumberToIndexMap() const;
   std::vector<SpectrumNumber>
@@ -75,11 +77,24 @@ private:
 
   bool m_isPartitioned;
   const PartitionIndex m_partition;
-  std::unordered_map<SpectrumNumber, PartitionIndex, SpectrumNumberHash>
-      m_spectrumNumberToPartition;
+  /// Partition of each global spectrum index.
+  std::vector<PartitionIndex> m_partitions;
+  /// Number of local spectra before each global spectrum index, i.e., the
+  /// local index of each local spectrum. The last entry is the local size.
+  std::vector<size_t> m_localOffsets;
+  /// Global index of spectrum number m_minSpectrumNumber + i, used if the
+  /// spectrum numbers are dense.
+  std::vector<size_t> m_denseGlobalIndices;
+  /// Global index of each spectrum number, used if the numbers are sparse.
+  std::unordered_map<SpectrumNumber, size_t, SpectrumNumberHash>
+      m_sparseGlobalIndices;
+  SpectrumNumber m_minSpectrumNumber{0};
+  bool m_hasDuplicates{false};
+  bool m_isSorted{true};
+  /// Sorted spectrum numbers and local indices, only set up if the spectrum
+  /// numbers are sparse and unsorted.
   mutable std::vector<std::pair<SpectrumNumber, size_t>>
       m_spectrumNumberToIndex;
-  std::vector<std::pair<GlobalSpectrumIndex, size_t>> m_globalToLocal;
   std::vector<SpectrumNumber> m_spectrumNumbers;
   std::vector<SpectrumNumber> m_globalSpectrumNumbers;
 
@@ -6,6 +6,8 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidIndexing/SpectrumNumberTranslator.h"
 
+#include <limits>
+
 namespace Mantid {
 namespace Indexing {
 
@@ -32,23 +34,12 @@ auto upper_bound(T &map, const Key key) -> decltype(map.begin()) {
                           });
 }
 
-template <class T, class Key>
-auto find(T &map, const Key key) -> decltype(map.begin()) {
-  auto it = lower_bound(map, key);
-  if ((it != map.end()) && (std::get<0>(*it) == key))
-    return it;
-  return map.end();
-}
+/// Marks spectrum numbers that do not exist in the dense lookup table.
+constexpr size_t invalidIndex = std::numeric_limits<size_t>::max();
 
-template <class MapT, class KeyT>
-void checkPartitionContainsValue(const MapT &map, const KeyT key) {
-  // These can be replaced with .contains(x) in C++-20
-  auto it = map.find(key);
-  if (it == map.end()) {
-    throw std::out_of_range("The following value is out of range: " +
-                            key.str());
-  }
-}
+/// Spectrum numbers spanning more than this factor times the number of spectra
+/// use a hash map instead of a dense lookup table.
+constexpr int64_t maxDenseSpan = 4;
 } // namespace
 
 SpectrumNumberTranslator::SpectrumNumberTranslator(
@@ -57,30 +48,22 @@ SpectrumNumberTranslator::SpectrumNumberTranslator(
     : m_partition(partition), m_globalSpectrumNumbers(spectrumNumbers) {
   partitioner.checkValid(m_partition);
 
+  m_partitions.reserve(m_globalSpectrumNumbers.size());
+  m_localOffsets.reserve(m_globalSpectrumNumbers.size() + 1);
   size_t currentIndex = 0;
   for (size_t i = 0; i < m_globalSpectrumNumbers.size(); ++i) {
     auto partition = partitioner.indexOf(GlobalSpectrumIndex(i));
-    auto number = m_globalSpectrumNumbers[i];
-    m_spectrumNumberToPartition.emplace(number, partition);
+    m_partitions.emplace_back(partition);
+    m_localOffsets.emplace_back(currentIndex);
     if (partition == m_partition) {
-      m_spectrumNumberToIndex.emplace_back(number, currentIndex);
-      m_globalToLocal.emplace_back(GlobalSpectrumIndex(i), currentIndex);
       if (partitioner.numberOfPartitions() > 1)
-        m_spectrumNumbers.emplace_back(number);
+        m_spectrumNumbers.emplace_back(m_globalSpectrumNumbers[i]);
       ++currentIndex;
     }
   }
-  // Careful: Do NOT use maps of spectrum numbers for size check, since those
-  // can (currently) be smaller than the actual size due to duplicate spectrum
-  // numbers.
-  m_isPartitioned = (m_globalToLocal.size() != m_globalSpectrumNumbers.size());
-
-  // At this point, m_globalToLocal is sorted by construction so it can be used
-  // as a "map" (using methods from the anonymous namespace above).
-  // m_spectrumNumberToIndex is not sorted. It will be sorted in makeIndexSet()
-  // if required. The reason for postponing this is a potentially expensive
-  // setup that is not required unless specific vecsions of makeIndexSet() are
-  // called.
+  m_localOffsets.emplace_back(currentIndex);
+  m_isPartitioned = (currentIndex != m_globalSpectrumNumbers.size());
+  setupSpectrumNumberLookup();
 }
 
 SpectrumNumberTranslator::SpectrumNumberTranslator(
@@ -88,19 +71,21 @@ SpectrumNumberTranslator::SpectrumNumberTranslator(
     const SpectrumNumberTranslator &parent)
     : m_isPartitioned(parent.m_isPartitioned), m_partition(parent.m_partition),
       m_globalSpectrumNumbers(spectrumNumbers) {
+  m_partitions.reserve(m_globalSpectrumNumbers.size());
+  m_localOffsets.reserve(m_globalSpectrumNumbers.size() + 1);
   size_t currentIndex = 0;
-  for (size_t i = 0; i < m_globalSpectrumNumbers.size(); ++i) {
-    auto partition = parent.m_spectrumNumberToPartition.at(spectrumNumbers[i]);
-    auto number = m_globalSpectrumNumbers[i];
-    m_spectrumNumberToPartition.emplace(number, partition);
+  for (const auto number : m_globalSpectrumNumbers) {
+    auto partition = parent.m_partitions[parent.globalIndexOf(number)];
+    m_partitions.emplace_back(partition);
+    m_localOffsets.emplace_back(currentIndex);
     if (partition == m_partition) {
-      m_spectrumNumberToIndex.emplace_back(number, currentIndex);
-      m_globalToLocal.emplace_back(GlobalSpectrumIndex(i), currentIndex);
       if (m_isPartitioned)
         m_spectrumNumbers.emplace_back(number);
       ++currentIndex;
     }
   }
+  m_localOffsets.emplace_back(currentIndex);
+  setupSpectrumNumberLookup();
 }
 
 const std::vector<SpectrumNumber> &
@@ -117,18 +102,39 @@ SpectrumIndexSet
 SpectrumNumberTranslator::makeIndexSet(SpectrumNumber min,
                                        SpectrumNumber max) const {
   checkUniqueSpectrumNumbers();
-  checkPartitionContainsValue(m_spectrumNumberToPartition, min);
-  checkPartitionContainsValue(m_spectrumNumberToPartition, max);
+  const auto minIndex = globalIndexOf(min);
+  const auto maxIndex = globalIndexOf(max);
+
+  // Sorted spectrum numbers map to a range of global and thus local indices
+  if (m_isSorted) {
+    if (min > max)
+      return SpectrumIndexSet(0);
+    return makeIndexSet(GlobalSpectrumIndex(minIndex),
+                        GlobalSpectrumIndex(maxIndex));
+  }
 
-  std::call_once(m_mapSetup,
-                 &SpectrumNumberTranslator::setupSpectrumNumberToIndexMap,
-                 this);
   std::vector<size_t> indices;
-  const auto begin = lower_bound(m_spectrumNumberToIndex, min);
-  const auto end = upper_bound(m_spectrumNumberToIndex, max);
-  for (auto it = begin; it != end; ++it)
-    indices.emplace_back(it->second);
-  return SpectrumIndexSet(indices, m_spectrumNumberToIndex.size());
+  if (!m_denseGlobalIndices.empty()) {
+    const auto begin = static_cast<int32_t>(min) -
+                       static_cast<int32_t>(m_minSpectrumNumber);
+    const auto end = static_cast<int32_t>(max) -
+                     static_cast<int32_t>(m_minSpectrumNumber) + 1;
+    for (auto i = begin; i < end; ++i) {
+      const auto globalIndex = m_denseGlobalIndices[i];
+      if (globalIndex != invalidIndex &&
+          m_partitions[globalIndex] == m_partition)
+        indices.emplace_back(m_localOffsets[globalIndex]);
+    }
+  } else {
+    std::call_once(m_mapSetup,
+                   &SpectrumNumberTranslator::setupSpectrumNumberToIndexMap,
+                   this);
+    const auto begin = lower_bound(m_spectrumNumberToIndex, min);
+    const auto end = upper_bound(m_spectrumNumberToIndex, max);
+    for (auto it = begin; it < end; ++it)
+      indices.emplace_back(it->second);
+  }
+  return SpectrumIndexSet(indices, localSize());
 }
 
 SpectrumIndexSet
@@ -137,68 +143,121 @@ SpectrumNumberTranslator::makeIndexSet(GlobalSpectrumIndex min,
   if (min > max)
     throw std::logic_error(
         "SpectrumIndexTranslator: specified min is larger than max.");
-  if (max >= m_spectrumNumberToPartition.size())
+  if (max >= globalSize())
     throw std::out_of_range("The following value is out of range: " +
                             max.str());
 
-  const auto begin = lower_bound(m_globalToLocal, min);
-  const auto end = upper_bound(m_globalToLocal, max);
-  if (begin == m_globalToLocal.end() || end == m_globalToLocal.begin() ||
-      begin == end)
+  const auto begin = m_localOffsets[static_cast<size_t>(min)];
+  const auto end = m_localOffsets[static_cast<size_t>(max) + 1];
+  if (begin == end)
     return SpectrumIndexSet(0);
-  return SpectrumIndexSet(begin->second, std::prev(end)->second,
-                          m_globalToLocal.size());
+  return SpectrumIndexSet(begin, end - 1, localSize());
 }
 
 SpectrumIndexSet SpectrumNumberTranslator::makeIndexSet(
     const std::vector<SpectrumNumber> &spectrumNumbers) const {
   checkUniqueSpectrumNumbers();
-  std::call_once(m_mapSetup,
-                 &SpectrumNumberTranslator::setupSpectrumNumberToIndexMap,
-                 this);
   std::vector<size_t> indices;
   for (const auto &spectrumNumber : spectrumNumbers) {
-    checkPartitionContainsValue(m_spectrumNumberToPartition, spectrumNumber);
-
-    if (m_spectrumNumberToPartition.at(spectrumNumber) == m_partition)
-      indices.emplace_back(
-          find(m_spectrumNumberToIndex, spectrumNumber)->second);
+    const auto globalIndex = globalIndexOf(spectrumNumber);
+    if (m_partitions[globalIndex] == m_partition)
+      indices.emplace_back(m_localOffsets[globalIndex]);
   }
-  return SpectrumIndexSet(indices, m_spectrumNumberToIndex.size());
+  return SpectrumIndexSet(indices, localSize());
 }
 
 SpectrumIndexSet SpectrumNumberTranslator::makeIndexSet(
     const std::vector<GlobalSpectrumIndex> &globalIndices) const {
   std::vector<size_t> indices;
   for (const auto &globalIndex : globalIndices) {
-    if (globalIndex >= m_spectrumNumberToPartition.size())
+    if (globalIndex >= globalSize())
       throw std::out_of_range("The following value is out of range: " +
                               globalIndex.str());
-    const auto it = find(m_globalToLocal, globalIndex);
-    if (it != m_globalToLocal.end())
-      indices.emplace_back(it->second);
+    const auto index = static_cast<size_t>(globalIndex);
+    if (m_partitions[index] == m_partition)
+      indices.emplace_back(m_localOffsets[index]);
   }
-  return SpectrumIndexSet(indices, m_globalToLocal.size());
+  return SpectrumIndexSet(indices, localSize());
 }
 
 PartitionIndex SpectrumNumberTranslator::partitionOf(
     const GlobalSpectrumIndex globalIndex) const {
   checkUniqueSpectrumNumbers();
-  const auto spectrumNumber =
-      m_globalSpectrumNumbers[static_cast<size_t>(globalIndex)];
-  return m_spectrumNumberToPartition.at(spectrumNumber);
+  return m_partitions.at(static_cast<size_t>(globalIndex));
 }
 
 void SpectrumNumberTranslator::checkUniqueSpectrumNumbers() const {
   // To support legacy code that creates workspaces with duplicate spectrum
   // numbers we check for bad spectrum numbers only when needed, i.e., when
   // accessing index maps.
-  if (m_globalSpectrumNumbers.size() != m_spectrumNumberToPartition.size())
+  if (m_hasDuplicates)
     throw std::logic_error("SpectrumNumberTranslator: The vector of spectrum "
                            "numbers contained duplicate entries.");
 }
 
+/** Sets up the lookup of global indices by spectrum number. Spectrum numbers
+ * spanning a range not much larger than their count use a flat table indexed
+ * by the spectrum number, others use a hash map. For duplicate spectrum
+ * numbers the first global index is kept.
+ */
+void SpectrumNumberTranslator::setupSpectrumNumberLookup() {
+  const auto &numbers = m_globalSpectrumNumbers;
+  if (numbers.empty())
+    return;
+  const auto [minIt, maxIt] =
+      std::minmax_element(numbers.cbegin(), numbers.cend());
+  const auto span = static_cast<int64_t>(static_cast<int32_t>(*maxIt)) -
+                    static_cast<int32_t>(*minIt) + 1;
+  m_isSorted = std::adjacent_find(numbers.cbegin(), numbers.cend(),
+                                  [](const auto a, const auto b) {
+                                    return a >= b;
+                                  }) == numbers.cend();
+  if (span <= maxDenseSpan * static_cast<int64_t>(numbers.size())) {
+    m_minSpectrumNumber = *minIt;
+    m_denseGlobalIndices.assign(static_cast<size_t>(span), invalidIndex);
+    for (size_t i = 0; i < numbers.size(); ++i) {
+      auto &globalIndex =
+          m_denseGlobalIndices[static_cast<int32_t>(numbers[i]) -
+                               static_cast<int32_t>(m_minSpectrumNumber)];
+      if (globalIndex == invalidIndex)
+        globalIndex = i;
+      else
+        m_hasDuplicates = true;
+    }
+  } else {
+    m_sparseGlobalIndices.reserve(numbers.size());
+    for (size_t i = 0; i < numbers.size(); ++i)
+      if (!m_sparseGlobalIndices.emplace(numbers[i], i).second)
+        m_hasDuplicates = true;
+  }
+}
+
+/// Returns the global index of a spectrum number, throws if it does not exist.
+size_t SpectrumNumberTranslator::globalIndexOf(
+    const SpectrumNumber spectrumNumber) const {
+  if (!m_denseGlobalIndices.empty()) {
+    const auto offset =
+        static_cast<int64_t>(static_cast<int32_t>(spectrumNumber)) -
+        static_cast<int32_t>(m_minSpectrumNumber);
+    if (offset >= 0 &&
+        offset < static_cast<int64_t>(m_denseGlobalIndices.size()) &&
+        m_denseGlobalIndices[offset] != invalidIndex)
+      return m_denseGlobalIndices[offset];
+  } else {
+    const auto it = m_sparseGlobalIndices.find(spectrumNumber);
+    if (it != m_sparseGlobalIndices.end())
+      return it->second;
+  }
+  throw std::out_of_range("The following value is out of range: " +
+                          spectrumNumber.str());
+}
+
 void SpectrumNumberTranslator::setupSpectrumNumberToIndexMap() const {
+  m_spectrumNumberToIndex.reserve(localSize());
+  for (size_t i = 0; i < m_globalSpectrumNumbers.size(); ++i)
+    if (m_partitions[i] == m_partition)
+      m_spectrumNumberToIndex.emplace_back(m_globalSpectrumNumbers[i],
+                                           m_localOffsets[i]);
   std::sort(m_spectrumNumberToIndex.begin(), m_spectrumNumberToIndex.end(),
             [](const std::pair<SpectrumNumber, size_t> &a,
                const std::pair<SpectrumNumber, size_t> &b) -> bool {
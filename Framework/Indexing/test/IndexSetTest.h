@@ -97,6 +97,19 @@ public:
     TS_ASSERT_EQUALS(set[2], 3);
   }
 
+  void test_indexList_increasing() {
+    IndexSetTester contiguous({1, 2, 3}, 4);
+    TS_ASSERT_EQUALS(contiguous.size(), 3);
+    TS_ASSERT_EQUALS(contiguous[0], 1);
+    TS_ASSERT_EQUALS(contiguous[2], 3);
+    IndexSetTester gaps({0, 2, 3}, 4);
+    TS_ASSERT_EQUALS(gaps.size(), 3);
+    TS_ASSERT_EQUALS(gaps[1], 2);
+    TS_ASSERT(!gaps.isContiguous());
+    TS_ASSERT_THROWS(IndexSetTester({1, 2, 4}, 4), const std::out_of_range &);
+    TS_ASSERT(IndexSetTester(std::vector<size_t>{}, 4).empty());
+  }
+
   void test_indexList_duplicate_throws() {
     TS_ASSERT_THROWS_EQUALS(IndexSetTester({2, 1, 2}, 3),
                             const std::runtime_error &e, std::string(e.what()),
@@ -194,6 +194,69 @@ public:
     TS_ASSERT_EQUALS(translator.makeIndexSet(makeSpectrumNumbers({-1}))[0], 3);
   }
 
+  void test_sparse_spectrum_numbers() {
+    auto numbers = {7, 1000000, -50000, 3};
+    std::vector<SpectrumNumber> spectrumNumbers(numbers.begin(), numbers.end());
+    SpectrumNumberTranslator translator(
+        spectrumNumbers,
+        RoundRobinPartitioner(
+            2, PartitionIndex(0),
+            Partitioner::MonitorStrategy::CloneOnEachPartition,
+            std::vector<GlobalSpectrumIndex>{}),
+        PartitionIndex(0));
+
+    // Rank 0 holds 7 and -50000
+    auto set = translator.makeIndexSet(makeSpectrumNumbers({-50000, 3, 7}));
+    TS_ASSERT_EQUALS(set.size(), 2);
+    TS_ASSERT_EQUALS(set[0], 1);
+    TS_ASSERT_EQUALS(set[1], 0);
+    set = translator.makeIndexSet(SpectrumNumber(-50000), SpectrumNumber(7));
+    TS_ASSERT_EQUALS(set.size(), 2);
+    TS_ASSERT_EQUALS(set[0], 1);
+    TS_ASSERT_EQUALS(set[1], 0);
+    TS_ASSERT_THROWS(translator.makeIndexSet(makeSpectrumNumbers({8})),
+                     const std::out_of_range &);
+  }
+
+  void test_sparse_duplicate_spectrum_numbers() {
+    auto numbers = {1, 1000000, 1};
+    std::vector<SpectrumNumber> spectrumNumbers(numbers.begin(), numbers.end());
+    SpectrumNumberTranslator translator(
+        spectrumNumbers,
+        RoundRobinPartitioner(
+            1, PartitionIndex(0),
+            Partitioner::MonitorStrategy::CloneOnEachPartition,
+            std::vector<GlobalSpectrumIndex>{}),
+        PartitionIndex(0));
+
+    TS_ASSERT_THROWS(translator.makeIndexSet(makeSpectrumNumbers({1})),
+                     const std::logic_error &);
+  }
+
+  void test_makeIndexSet_minmax_sorted_spectrum_numbers_3_ranks() {
+    // SpectrumNumber       1 2 4 5 6
+    // Rank                 0 1 2 0 1
+    auto numbers = {1, 2, 4, 5, 6};
+    std::vector<SpectrumNumber> spectrumNumbers(numbers.begin(), numbers.end());
+    SpectrumNumberTranslator translator(
+        spectrumNumbers,
+        RoundRobinPartitioner(
+            3, PartitionIndex(0),
+            Partitioner::MonitorStrategy::CloneOnEachPartition,
+            std::vector<GlobalSpectrumIndex>{}),
+        PartitionIndex(1));
+
+    auto set = translator.makeIndexSet(SpectrumNumber(1), SpectrumNumber(6));
+    TS_ASSERT_EQUALS(set.size(), 2);
+    TS_ASSERT_EQUALS(set[0], 0);
+    TS_ASSERT_EQUALS(set[1], 1);
+    set = translator.makeIndexSet(SpectrumNumber(4), SpectrumNumber(5));
+    TS_ASSERT_EQUALS(set.size(), 0);
+    TS_ASSERT_THROWS(
+        translator.makeIndexSet(SpectrumNumber(3), SpectrumNumber(5)),
+        const std::out_of_range &);
+  }
+
   void test_globalSize() {
     TS_ASSERT_EQUALS(makeTranslator(1, 0)->globalSize(), 4);
     TS_ASSERT_EQUALS(makeTranslator(2, 0)->globalSize(), 4);
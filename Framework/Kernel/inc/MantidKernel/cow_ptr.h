@@ -12,7 +12,9 @@
 #include <memory>
 #endif
 
+#include <atomic>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace Mantid {
@@ -45,7 +47,9 @@ public:
 
 private:
   ptr_type Data; ///< Real object Ptr
-  std::mutex copyMutex;
+  /// Spin lock taken while copying the data in access(). A full mutex is
+  /// avoided to keep the size of the many cow_ptr instances small.
+  std::atomic_flag copyLock = ATOMIC_FLAG_INIT;
 
 public:
   cow_ptr(ptr_type &&resourceSptr) noexcept;
@@ -55,10 +59,12 @@ public:
   /// Constructs a cow_ptr with no managed object, i.e. empty cow_ptr.
   constexpr cow_ptr(std::nullptr_t) noexcept : Data(nullptr) {}
   cow_ptr(const cow_ptr<DataType> &) noexcept;
-  // Move is hand-written, since std::mutex member prevents auto-generation.
+  // Move is hand-written, since std::atomic_flag member prevents
+  // auto-generation.
   cow_ptr(cow_ptr<DataType> &&other) noexcept : Data(std::move(other.Data)) {}
   cow_ptr<DataType> &operator=(const cow_ptr<DataType> &) noexcept;
-  // Move is hand-written, since std::mutex member prevents auto-generation.
+  // Move is hand-written, since std::atomic_flag member prevents
+  // auto-generation.
   cow_ptr<DataType> &operator=(cow_ptr<DataType> &&rhs) noexcept {
     Data = std::move(rhs.Data);
     return *this;
@@ -111,7 +117,7 @@ cow_ptr<DataType>::cow_ptr() : Data(std::make_shared<DataType>()) {}
   Copy constructor : double references the data object
   @param A :: object to copy
 */
-// Note: Need custom implementation, since std::mutex is not copyable.
+// Note: Need custom implementation, since std::atomic_flag is not copyable.
 template <typename DataType>
 cow_ptr<DataType>::cow_ptr(const cow_ptr<DataType> &A) noexcept
     : Data(std::atomic_load(&A.Data)) {}
@@ -122,7 +128,7 @@ cow_ptr<DataType>::cow_ptr(const cow_ptr<DataType> &A) noexcept
   @param A :: object to copy
   @return *this
 */
-// Note: Need custom implementation, since std::mutex is not copyable.
+// Note: Need custom implementation, since std::atomic_flag is not copyable.
 template <typename DataType>
 cow_ptr<DataType> &cow_ptr<DataType>::
 operator=(const cow_ptr<DataType> &A) noexcept {
@@ -162,12 +168,20 @@ template <typename DataType> DataType &cow_ptr<DataType>::access() {
   // Use a double-check for sharing so that we only acquire the lock if
   // absolutely necessary
   if (!Data.unique()) {
-    std::lock_guard<std::mutex> lock{copyMutex};
-    // Check again because another thread may have taken copy and dropped
-    // reference count since previous check
-    if (!Data.unique()) {
-      std::atomic_store(&Data, std::make_shared<DataType>(*Data));
+    while (copyLock.test_and_set(std::memory_order_acquire)) {
+      std::this_thread::yield();
     }
+    try {
+      // Check again because another thread may have taken copy and dropped
+      // reference count since previous check
+      if (!Data.unique()) {
+        std::atomic_store(&Data, std::make_shared<DataType>(*Data));
+      }
+    } catch (...) {
+      copyLock.clear(std::memory_order_release);
+      throw;
+    }
+    copyLock.clear(std::memory_order_release);
   }
   return *Data;
 }
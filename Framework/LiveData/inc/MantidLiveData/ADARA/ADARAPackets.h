@@ -231,12 +231,16 @@ public:
   const Event *firstEvent() const;
   const Event *nextEvent() const;
 
+  // Skips the remaining events of the current bank and returns the first
+  // event of the next non-empty bank (or NULL).  The events of a bank are
+  // contiguous, so a bank can be decoded in one go starting from firstEvent()
+  // and then nextBank(), using curEventCount() as the number of events.
+  const Event *nextBank() const;
+
   bool getSourceCORFlag() const { return m_isCorrected; }
   uint32_t getSourceTOFOffset() const { return m_TOFOffset; }
   uint32_t curBankId() const { return m_bankId; }
-
-  //        uint32_t curEventCount() const { return ((uint32_t *)m_curBank)[1];
-  //        }
+  uint32_t curEventCount() const { return m_eventCount; }
 
 private:
   // Two helper functions for firstEvent() & nextEvent()
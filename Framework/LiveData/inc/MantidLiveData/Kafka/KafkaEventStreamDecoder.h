@@ -75,6 +75,10 @@ private:
 
   /// Local event workspace buffers
   std::vector<DataObjects::EventWorkspace_sptr> m_localEvents;
+  /// Empty buffers swapped in for m_localEvents on the next extraction
+  std::vector<DataObjects::EventWorkspace_sptr> m_spareEvents;
+  /// Incremented whenever m_localEvents is recreated for a new run
+  size_t m_localEventsGeneration{0};
 
   /// Intermediate buffer for received events yet to be populated in
   /// m_localEvents
@@ -86,9 +90,9 @@ private:
   const std::size_t m_intermediateBufferFlushThreshold;
 };
 
-DLLExport std::vector<size_t> computeGroupBoundaries(
-    const std::vector<KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
-    const size_t numberOfGroups);
+DLLExport std::vector<size_t> partitionEventBuffer(
+    std::vector<KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
+    const size_t numberOfSpectra, const size_t numberOfGroups);
 
 } // namespace LiveData
 } // namespace Mantid
@@ -37,12 +37,15 @@ private:
   void init() override;
 
   Mantid::API::Workspace_sptr runProcessing(Mantid::API::Workspace_sptr inputWS,
-                                            bool PostProcess);
+                                            bool PostProcess,
+                                            bool Incremental = false);
   Mantid::API::Workspace_sptr processChunk(Mantid::API::Workspace_sptr chunkWS);
   void runPostProcessing();
+  void runIncrementalPostProcessing(const API::Workspace_sptr &chunkWS);
 
   void replaceChunk(Mantid::API::Workspace_sptr chunkWS);
-  void addChunk(const Mantid::API::Workspace_sptr &chunkWS);
+  void addChunk(API::Workspace_sptr &accumWS,
+                const Mantid::API::Workspace_sptr &chunkWS);
   void addMatrixWSChunk(const API::Workspace_sptr &accumWS,
                         const API::Workspace_sptr &chunkWS);
   void addMDWSChunk(API::Workspace_sptr &accumWS,
@@ -68,6 +68,22 @@ protected:
   bool rxPacket(const ADARA::AnnotationPkt &pkt) override;
   bool rxPacket(const ADARA::RunInfoPkt &pkt) override;
 
+  void appendBankEvents(const ADARA::Event *events, const uint32_t numEvents,
+                        const uint32_t tofOffset,
+                        const Mantid::Types::Core::DateAndTime pulseTime);
+  // events points to the numEvents contiguous events of a single bank.
+  // Their tof is in units of 100ns relative to the start of the pulse and is
+  // converted to the microseconds expected by TofEvent after adding
+  // tofOffset.
+  // pulseTime is the start of the pulse relative to Jan 1, 1990.
+
+  DataObjects::EventWorkspace_sptr m_eventBuffer;
+  ///< Used to buffer events between calls to extractData()
+
+  std::vector<size_t> m_indexVector; // maps pixel id's (shifted by
+                                     // m_indexOffset) to workspace indexes
+  detid_t m_indexOffset{0};
+
 private:
   // Workspace initialization needs to happen in 2 steps.  Part 1 must happen
   // before we receive *any* packets.
@@ -100,25 +116,15 @@ private:
   // Returns true if we've got a value for every log listed in m_requiredLogs
   bool haveRequiredLogs();
 
-  void appendEvent(const uint32_t pixelId, const double tof,
-                   const Mantid::Types::Core::DateAndTime pulseTime);
-  // tof is "Time Of Flight" and is in units of microsecondss relative to the
-  // start of the pulse
-  // (There's some documentation that says nanoseconds, but Russell Taylor
-  // assures me it's really is microseconds!)
-  // pulseTime is the start of the pulse relative to Jan 1, 1990.
-  // Both values are designed to be passed straight into the TofEvent
-  // constructor.
-
   ILiveListener::RunStatus m_status{RunStatus::NoRun};
   int m_runNumber{0};
-  DataObjects::EventWorkspace_sptr m_eventBuffer;
-  ///< Used to buffer events between calls to extractData()
 
   bool m_workspaceInitialized{false};
   std::string m_wsName;
-  detid2index_map m_indexMap;        // maps pixel id's to workspace indexes
-  detid2index_map m_monitorIndexMap; // Same as above for the monitor workspace
+  std::vector<size_t> m_bankIndexes; // workspace indexes of the bank being
+                                     // appended, reused between packets
+  detid2index_map m_monitorIndexMap; // maps monitor id's to workspace
+                                     // indexes of the monitor workspace
 
   // We need these 2 strings to initialize m_buffer
   std::string m_instrumentName;
@@ -215,6 +215,17 @@ const Event *BankedEventPkt::nextEvent() const {
   return m_curEvent;
 }
 
+const Event *BankedEventPkt::nextBank() const {
+  if (m_curEvent) {
+    // Move to the last event of the current bank and let nextEvent() step
+    // over any bank and source headers from there
+    m_curFieldIndex = m_bankStartIndex + (2 * m_eventCount);
+    return nextEvent();
+  }
+
+  return m_curEvent;
+}
+
 // Helper functions for firstEvent() & nextEvent()
 
 // Assumes m_curFieldIndex points to the start of a source section.
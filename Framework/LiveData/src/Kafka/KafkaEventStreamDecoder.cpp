@@ -31,8 +31,6 @@ GNU_DIAG_ON("conversion")
 #include <numeric>
 #include <utility>
 
-#include <tbb/parallel_sort.h>
-
 using namespace Mantid::Types;
 size_t totalNumEventsSinceStart = 0;
 size_t totalNumEventsBeforeLastTimeout = 0;
@@ -77,27 +75,6 @@ void appendToLog(Mantid::API::Run &mutableRunInfo, const std::string &name,
     mutableRunInfo.addLogData(property);
   }
 }
-
-void sortIntermediateEventBuffer(
-    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
-        &eventBuffer,
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedPulse>
-        &pulseBuffer) {
-  tbb::parallel_sort(
-      eventBuffer.begin(), eventBuffer.end(),
-      [&](const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &lhs,
-          const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &rhs)
-          -> bool {
-        const auto &lhsPulse = pulseBuffer[lhs.pulseIndex];
-        const auto &rhsPulse = pulseBuffer[rhs.pulseIndex];
-
-        /* If events are from different periods compare the period
-         * numbers, otherwise compare the workspace index */
-        return (lhsPulse.periodNumber != rhsPulse.periodNumber)
-                   ? lhsPulse.periodNumber < rhsPulse.periodNumber
-                   : lhs.wsIdx < rhs.wsIdx;
-      });
-}
 } // namespace
 
 namespace Mantid {
@@ -160,6 +137,8 @@ KafkaEventStreamDecoder::KafkaEventStreamDecoder(
 
   std::scoped_lock lck(m_intermediateBufferMutex, m_mutex);
   m_localEvents = std::move(o.m_localEvents);
+  m_spareEvents = std::move(o.m_spareEvents);
+  m_localEventsGeneration = o.m_localEventsGeneration;
   m_receivedEventBuffer = std::move(o.m_receivedEventBuffer);
   m_receivedPulseBuffer = std::move(o.m_receivedPulseBuffer);
 }
@@ -198,30 +177,59 @@ bool KafkaEventStreamDecoder::hasReachedEndOfRun() noexcept {
 // -----------------------------------------------------------------------------
 
 API::Workspace_sptr KafkaEventStreamDecoder::extractDataImpl() {
-  std::lock_guard<std::mutex> workspaceLock(m_mutex);
-  g_log.debug() << "Events since last timeout "
-                << totalNumEventsSinceStart - totalNumEventsBeforeLastTimeout
-                << std::endl;
-  totalNumEventsBeforeLastTimeout = totalNumEventsSinceStart;
-
-  if (m_localEvents.size() == 1) {
-    auto temp = createBufferWorkspace<DataObjects::EventWorkspace>(
-        "EventWorkspace", m_localEvents.front());
-    std::swap(m_localEvents.front(), temp);
-    return temp;
-  } else if (m_localEvents.size() > 1) {
-    auto group = std::make_shared<API::WorkspaceGroup>();
-    size_t index(0);
-    for (auto &filledBuffer : m_localEvents) {
-      auto temp = createBufferWorkspace<DataObjects::EventWorkspace>(
-          "EventWorkspace", filledBuffer);
-      std::swap(m_localEvents[index++], temp);
-      group->addWorkspace(temp);
+  std::vector<DataObjects::EventWorkspace_sptr> filledBuffers;
+  size_t generation(0);
+  {
+    std::lock_guard<std::mutex> workspaceLock(m_mutex);
+    g_log.debug() << "Events since last timeout "
+                  << totalNumEventsSinceStart - totalNumEventsBeforeLastTimeout
+                  << std::endl;
+    totalNumEventsBeforeLastTimeout = totalNumEventsSinceStart;
+
+    if (m_localEvents.empty())
+      throw Exception::NotYet("Local buffers not initialized.");
+
+    if (m_spareEvents.size() != m_localEvents.size()) {
+      // No spare buffers have been prepared yet, create them here
+      m_spareEvents.clear();
+      m_spareEvents.reserve(m_localEvents.size());
+      for (const auto &filledBuffer : m_localEvents)
+        m_spareEvents.emplace_back(
+            createBufferWorkspace<DataObjects::EventWorkspace>(
+                "EventWorkspace", filledBuffer));
+    } else {
+      // Carry over the most recent sample log values
+      for (size_t i = 0; i < m_localEvents.size(); ++i) {
+        m_spareEvents[i]->setSharedRun(m_localEvents[i]->sharedRun());
+        m_spareEvents[i]->mutableRun().clearOutdatedTimeSeriesLogValues();
+      }
     }
-    return group;
-  } else {
-    throw Exception::NotYet("Local buffers not initialized.");
+    std::swap(m_localEvents, m_spareEvents);
+    filledBuffers.swap(m_spareEvents);
+    generation = m_localEventsGeneration;
+  }
+
+  // The capture thread no longer writes to the filled buffers, so the spares
+  // for the next extraction can be created from them without holding the lock
+  std::vector<DataObjects::EventWorkspace_sptr> spareBuffers;
+  spareBuffers.reserve(filledBuffers.size());
+  for (const auto &filledBuffer : filledBuffers)
+    spareBuffers.emplace_back(
+        createBufferWorkspace<DataObjects::EventWorkspace>("EventWorkspace",
+                                                           filledBuffer));
+  {
+    std::lock_guard<std::mutex> workspaceLock(m_mutex);
+    // Discard the spares if the caches were replaced in the meantime
+    if (generation == m_localEventsGeneration)
+      m_spareEvents = std::move(spareBuffers);
   }
+
+  if (filledBuffers.size() == 1)
+    return filledBuffers.front();
+  auto group = std::make_shared<API::WorkspaceGroup>();
+  for (const auto &filledBuffer : filledBuffers)
+    group->addWorkspace(filledBuffer);
+  return group;
 }
 
 /**
@@ -425,12 +433,13 @@ void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer,
     m_receivedPulseBuffer.emplace_back(pulse);
     const auto pulseIndex = m_receivedPulseBuffer.size() - 1;
 
-    /* Ensure storage for newly received events */
+    /* Append the newly received events. Resizing, unlike reserving the exact
+     * size, grows the buffer geometrically rather than for every message. */
     const auto oldBufferSize(m_receivedEventBuffer.size());
-    m_receivedEventBuffer.reserve(oldBufferSize + nEvents);
+    m_receivedEventBuffer.resize(oldBufferSize + nEvents);
 
     std::transform(detData.begin(), detData.end(), tofData.begin(),
-                   std::back_inserter(m_receivedEventBuffer),
+                   m_receivedEventBuffer.begin() + oldBufferSize,
                    [&](uint64_t detId, uint64_t tof) -> BufferedEvent {
                      const auto workspaceIndex =
                          m_specToIdx[detId + m_specToIdxOffset];
@@ -457,12 +466,16 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
 
   std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
 
-  sortIntermediateEventBuffer(m_receivedEventBuffer, m_receivedPulseBuffer);
+  size_t numberOfSpectra;
+  {
+    std::lock_guard<std::mutex> workspaceLock(m_mutex);
+    numberOfSpectra = m_localEvents.front()->getNumberHistograms();
+  }
 
-  /* Compute groups for parallel insertion */
+  /* Group the events by workspace index for parallel insertion */
   const auto numberOfGroups = PARALLEL_GET_MAX_THREADS;
-  const auto groupBoundaries =
-      computeGroupBoundaries(m_receivedEventBuffer, numberOfGroups);
+  const auto groupBoundaries = partitionEventBuffer(
+      m_receivedEventBuffer, numberOfSpectra, numberOfGroups);
 
   /* Insert events into EventWorkspace(s) */
   {
@@ -634,6 +647,8 @@ void KafkaEventStreamDecoder::initLocalCaches(
     std::lock_guard<std::mutex> workspaceLock(m_mutex);
     m_localEvents.resize(nperiods);
     m_localEvents[0] = eventBuffer;
+    m_spareEvents.clear();
+    ++m_localEventsGeneration;
     for (size_t i = 1; i < nperiods; ++i) {
       // A clone should be cheap here as there are no events yet
       m_localEvents[i] = eventBuffer->clone();
@@ -644,48 +659,68 @@ void KafkaEventStreamDecoder::initLocalCaches(
   m_dataReset = true;
 }
 
-std::vector<size_t> computeGroupBoundaries(
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
+/**
+ * Reorders the buffered events into groups holding the events of contiguous,
+ * disjoint ranges of workspace indices, so that each group can be inserted
+ * into the EventWorkspace(s) by a separate thread. The events are counted and
+ * moved to their group in parallel passes over chunks of the buffer. Events
+ * keep their order of arrival within each group.
+ * @param eventBuffer The buffered events, reordered on return
+ * @param numberOfSpectra The number of spectra in the EventWorkspace(s)
+ * @param numberOfGroups The number of groups
+ * @return The numberOfGroups + 1 boundaries of the groups in the buffer
+ */
+std::vector<size_t> partitionEventBuffer(
+    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
         &eventBuffer,
-    const size_t numberOfGroups) {
-  std::vector<size_t> groupBoundaries(numberOfGroups + 1, eventBuffer.size());
-
-  /* First group always starts at beginning of buffer */
-  groupBoundaries[0] = 0;
-
-  const auto eventsPerGroup =
-      std::max<size_t>(1, eventBuffer.size() / numberOfGroups);
-
-  /* Iterate over groups */
-  for (size_t group = 1; group < numberOfGroups; ++group) {
-    /* Calculate a reasonable end boundary for the group */
-    groupBoundaries[group] = std::min(
-        groupBoundaries[group - 1] + eventsPerGroup - 1, eventBuffer.size());
-
-    /* If we have already gotten through all events then exit early, leaving
-     * some threads without events. */
-    if (groupBoundaries[group] == eventBuffer.size()) {
-      break;
-    }
+    const size_t numberOfSpectra, const size_t numberOfGroups) {
+  const auto spectraPerGroup =
+      std::max<size_t>(1, (numberOfSpectra + numberOfGroups - 1) /
+                              numberOfGroups);
+  const auto groupOf = [spectraPerGroup, numberOfGroups](const size_t wsIdx) {
+    return std::min(wsIdx / spectraPerGroup, numberOfGroups - 1);
+  };
+  const auto numberOfEvents = eventBuffer.size();
+  const auto numberOfChunks = static_cast<int>(numberOfGroups);
+
+  /* Count the events of each group in each chunk of the buffer */
+  std::vector<size_t> offsets(numberOfGroups * numberOfGroups, 0);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int chunk = 0; chunk < numberOfChunks; ++chunk) {
+    auto *counts = &offsets[chunk * numberOfGroups];
+    const auto begin = numberOfEvents * chunk / numberOfGroups;
+    const auto end = numberOfEvents * (chunk + 1) / numberOfGroups;
+    for (auto idx = begin; idx < end; ++idx)
+      ++counts[groupOf(eventBuffer[idx].wsIdx)];
+  }
 
-    /* Advance the end boundary of the group until all events for a given
-     * workspace index fall within a single group */
-    while (groupBoundaries[group] + 1 < eventBuffer.size() &&
-           (eventBuffer[groupBoundaries[group]].wsIdx ==
-            eventBuffer[groupBoundaries[group] + 1].wsIdx)) {
-      ++groupBoundaries[group];
+  /* Convert the counts into the position of each chunk within each group */
+  std::vector<size_t> groupBoundaries(numberOfGroups + 1, numberOfEvents);
+  size_t position = 0;
+  for (size_t group = 0; group < numberOfGroups; ++group) {
+    groupBoundaries[group] = position;
+    for (size_t chunk = 0; chunk < numberOfGroups; ++chunk) {
+      auto &offset = offsets[chunk * numberOfGroups + group];
+      const auto count = offset;
+      offset = position;
+      position += count;
     }
+  }
 
-    /* Increment group end boundary (such that group is defined by [lower,
-     * upper) boundaries) */
-    ++groupBoundaries[group];
-
-    /* If we have already gotten through all events then exit early, leaving
-     * some threads without events. */
-    if (groupBoundaries[group] >= eventBuffer.size()) {
-      break;
+  /* Move the events to their groups */
+  std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
+      partitioned(numberOfEvents);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int chunk = 0; chunk < numberOfChunks; ++chunk) {
+    auto *offset = &offsets[chunk * numberOfGroups];
+    const auto begin = numberOfEvents * chunk / numberOfGroups;
+    const auto end = numberOfEvents * (chunk + 1) / numberOfGroups;
+    for (auto idx = begin; idx < end; ++idx) {
+      const auto &event = eventBuffer[idx];
+      partitioned[offset[groupOf(event.wsIdx)]++] = event;
     }
   }
+  eventBuffer.swap(partitioned);
 
   return groupBoundaries;
 }
@@ -143,6 +143,14 @@ void LiveDataAlgorithm::initProps() {
                                      FileProperty::OptionalLoad, "py"),
       " Python script that will be run to process the accumulated data.");
 
+  declareProperty(
+      "PostProcessIncrementally", false,
+      "Post-process only each new chunk and add the result to the previous "
+      "output, instead of post-processing the whole accumulation.\n"
+      "Requires AccumulationMethod=Add and is only correct for "
+      "post-processing that is linear in the counts, e.g. Rebin, SumSpectra "
+      "or Integration.");
+
   std::vector<std::string> runOptions{"Restart", "Stop", "Rename"};
   declareProperty("RunTransitionBehavior", "Restart",
                   std::make_shared<StringListValidator>(runOptions),
@@ -365,6 +373,13 @@ std::map<std::string, std::string> LiveDataAlgorithm::validateInputs() {
   if (this->getPropertyValue("OutputWorkspace").empty())
     out["OutputWorkspace"] = "Must specify the OutputWorkspace.";
 
+  const bool postProcessIncrementally =
+      this->getProperty("PostProcessIncrementally");
+  if (postProcessIncrementally &&
+      getPropertyValue("AccumulationMethod") != "Add")
+    out["PostProcessIncrementally"] =
+        "Incremental post-processing requires AccumulationMethod=Add.";
+
   // check that only one method was specified for specifying processing
   int numProc = 0;
   if (!this->getPropertyValue("ProcessingAlgorithm").empty())
@@ -95,12 +95,14 @@ void LoadLiveData::init() { this->initProps(); }
  *
  * @param inputWS :: workspace being processed
  * @param PostProcess :: flag, TRUE if doing the post-processing
+ * @param Incremental :: flag, TRUE if post-processing a single chunk rather
+ *than the accumulation workspace
  * @return the processed workspace. Will point to inputWS if no processing is to
  *do
  */
 Mantid::API::Workspace_sptr
 LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
-                            bool PostProcess) {
+                            bool PostProcess, bool Incremental) {
   if (!inputWS)
     throw std::runtime_error(
         "LoadLiveData::runProcessing() called for an empty input workspace.");
@@ -125,7 +127,8 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
     std::string outputName = inputName;
 
     // Except, no need for anonymous names with the post-processing
-    if (PostProcess) {
+    const bool namedOutput = PostProcess && !Incremental;
+    if (namedOutput) {
       inputName = this->getPropertyValue("AccumulationWorkspace");
       outputName = this->getPropertyValue("OutputWorkspace");
     }
@@ -176,7 +179,7 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
           " Algorithm's OutputWorkspace property is not a WorkspaceProperty!");
     Workspace_sptr temp = wsProp->getWorkspace();
 
-    if (!PostProcess) {
+    if (!namedOutput) {
       if (!temp) {
         // a group workspace cannot be returned by wsProp
         temp = AnalysisDataService::Instance().retrieve(inputName);
@@ -227,22 +230,43 @@ void LoadLiveData::runPostProcessing() {
 }
 
 //----------------------------------------------------------------------------------------------
-/** Accumulate the data by adding (summing) to the output workspace.
+/** Perform the PostProcessing steps on the latest chunk only and add the
+ * result to the previous output. Only valid for post-processing that is
+ * linear in the counts.
+ * Sets the m_outputWS member to the updated result.
+ *
+ * @param chunkWS :: processed live data chunk workspace
+ */
+void LoadLiveData::runIncrementalPostProcessing(
+    const Mantid::API::Workspace_sptr &chunkWS) {
+  Workspace_sptr processedChunk;
+  try {
+    processedChunk = runProcessing(chunkWS, true, true);
+  } catch (...) {
+    g_log.error("While post processing:");
+    throw;
+  }
+  this->addChunk(m_outputWS, processedChunk);
+}
+
+//----------------------------------------------------------------------------------------------
+/** Accumulate the data by adding (summing) to the given workspace.
  * Calls the Plus algorithm
- * Sets m_accumWS.
  *
+ * @param accumWS :: workspace to accumulate into, may be replaced
  * @param chunkWS :: processed live data chunk workspace
  */
-void LoadLiveData::addChunk(const Mantid::API::Workspace_sptr &chunkWS) {
+void LoadLiveData::addChunk(Mantid::API::Workspace_sptr &accumWS,
+                            const Mantid::API::Workspace_sptr &chunkWS) {
   // Acquire locks on the workspaces we use
-  WriteLock _lock1(*m_accumWS);
+  WriteLock _lock1(*accumWS);
   ReadLock _lock2(*chunkWS);
 
   // ISIS multi-period data come in workspace groups
   if (WorkspaceGroup_sptr gws =
           std::dynamic_pointer_cast<WorkspaceGroup>(chunkWS)) {
     WorkspaceGroup_sptr accum_gws =
-        std::dynamic_pointer_cast<WorkspaceGroup>(m_accumWS);
+        std::dynamic_pointer_cast<WorkspaceGroup>(accumWS);
     if (!accum_gws) {
       throw std::runtime_error("Two workspace groups are expected.");
     }
@@ -259,10 +283,10 @@ void LoadLiveData::addChunk(const Mantid::API::Workspace_sptr &chunkWS) {
   } else if (MatrixWorkspace_sptr mws =
                  std::dynamic_pointer_cast<MatrixWorkspace>(chunkWS)) {
     // If workspace is a Matrix workspace just add the chunk
-    addMatrixWSChunk(m_accumWS, chunkWS);
+    addMatrixWSChunk(accumWS, chunkWS);
   } else {
     // Assume MD Workspace
-    addMDWSChunk(m_accumWS, chunkWS);
+    addMDWSChunk(accumWS, chunkWS);
   }
 }
 
@@ -579,7 +603,7 @@ void LoadLiveData::exec() {
     this->appendChunk(processed);
   } else {
     // Default to Add.
-    this->addChunk(processed);
+    this->addChunk(m_accumWS, processed);
 
     // When adding events, the default bin boundaries may need to be updated.
     // The function itself checks to see if it is appropriate
@@ -592,7 +616,14 @@ void LoadLiveData::exec() {
 
   if (this->hasPostProcessing()) {
     // ----------- Run post-processing -------------
-    this->runPostProcessing();
+    // Only the new chunk needs post-processing if the previous output is
+    // still valid
+    const bool postProcessIncrementally =
+        this->getProperty("PostProcessIncrementally");
+    if (postProcessIncrementally && accum == "Add" && m_outputWS)
+      this->runIncrementalPostProcessing(processed);
+    else
+      this->runPostProcessing();
     // Set both output workspaces
     this->setProperty("AccumulationWorkspace", m_accumWS);
     this->setProperty("OutputWorkspace", m_outputWS);
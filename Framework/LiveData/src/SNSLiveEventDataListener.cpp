@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include <ctime>
 #include <exception>
+#include <limits>
 #include <sstream> // for ostringstream
 #include <string>
 
@@ -412,36 +413,21 @@ bool SNSLiveEventDataListener::rxPacket(const ADARA::BankedEventPkt &pkt) {
         .getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
         ->addValue(eventTime, pkt.pulseCharge() * 10);
 
-    // Iterate through each event
-    const ADARA::Event *event = pkt.firstEvent();
-    unsigned lastBankID = pkt.curBankId();
-    // A counter that we use for logging purposes
-    unsigned eventsPerBank = 0;
-    while (event != nullptr) {
-      eventsPerBank++;
-      totalEvents++;
-      if (lastBankID < 0xFFFFFFFE) // Bank ID -1 & -2 are special cases and are
-                                   // not valid pixels
+    // Iterate through each bank, the events of a bank are decoded together
+    for (const ADARA::Event *event = pkt.firstEvent(); event != nullptr;
+         event = pkt.nextBank()) {
+      const unsigned bankID = pkt.curBankId();
+      const uint32_t eventsPerBank = pkt.curEventCount();
+      totalEvents += eventsPerBank;
+      if (bankID < 0xFFFFFFFE) // Bank ID -1 & -2 are special cases and are
+                               // not valid pixels
       {
-        // appendEvent needs tof to be in units of microseconds, but it comes
-        // from the ADARA stream in units of 100ns.
-        if (pkt.getSourceCORFlag()) {
-          appendEvent(event->pixel, event->tof / 10.0, eventTime);
-        } else {
-          appendEvent(event->pixel,
-                      (event->tof + pkt.getSourceTOFOffset()) / 10.0,
-                      eventTime);
-        }
-      }
-
-      event = pkt.nextEvent();
-      if (pkt.curBankId() != lastBankID) {
-        g_log.debug() << "BankID " << lastBankID << " had " << eventsPerBank
-                      << " events\n";
-
-        lastBankID = pkt.curBankId();
-        eventsPerBank = 0;
+        const uint32_t tofOffset =
+            pkt.getSourceCORFlag() ? 0 : pkt.getSourceTOFOffset();
+        appendBankEvents(event, eventsPerBank, tofOffset, eventTime);
       }
+      g_log.debug() << "BankID " << bankID << " had " << eventsPerBank
+                    << " events\n";
     }
   } // mutex automatically unlocks here
 
@@ -1344,8 +1330,8 @@ void SNSLiveEventDataListener::initWorkspacePart2() {
   m_eventBuffer->getAxis(0)->unit() = UnitFactory::Instance().create("TOF");
   m_eventBuffer->setYUnit("Counts");
 
-  m_indexMap = m_eventBuffer->getDetectorIDToWorkspaceIndexMap(
-      true /* bool throwIfMultipleDets */);
+  m_indexVector = m_eventBuffer->getDetectorIDToWorkspaceIndexVector(
+      m_indexOffset, true /* bool throwIfMultipleDets */);
 
   // We always want to have at least one value for the the scan index time
   // series.  We may have already gotten a scan start packet by the time we
@@ -1404,23 +1390,38 @@ bool SNSLiveEventDataListener::haveRequiredLogs() {
   return allFound;
 }
 
-/// Adds an event to the workspace
-void SNSLiveEventDataListener::appendEvent(
-    const uint32_t pixelId, const double tof,
-    const Mantid::Types::Core::DateAndTime pulseTime)
+/// Adds the events of one bank to the workspace
+void SNSLiveEventDataListener::appendBankEvents(
+    const ADARA::Event *events, const uint32_t numEvents,
+    const uint32_t tofOffset, const Mantid::Types::Core::DateAndTime pulseTime)
 // NOTE: This function does NOT lock the mutex!  Make sure you do that
 // before calling this function!
 {
-  // It'd be nice to use operator[], but we might end up inserting a value....
-  // Have to use find() instead.
-  const auto it = m_indexMap.find(pixelId);
-  if (it != m_indexMap.end()) {
-    const std::size_t workspaceIndex = it->second;
-    Types::Event::TofEvent event(tof, pulseTime);
-    m_eventBuffer->getSpectrum(workspaceIndex).addEventQuickly(event);
-  } else {
-    g_log.warning() << "Invalid pixel ID: " << pixelId << " (TofF: " << tof
-                    << " microseconds)\n";
+  static const size_t invalidIndex = std::numeric_limits<size_t>::max();
+
+  // Resolve all pixel id's of the bank through the dense lookup table first
+  const auto tableSize = static_cast<int64_t>(m_indexVector.size());
+  m_bankIndexes.resize(numEvents);
+  for (uint32_t i = 0; i < numEvents; ++i) {
+    const int64_t tableIndex =
+        static_cast<int64_t>(events[i].pixel) + m_indexOffset;
+    m_bankIndexes[i] = (tableIndex >= 0 && tableIndex < tableSize)
+                           ? m_indexVector[tableIndex]
+                           : invalidIndex;
+  }
+
+  for (uint32_t i = 0; i < numEvents; ++i) {
+    const size_t workspaceIndex = m_bankIndexes[i];
+    // tof comes from the ADARA stream in units of 100ns, TofEvent needs
+    // microseconds
+    const double tof = (events[i].tof + tofOffset) / 10.0;
+    if (workspaceIndex != invalidIndex) {
+      m_eventBuffer->getSpectrumUnsafe(workspaceIndex)
+          ->addEventQuickly(Types::Event::TofEvent(tof, pulseTime));
+    } else {
+      g_log.warning() << "Invalid pixel ID: " << events[i].pixel
+                      << " (TofF: " << tof << " microseconds)\n";
+    }
   }
 }
 
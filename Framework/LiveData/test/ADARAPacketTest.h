@@ -8,7 +8,12 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidLiveData/ADARA/ADARAParser.h"
+#include "MantidLiveData/SNSLiveEventDataListener.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
 #include <Poco/AutoPtr.h>
 #include <Poco/DOM/DOMParser.h> // for parsing the XML device descriptions
 #include <Poco/DOM/Document.h>
@@ -21,6 +26,33 @@
 // up this file.
 #include "ADARAPackets.h"
 
+namespace {
+/// Gives access to the decoding of banked events without a connection
+class TestableSNSLiveEventDataListener
+    : public Mantid::LiveData::SNSLiveEventDataListener {
+public:
+  /// Buffers the events in ws, which must have one detector per spectrum
+  explicit TestableSNSLiveEventDataListener(
+      Mantid::DataObjects::EventWorkspace_sptr ws) {
+    m_eventBuffer = std::move(ws);
+    m_indexVector =
+        m_eventBuffer->getDetectorIDToWorkspaceIndexVector(m_indexOffset, true);
+  }
+  using SNSLiveEventDataListener::appendBankEvents;
+
+  const Mantid::DataObjects::EventWorkspace &eventBuffer() const {
+    return *m_eventBuffer;
+  }
+};
+
+std::vector<double> tofs(const Mantid::DataObjects::EventList &eventList) {
+  std::vector<double> result;
+  for (const auto &event : eventList.getEvents())
+    result.emplace_back(event.tof());
+  return result;
+}
+} // namespace
+
 class ADARAPacketTest : public CxxTest::TestSuite, ADARA::Parser {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -75,6 +107,94 @@ public:
     }
   }
 
+  void testBankedEventPacketBankIteration() {
+    std::shared_ptr<ADARA::BankedEventPkt> pkt =
+        basicPacketTests<ADARA::BankedEventPkt>(
+            bankedEventPacket, sizeof(bankedEventPacket), 728504567, 761741666);
+    if (pkt != nullptr) {
+      const ADARA::Event *events = pkt->firstEvent();
+      TS_ASSERT(events);
+      if (events) {
+        TS_ASSERT_EQUALS(pkt->curBankId(), 0x02);
+        TS_ASSERT_EQUALS(pkt->curEventCount(), 1);
+        TS_ASSERT_EQUALS(events[0].pixel, 0x043C);
+      }
+
+      events = pkt->nextBank();
+      TS_ASSERT(events);
+      if (events) {
+        TS_ASSERT_EQUALS(pkt->curBankId(), 0x13);
+        TS_ASSERT_EQUALS(pkt->curEventCount(), 1);
+        TS_ASSERT_EQUALS(events[0].tof, 0x00023F3A);
+        TS_ASSERT_EQUALS(events[0].pixel, 0x49E2);
+      }
+
+      events = pkt->nextBank();
+      TS_ASSERT(!events);
+    }
+  }
+
+  void testBankedEventPacketMultiEventBanks() {
+    std::shared_ptr<ADARA::BankedEventPkt> pkt =
+        basicPacketTests<ADARA::BankedEventPkt>(
+            bankedEventPacketMultiEvent, sizeof(bankedEventPacketMultiEvent),
+            728504567, 761741666);
+    if (pkt != nullptr) {
+      // nextBank() skips the empty bank and yields each bank's events in one
+      // contiguous block
+      std::vector<uint32_t> bankIds;
+      std::vector<uint32_t> eventCounts;
+      std::vector<uint32_t> pixels;
+      for (const ADARA::Event *events = pkt->firstEvent(); events;
+           events = pkt->nextBank()) {
+        bankIds.emplace_back(pkt->curBankId());
+        eventCounts.emplace_back(pkt->curEventCount());
+        for (uint32_t i = 0; i < pkt->curEventCount(); ++i)
+          pixels.emplace_back(events[i].pixel);
+      }
+      TS_ASSERT_EQUALS(bankIds, (std::vector<uint32_t>{0x02, 0x13}));
+      TS_ASSERT_EQUALS(eventCounts, (std::vector<uint32_t>{3, 3}));
+      TS_ASSERT_EQUALS(pixels,
+                       (std::vector<uint32_t>{1, 2, 1, 3, 0x49E2, 0}));
+
+      // nextEvent() visits every event individually
+      size_t numEvents = 0;
+      for (const ADARA::Event *event = pkt->firstEvent(); event;
+           event = pkt->nextEvent())
+        ++numEvents;
+      TS_ASSERT_EQUALS(numEvents, 6);
+    }
+  }
+
+  void testAppendBankEventsSkipsInvalidPixels() {
+    std::shared_ptr<ADARA::BankedEventPkt> pkt =
+        basicPacketTests<ADARA::BankedEventPkt>(
+            bankedEventPacketMultiEvent, sizeof(bankedEventPacketMultiEvent),
+            728504567, 761741666);
+    if (pkt == nullptr)
+      return;
+    // 9 spectra for the detector IDs 1 to 9, so the pixel IDs are shifted by
+    // -1 to get the workspace index
+    TestableSNSLiveEventDataListener listener(
+        Mantid::DataObjects::create<Mantid::DataObjects::EventWorkspace>(
+            ComponentCreationHelper::createTestInstrumentCylindrical(1),
+            Mantid::Indexing::IndexInfo(9),
+            Mantid::HistogramData::BinEdges(2)));
+    const Mantid::Types::Core::DateAndTime pulseTime("2013-01-31T13:22:47");
+    for (const ADARA::Event *events = pkt->firstEvent(); events;
+         events = pkt->nextBank())
+      listener.appendBankEvents(events, pkt->curEventCount(), 50, pulseTime);
+
+    // Pixel 0x49E2 is beyond and pixel 0 before the detector IDs, so both are
+    // skipped. Tof is converted from 100ns to microseconds after the offset.
+    const auto &ws = listener.eventBuffer();
+    TS_ASSERT_EQUALS(ws.getNumberEvents(), 4);
+    TS_ASSERT_EQUALS(tofs(ws.getSpectrum(0)), (std::vector<double>{15, 35}));
+    TS_ASSERT_EQUALS(tofs(ws.getSpectrum(1)), (std::vector<double>{25}));
+    TS_ASSERT_EQUALS(tofs(ws.getSpectrum(2)), (std::vector<double>{45}));
+    TS_ASSERT_EQUALS(ws.getSpectrum(0).getEvents()[0].pulseTime(), pulseTime);
+  }
+
   void testBeamMonitorPacketParser() {
     std::shared_ptr<ADARA::BeamMonitorPkt> pkt =
         basicPacketTests<ADARA::BeamMonitorPkt>(
@@ -25,6 +25,25 @@ const unsigned char bankedEventPacket[96] = {
     0x3a, 0x3f, 0x02, 0x00, 0xe2, 0x49, 0x00, 0x00, 0xc0, 0xdc, 0x3c, 0x15,
     0x06, 0x8b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
+// Type:        "Banked Event Data" (version 0)
+// Pulse ID:    728504567.761741666
+// Hand-made from bankedEventPacket: the first source has bank 0x02 with 3
+// events (pixels 1, 2, 1 with tof 100, 200, 300), an empty bank 0x03 and
+// bank 0x13 with 3 events (pixels 3, 0x49E2, 0 with tof 400, 500, 600).
+const unsigned char bankedEventPacketMultiEvent[136] = {
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xf7, 0x18, 0x6c, 0x2b,
+    0x62, 0x41, 0x67, 0x2d, 0x87, 0xa5, 0x17, 0x00, 0xe4, 0x8d, 0xe8, 0x37,
+    0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xb0, 0x3c, 0x15,
+    0x06, 0x8b, 0x02, 0x00, 0x88, 0xf6, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x2c, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x90, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00,
+    0xe2, 0x49, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0xdc, 0x3c, 0x15, 0x06, 0x8b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00};
+
 // Type:        "Beam Monitor Event Data" (version 0)
 // Pulse ID:    728504567.761741666
 // Packet Time: Jan 31, 2013 - 13:22:47.761
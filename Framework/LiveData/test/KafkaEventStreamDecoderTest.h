@@ -96,6 +96,41 @@ public:
     TS_ASSERT_EQUALS(11.0, eventWksp->getTofMax());
   }
 
+  void test_Repeated_Extraction_Swaps_In_Empty_Buffers() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using Mantid::DataObjects::EventWorkspace;
+    using namespace Mantid::LiveData;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(2))
+        .WillOnce(Return(new FakeISISEventSubscriber(1)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)));
+    auto testWrapper = createTestInstance(mockBroker);
+    testWrapper.runKafkaOneStep(); // Start up
+    TS_ASSERT_THROWS_NOTHING(testWrapper.stopCapture());
+
+    Workspace_sptr first, second, third;
+    TS_ASSERT_THROWS_NOTHING(first = testWrapper->extractData());
+    TS_ASSERT_THROWS_NOTHING(second = testWrapper->extractData());
+    TS_ASSERT_THROWS_NOTHING(third = testWrapper->extractData());
+
+    auto firstWksp = std::dynamic_pointer_cast<EventWorkspace>(first);
+    TS_ASSERT(firstWksp);
+    checkWorkspaceEventData(*firstWksp);
+    // Subsequent extractions hand out distinct, empty buffers
+    for (const auto &workspace : {second, third}) {
+      auto eventWksp = std::dynamic_pointer_cast<EventWorkspace>(workspace);
+      TS_ASSERT(eventWksp);
+      TS_ASSERT_DIFFERS(eventWksp, firstWksp);
+      checkWorkspaceMetadata(*eventWksp);
+      TS_ASSERT_EQUALS(eventWksp->getNumberEvents(), 0);
+    }
+    TS_ASSERT_DIFFERS(second, third);
+  }
+
   void test_Multiple_Period_Event_Stream() {
     using namespace ::testing;
     using namespace KafkaTesting;
@@ -377,35 +412,35 @@ public:
                       eventWksp->getNumberEvents());
   }
 
-  void test_Compute_Bounds_Multiple_Threads() {
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
+  void test_Partition_Events_Multiple_Threads() {
+    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
         events = {
-            {0, 0, 0}, {0, 0, 0}, {1, 0, 0}, {1, 0, 0}, {2, 0, 0}, {2, 0, 0},
-            {3, 0, 0}, {3, 0, 0}, {4, 0, 0}, {4, 0, 0}, {5, 0, 0}, {5, 0, 0},
-            {6, 0, 0}, {6, 0, 0}, {7, 0, 0}, {7, 0, 0},
+            {7, 0, 0}, {6, 0, 0}, {5, 0, 0}, {4, 0, 0}, {3, 0, 0}, {2, 0, 0},
+            {1, 0, 0}, {0, 0, 0}, {0, 1, 0}, {1, 1, 0}, {2, 1, 0}, {3, 1, 0},
+            {4, 1, 0}, {5, 1, 0}, {6, 1, 0}, {7, 1, 0},
         };
 
-    const auto groupBounds = computeGroupBoundaries(events, 8);
+    const auto groupBounds = partitionEventBuffer(events, 8, 8);
     TS_ASSERT_EQUALS(9, groupBounds.size());
 
-    TS_ASSERT_EQUALS(0, groupBounds[0]);
-    TS_ASSERT_EQUALS(2, groupBounds[1]);
-    TS_ASSERT_EQUALS(4, groupBounds[2]);
-    TS_ASSERT_EQUALS(6, groupBounds[3]);
-    TS_ASSERT_EQUALS(8, groupBounds[4]);
-    TS_ASSERT_EQUALS(10, groupBounds[5]);
-    TS_ASSERT_EQUALS(12, groupBounds[6]);
-    TS_ASSERT_EQUALS(14, groupBounds[7]);
+    for (size_t group = 0; group < 8; ++group) {
+      TS_ASSERT_EQUALS(2 * group, groupBounds[group]);
+      /* Events keep their order of arrival */
+      TS_ASSERT_EQUALS(group, events[2 * group].wsIdx);
+      TS_ASSERT_EQUALS(0, events[2 * group].tof);
+      TS_ASSERT_EQUALS(group, events[2 * group + 1].wsIdx);
+      TS_ASSERT_EQUALS(1, events[2 * group + 1].tof);
+    }
     TS_ASSERT_EQUALS(events.size(), groupBounds[8]);
   }
 
-  void test_Compute_Bounds_Multiple_Threads_Low_Events() {
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
+  void test_Partition_Events_Multiple_Threads_Low_Events() {
+    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
         events = {
             {0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {3, 0, 0}, {4, 0, 0},
         };
 
-    const auto groupBounds = computeGroupBoundaries(events, 8);
+    const auto groupBounds = partitionEventBuffer(events, 5, 8);
     TS_ASSERT_EQUALS(9, groupBounds.size());
 
     const auto upper = events.size();
@@ -421,65 +456,44 @@ public:
     TS_ASSERT_EQUALS(upper, groupBounds[8]);
   }
 
-  void test_Compute_Bounds_Multiple_Threads_Very_Inbalanced() {
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
-        events = {/* 0 */
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-                  {0, 0, 0},
-
-                  /* 14 */
-                  {1, 0, 0},
-
-                  /* 15 */
-                  {2, 0, 0},
-
-                  /* 16 */
-                  {3, 0, 0},
-                  {3, 0, 0},
-
-                  /* 18 */
-                  {4, 0, 0}};
-
-    const auto groupBounds = computeGroupBoundaries(events, 8);
+  void test_Partition_Events_Multiple_Threads_Very_Inbalanced() {
+    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
+        events(14, {0, 0, 0});
+    events.insert(events.begin() + 3, {{4, 0, 0}, {3, 0, 0}, {1, 0, 0}});
+    events.insert(events.end(), {{3, 0, 0}, {2, 0, 0}});
+
+    const auto groupBounds = partitionEventBuffer(events, 16, 8);
     TS_ASSERT_EQUALS(9, groupBounds.size());
 
     const auto upper = events.size();
 
-    /* Generated groups contain: 0  1,2  3  4 */
+    /* Generated groups contain: 0,1  2,3  4 */
     TS_ASSERT_EQUALS(0, groupBounds[0]);
-    TS_ASSERT_EQUALS(14, groupBounds[1]);
-    TS_ASSERT_EQUALS(16, groupBounds[2]);
-    TS_ASSERT_EQUALS(18, groupBounds[3]);
-    TS_ASSERT_EQUALS(upper, groupBounds[4]);
-    TS_ASSERT_EQUALS(upper, groupBounds[5]);
-    TS_ASSERT_EQUALS(upper, groupBounds[6]);
-    TS_ASSERT_EQUALS(upper, groupBounds[7]);
+    TS_ASSERT_EQUALS(15, groupBounds[1]);
+    TS_ASSERT_EQUALS(18, groupBounds[2]);
+    TS_ASSERT_EQUALS(upper, groupBounds[3]);
     TS_ASSERT_EQUALS(upper, groupBounds[8]);
+    TS_ASSERT_EQUALS(1, events[3].wsIdx);
+    TS_ASSERT_EQUALS(3, events[15].wsIdx);
+    TS_ASSERT_EQUALS(3, events[16].wsIdx);
+    TS_ASSERT_EQUALS(2, events[17].wsIdx);
+    TS_ASSERT_EQUALS(4, events[18].wsIdx);
   }
 
-  void test_Compute_Bounds_Single_Thread() {
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
+  void test_Partition_Events_Single_Thread() {
+    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent>
         events = {
-            {0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {3, 0, 0}, {4, 0, 0},
+            {4, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {3, 0, 0}, {0, 0, 0},
         };
+    const auto original = events;
 
-    const auto groupBounds = computeGroupBoundaries(events, 1);
+    const auto groupBounds = partitionEventBuffer(events, 5, 1);
     TS_ASSERT_EQUALS(2, groupBounds.size());
 
     TS_ASSERT_EQUALS(0, groupBounds[0]);
     TS_ASSERT_EQUALS(events.size(), groupBounds[1]);
+    for (size_t i = 0; i < events.size(); ++i)
+      TS_ASSERT_EQUALS(original[i].wsIdx, events[i].wsIdx);
   }
 
   //----------------------------------------------------------------------------
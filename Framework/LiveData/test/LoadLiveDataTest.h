@@ -6,6 +6,8 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmFactory.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/LiveListenerFactory.h"
 #include "MantidDataObjects/EventWorkspace.h"
@@ -26,6 +28,35 @@ using namespace Mantid::DataObjects;
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 
+namespace {
+/// The number of events of the input of each run of the post-processing
+std::vector<size_t> postProcessedEvents;
+
+/// Post-processing that records the size of its input and copies it
+class RecordingPostProcessing : public Algorithm {
+public:
+  const std::string name() const override { return "RecordingPostProcessing"; }
+  const std::string summary() const override {
+    return "Records the number of events of its input";
+  }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Dummy"; }
+
+  void init() override {
+    declareProperty(std::make_unique<WorkspaceProperty<EventWorkspace>>(
+        "InputWorkspace", "", Direction::Input));
+    declareProperty(std::make_unique<WorkspaceProperty<EventWorkspace>>(
+        "OutputWorkspace", "", Direction::Output));
+  }
+  void exec() override {
+    EventWorkspace_sptr input = getProperty("InputWorkspace");
+    postProcessedEvents.emplace_back(input->getNumberEvents());
+    EventWorkspace_sptr output = input->clone();
+    setProperty("OutputWorkspace", output);
+  }
+};
+} // namespace
+
 class LoadLiveDataTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -306,6 +337,58 @@ public:
     TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
   }
 
+  //--------------------------------------------------------------------------------------------
+  /** Post-process only the new chunks and add them to the previous output */
+  void test_PostProcessIncrementally() {
+    FacilityHelper::ScopedFacilities loadTESTFacility(
+        "unit_testing/UnitTestFacilities.xml", "TEST");
+    AlgorithmFactory::Instance().subscribe<RecordingPostProcessing>();
+    postProcessedEvents.clear();
+    for (int i = 0; i < 2; ++i) {
+      LoadLiveData alg;
+      TS_ASSERT_THROWS_NOTHING(alg.initialize())
+      alg.setPropertyValue("Instrument", "TestDataListener");
+      alg.setPropertyValue("AccumulationMethod", "Add");
+      alg.setPropertyValue("PostProcessingAlgorithm",
+                           "RecordingPostProcessing");
+      alg.setProperty("PreserveEvents", true);
+      alg.setProperty("PostProcessIncrementally", true);
+      alg.setPropertyValue("AccumulationWorkspace", "fake_accum");
+      alg.setPropertyValue("OutputWorkspace", "fake");
+      TS_ASSERT_THROWS_NOTHING(alg.execute())
+      TS_ASSERT(alg.isExecuted())
+    }
+    AlgorithmFactory::Instance().unsubscribe("RecordingPostProcessing", 1);
+    // The first run post-processes the whole accumulation workspace, the
+    // second one only the new chunk
+    TS_ASSERT_EQUALS(postProcessedEvents, (std::vector<size_t>{200, 200}));
+    auto ws =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>("fake");
+    auto ws_accum =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            "fake_accum");
+    TS_ASSERT(ws)
+    TS_ASSERT(ws_accum)
+    TS_ASSERT_EQUALS(ws_accum->getNumberEvents(), 400);
+    // The output holds the post-processed events of both chunks
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(ws->getNumberEvents(), 400);
+    TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
+  }
+
+  void test_PostProcessIncrementally_requires_Add() {
+    FacilityHelper::ScopedFacilities loadTESTFacility(
+        "unit_testing/UnitTestFacilities.xml", "TEST");
+    LoadLiveData alg;
+    alg.initialize();
+    alg.setPropertyValue("Instrument", "TestDataListener");
+    alg.setPropertyValue("AccumulationMethod", "Replace");
+    alg.setProperty("PostProcessIncrementally", true);
+    alg.setPropertyValue("OutputWorkspace", "fake");
+    const auto errors = alg.validateInputs();
+    TS_ASSERT_EQUALS(errors.count("PostProcessIncrementally"), 1);
+  }
+
   //--------------------------------------------------------------------------------------------
   /** Do some processing that converts to a different type of workspace */
   void test_ProcessToMDWorkspace_and_Add() {
@@ -10,6 +10,7 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/NumericAxis.h"
 #include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumGeometryTable.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidKernel/CompositeValidator.h"
@@ -246,6 +247,7 @@ void PreprocessDetectorsToMD::processDetectorsPositions(
   //// Loop over the spectra
   uint32_t liveDetectorsCount(0);
   const auto &spectrumInfo = inputWS->spectrumInfo();
+  const auto &geometry = inputWS->spectrumGeometryTable();
   for (size_t i = 0; i < nHist; i++) {
     sp2detMap[i] = std::numeric_limits<uint64_t>::quiet_NaN();
     detId[i] = std::numeric_limits<int32_t>::quiet_NaN();
@@ -255,7 +257,7 @@ void PreprocessDetectorsToMD::processDetectorsPositions(
     Azimuthal[i] = std::numeric_limits<double>::quiet_NaN();
     //     detMask[i]  = true;
 
-    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i))
+    if (!geometry.hasDetectors(i) || geometry.isMonitor(i))
       continue;
 
     // if masked detectors state is not used, masked detectors just ignored;
@@ -271,9 +273,9 @@ void PreprocessDetectorsToMD::processDetectorsPositions(
     sp2detMap[i] = liveDetectorsCount;
     detId[liveDetectorsCount] = int32_t(spDet.getID());
     detIDMap[liveDetectorsCount] = i;
-    L2[liveDetectorsCount] = spectrumInfo.l2(i);
+    L2[liveDetectorsCount] = geometry.l2(i);
 
-    double polar = spectrumInfo.twoTheta(i);
+    double polar = geometry.twoTheta(i);
     double azim = spDet.getPhi();
     TwoTheta[liveDetectorsCount] = polar;
     Azimuthal[liveDetectorsCount] = azim;
@@ -108,6 +108,9 @@ public:
   /// Reset the pointer to the progress object.
   void resetProgress(Mantid::API::Progress *prog);
 
+  /// Set the compression used for the datasets written
+  void setCompression(const int compression);
+
   /// Nexus file handle
   NXhandle fileID;
 
@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 // NexusFileIO
 // @author Ronald Fowler
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -40,6 +41,53 @@ using namespace DataObjects;
 namespace {
 /// static logger
 Logger g_log("NexusFileIO");
+
+/// Approximate size in bytes of the chunks of compressed datasets
+constexpr size_t TARGET_CHUNK_BYTES = 1 << 20;
+
+/** Number of rows of a 2D dataset of doubles that make up one chunk. This is
+ * also the number of rows written at once.
+ * @param nRows :: number of rows in the dataset
+ * @param rowLength :: number of values in each row
+ * @return the number of rows per chunk, at least 1
+ */
+int rowsPerChunk(const int nRows, const int rowLength) {
+  const size_t rowBytes =
+      sizeof(double) * static_cast<size_t>(std::max(rowLength, 1));
+  const auto rows = std::min(std::max(TARGET_CHUNK_BYTES / rowBytes, size_t{1}),
+                             static_cast<size_t>(std::max(nRows, 1)));
+  return static_cast<int>(rows);
+}
+
+/** Write the rows of the open 2D dataset in blocks of several rows instead of
+ * one slab per row, which saves a call into the NeXus and HDF5 libraries and
+ * a partial chunk write for every row.
+ * @param fileID :: handle of the file, with the dataset open
+ * @param nRows :: number of rows in the dataset
+ * @param rowLength :: number of values in each row
+ * @param rowsPerBlock :: number of rows to write at once
+ * @param row :: callable returning the values of the given row
+ */
+template <typename RowGetter>
+void putRowBlocks(NXhandle fileID, const int nRows, const int rowLength,
+                  const int rowsPerBlock, const RowGetter &row) {
+  std::vector<double> block(static_cast<size_t>(rowsPerBlock) * rowLength);
+  int start[2] = {0, 0};
+  int size[2] = {0, rowLength};
+  while (start[0] < nRows) {
+    size[0] = std::min(rowsPerBlock, nRows - start[0]);
+    auto out = block.begin();
+    for (int i = 0; i < size[0]; ++i) {
+      const auto &values = row(start[0] + i);
+      std::copy_n(values.begin(),
+                  std::min(values.size(), static_cast<size_t>(rowLength)),
+                  out);
+      out += rowLength;
+    }
+    NXputslab(fileID, block.data(), start, size);
+    start[0] += size[0];
+  }
+}
 } // namespace
 
 /// Empty default constructor
@@ -54,6 +102,15 @@ NexusFileIO::NexusFileIO(Progress *prog)
 
 void NexusFileIO::resetProgress(Progress *prog) { m_progress = prog; }
 
+/** Set the compression used for the datasets written from now on. Files
+ * opened in the XML format are never compressed.
+ * @param compression :: NeXus compression type, e.g. NX_COMP_LZW or
+ * NX_COMP_NONE
+ */
+void NexusFileIO::setCompression(const int compression) {
+  m_nexuscompression = compression;
+}
+
 //
 // Write out the data in a worksvn space in Nexus "Processed" format.
 // This *Proposed* standard comprises the fields:
@@ -345,8 +402,7 @@ int NexusFileIO::writeNexusProcessedData2D(
     for (size_t i = 0; i < sAxis->length(); i++)
       axis2.emplace_back((*sAxis)(i));
 
-  int start[2] = {0, 0};
-  int asize[2] = {1, dims_array[1]};
+  int asize[2] = {rowsPerChunk(dims_array[0], dims_array[1]), dims_array[1]};
 
   // -------------- Actually write the 2D data ----------------------------
   if (write2Ddata) {
@@ -354,11 +410,10 @@ int NexusFileIO::writeNexusProcessedData2D(
     NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
                    m_nexuscompression, asize);
     NXopendata(fileID, name.c_str());
-    for (size_t i = 0; i < nSpect; i++) {
-      int s = spec[i];
-      NXputslab(fileID, localworkspace->y(s).rawData().data(), start, asize);
-      start[0]++;
-    }
+    putRowBlocks(fileID, dims_array[0], dims_array[1], asize[0],
+                 [&](const int i) -> const std::vector<double> & {
+                   return localworkspace->y(spec[i]).rawData();
+                 });
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
     int signal = 1;
@@ -380,12 +435,10 @@ int NexusFileIO::writeNexusProcessedData2D(
     NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
                    m_nexuscompression, asize);
     NXopendata(fileID, name.c_str());
-    start[0] = 0;
-    for (size_t i = 0; i < nSpect; i++) {
-      int s = spec[i];
-      NXputslab(fileID, localworkspace->e(s).rawData().data(), start, asize);
-      start[0]++;
-    }
+    putRowBlocks(fileID, dims_array[0], dims_array[1], asize[0],
+                 [&](const int i) -> const std::vector<double> & {
+                   return localworkspace->e(spec[i]).rawData();
+                 });
 
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
@@ -398,12 +451,10 @@ int NexusFileIO::writeNexusProcessedData2D(
       NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
                      m_nexuscompression, asize);
       NXopendata(fileID, name.c_str());
-      start[0] = 0;
-      for (size_t i = 0; i < nSpect; i++) {
-        int s = spec[i];
-        NXputslab(fileID, rebin_workspace->readF(s).data(), start, asize);
-        start[0]++;
-      }
+      putRowBlocks(fileID, dims_array[0], dims_array[1], asize[0],
+                   [&](const int i) -> const std::vector<double> & {
+                     return rebin_workspace->readF(spec[i]);
+                   });
 
       std::string finalized = (rebin_workspace->isFinalized()) ? "1" : "0";
       NXputattr(fileID, "finalized", finalized.c_str(), 2, NX_CHAR);
@@ -418,17 +469,16 @@ int NexusFileIO::writeNexusProcessedData2D(
     if (localworkspace->hasDx(0)) {
       dims_array[0] = static_cast<int>(nSpect);
       dims_array[1] = static_cast<int>(localworkspace->dx(0).size());
+      asize[0] = rowsPerChunk(dims_array[0], dims_array[1]);
+      asize[1] = dims_array[1];
       std::string dxErrorName = "xerrors";
       NXcompmakedata(fileID, dxErrorName.c_str(), NX_FLOAT64, 2, dims_array,
                      m_nexuscompression, asize);
       NXopendata(fileID, dxErrorName.c_str());
-      start[0] = 0;
-      asize[1] = dims_array[1];
-      for (size_t i = 0; i < nSpect; i++) {
-        int s = spec[i];
-        NXputslab(fileID, localworkspace->dx(s).rawData().data(), start, asize);
-        start[0]++;
-      }
+      putRowBlocks(fileID, dims_array[0], dims_array[1], asize[0],
+                   [&](const int i) -> const std::vector<double> & {
+                     return localworkspace->dx(spec[i]).rawData();
+                   });
     }
 
     NXclosedata(fileID);
@@ -446,12 +496,11 @@ int NexusFileIO::writeNexusProcessedData2D(
     dims_array[1] = static_cast<int>(localworkspace->x(0).size());
     NXmakedata(fileID, "axis1", NX_FLOAT64, 2, dims_array);
     NXopendata(fileID, "axis1");
-    start[0] = 0;
-    asize[1] = dims_array[1];
-    for (size_t i = 0; i < nSpect; i++) {
-      NXputslab(fileID, localworkspace->x(i).rawData().data(), start, asize);
-      start[0]++;
-    }
+    putRowBlocks(fileID, dims_array[0], dims_array[1],
+                 rowsPerChunk(dims_array[0], dims_array[1]),
+                 [&](const int i) -> const std::vector<double> & {
+                   return localworkspace->x(i).rawData();
+                 });
   }
 
   std::string dist = (localworkspace->isDistribution()) ? "1" : "0";
@@ -754,13 +803,8 @@ int NexusFileIO::writeNexusProcessedDataEventCombined(
   // The array of indices for each event list #
   int dims_array[1] = {static_cast<int>(indices.size())};
   if (!indices.empty()) {
-    if (compress)
-      NXcompmakedata(fileID, "indices", NX_INT64, 1, dims_array,
-                     m_nexuscompression, dims_array);
-    else
-      NXmakedata(fileID, "indices", NX_INT64, 1, dims_array);
+    NXwritedata("indices", NX_INT64, 1, dims_array, indices.data(), compress);
     NXopendata(fileID, "indices");
-    NXputdata(fileID, indices.data());
     std::string yUnits = ws->YUnit();
     std::string yUnitLabel = ws->YUnitLabel();
     NXputattr(fileID, "units", yUnits.c_str(), static_cast<int>(yUnits.size()),
@@ -816,9 +860,19 @@ void NexusFileIO::NXwritedata(const char *name, int datatype, int rank,
                               int *dims_array, void *data,
                               bool compress) const {
   if (compress) {
-    // We'll use the same slab/buffer size as the size of the array
+    // Split large arrays into chunks along the first dimension so that they
+    // can be compressed and read back in parts. The element size is taken to
+    // be 8 bytes, the largest type written here.
+    std::vector<int> chunk(dims_array, dims_array + rank);
+    size_t rowElements = 1;
+    for (int i = 1; i < rank; ++i)
+      rowElements *= static_cast<size_t>(std::max(chunk[i], 1));
+    const size_t maxRows =
+        std::max(TARGET_CHUNK_BYTES / (8 * rowElements), size_t{1});
+    if (static_cast<size_t>(chunk[0]) > maxRows)
+      chunk[0] = static_cast<int>(maxRows);
     NXcompmakedata(fileID, name, datatype, rank, dims_array, m_nexuscompression,
-                   dims_array);
+                   chunk.data());
   } else {
     // Write uncompressed.
     NXmakedata(fileID, name, datatype, rank, dims_array);
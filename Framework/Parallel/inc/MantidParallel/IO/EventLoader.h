@@ -6,6 +6,8 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -29,6 +31,15 @@ namespace IO {
   @date 2017
 */
 namespace EventLoader {
+/// Inclusive ranges of time-of-flight and pulse time (in nanoseconds since the
+/// epoch) of the events to keep when loading. By default all events are kept.
+struct EventFilter {
+  double tofMin{std::numeric_limits<double>::lowest()};
+  double tofMax{std::numeric_limits<double>::max()};
+  int64_t pulseTimeMin{std::numeric_limits<int64_t>::min()};
+  int64_t pulseTimeMax{std::numeric_limits<int64_t>::max()};
+};
+
 MANTID_PARALLEL_DLL std::unordered_map<int32_t, size_t>
 makeAnyEventIdToBankMap(const std::string &filename,
                         const std::string &groupName,
@@ -44,7 +55,7 @@ load(const std::string &filename, const std::string &groupName,
      const std::vector<std::string> &bankNames,
      const std::vector<int32_t> &bankOffsets,
      const std::vector<std::vector<Types::Event::TofEvent> *> &eventLists,
-     bool precalcEvents);
+     bool precalcEvents, const EventFilter &filter = EventFilter());
 
 } // namespace EventLoader
 
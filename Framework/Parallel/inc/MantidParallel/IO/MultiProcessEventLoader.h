@@ -15,6 +15,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "MantidParallel/IO/EventLoader.h"
 #include "MantidParallel/IO/EventLoaderHelpers.h"
 #include "MantidParallel/IO/EventsListsShmemStorage.h"
 
@@ -54,7 +55,9 @@ public:
   load(const std::string &filename, const std::string &groupname,
        const std::vector<std::string> &bankNames,
        const std::vector<int32_t> &bankOffsets,
-       std::vector<std::vector<Types::Event::TofEvent> *> eventLists) const;
+       std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+       const EventLoader::EventFilter &filter = EventLoader::EventFilter())
+      const;
 
   static void fillFromFile(EventsListsShmemStorage &storage,
                            const std::string &filename,
@@ -88,17 +91,21 @@ private:
                                      std::size_t from, std::size_t to);
   };
 
-  void assembleFromShared(
-      std::vector<std::vector<Mantid::Types::Event::TofEvent> *> &result) const;
-
-  size_t estimateShmemAmount(size_t eventCount) const;
+  size_t estimateShmemAmount(size_t eventCount, uint32_t numProcesses) const;
 
-private:
   bool m_precalculateEvents;
   uint32_t m_numPixels;
   uint32_t m_numProcesses;
   uint32_t m_numThreads;
   std::string m_binaryToLaunch;
+
+protected:
+  void assembleFromShared(
+      std::vector<std::vector<Mantid::Types::Event::TofEvent> *> &result,
+      uint32_t numProcesses, const EventLoader::EventFilter &filter) const;
+
+  uint32_t numberOfProcesses(std::size_t eventCount) const;
+
   std::vector<std::string> m_segmentNames;
   std::string m_storageName;
 };
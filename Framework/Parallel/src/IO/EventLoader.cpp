@@ -61,9 +61,12 @@ void load(const std::string &filename, const std::string &groupname,
           const std::vector<std::string> &bankNames,
           const std::vector<int32_t> &bankOffsets,
           const std::vector<std::vector<Types::Event::TofEvent> *> &eventLists,
-          bool precalcEvents) {
+          bool precalcEvents, const EventFilter &filter) {
   auto concurencyNumber = PARALLEL_GET_MAX_THREADS;
-  auto numThreads = std::max<int>(concurencyNumber / 2, 1);
+  // Events are assembled after all child processes finished, so all cores
+  // are available to the threads. The loader launches fewer processes for
+  // small files.
+  auto numThreads = std::max<int>(concurencyNumber, 1);
   auto numProceses = std::max<int>(concurencyNumber / 2, 1);
   std::string executableName =
       Kernel::ConfigService::Instance().getPropertiesDir() +
@@ -72,7 +75,7 @@ void load(const std::string &filename, const std::string &groupname,
   MultiProcessEventLoader loader(static_cast<unsigned>(eventLists.size()),
                                  numProceses, numThreads, executableName,
                                  precalcEvents);
-  loader.load(filename, groupname, bankNames, bankOffsets, eventLists);
+  loader.load(filename, groupname, bankNames, bankOffsets, eventLists, filter);
 }
 
 } // namespace EventLoader
@@ -7,9 +7,11 @@
 #include "MantidParallel/IO/MultiProcessEventLoader.h"
 //#include <boost/process/child.hpp>
 #include <Poco/Process.h>
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
 #include <numeric>
 #include <thread>
 
@@ -68,7 +70,8 @@ void MultiProcessEventLoader::load(
     const std::string &filename, const std::string &groupname,
     const std::vector<std::string> &bankNames,
     const std::vector<int32_t> &bankOffsets,
-    std::vector<std::vector<Types::Event::TofEvent> *> eventLists) const {
+    std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+    const EventLoader::EventFilter &filter) const {
 
   try {
     H5::H5File file(filename.c_str(), H5F_ACC_RDONLY);
@@ -77,9 +80,10 @@ void MultiProcessEventLoader::load(
     auto bkSz = EventLoader::readBankSizes(instrument, bankNames);
     auto numEvents = std::accumulate(bkSz.begin(), bkSz.end(), std::size_t{0});
 
-    std::size_t storageSize = estimateShmemAmount(numEvents);
+    const auto numProcesses = numberOfProcesses(numEvents);
+    std::size_t storageSize = estimateShmemAmount(numEvents, numProcesses);
 
-    std::size_t evPerPr = numEvents / m_numProcesses;
+    std::size_t evPerPr = numEvents / numProcesses;
 
     /*  boost::process implementation can be used
      * with proper boost version instead of Poco*/
@@ -131,9 +135,9 @@ void MultiProcessEventLoader::load(
     } shared_memory_destroyer(m_segmentNames);
 
     std::vector<Poco::ProcessHandle> vChilds;
-    for (unsigned i = 0; i < m_numProcesses; ++i) {
+    for (unsigned i = 0; i < numProcesses; ++i) {
       std::size_t upperBound =
-          i < m_numProcesses - 1 ? evPerPr * (i + 1) : numEvents;
+          i < numProcesses - 1 ? evPerPr * (i + 1) : numEvents;
       std::vector<std::string> processArgs;
 
       processArgs.emplace_back(m_segmentNames[i]); // segment name
@@ -185,50 +189,67 @@ void MultiProcessEventLoader::load(
             "Error while waiting processes in  multiprocess loading.");
 
     // Assemble multiprocess data from shared memory
-    assembleFromShared(eventLists);
+    assembleFromShared(eventLists, numProcesses, filter);
   } catch (...) {
     std::throw_with_nested(std::runtime_error("Something wrong in "
                                               "MultiprocessLoader."));
   }
 }
 
-/**Collects data from the chunks in shared memory to the final structure*/
+/**Collects data from the chunks in shared memory to the final structure.
+ * Every thread takes portions of pixels and copies the events of a pixel from
+ * all segments at once, after reserving the memory for all of them. Events
+ * outside the ranges of the filter are skipped.*/
 void MultiProcessEventLoader::assembleFromShared(
-    std::vector<std::vector<Mantid::Types::Event::TofEvent> *> &result) const {
-  std::vector<std::thread> workers;
-
-  std::vector<std::atomic<uint32_t>> cnts(m_segmentNames.size());
-  std::fill(cnts.begin(), cnts.end(), 0);
-  std::vector<std::atomic<uint32_t>> processCounter(m_segmentNames.size());
-  std::fill(processCounter.begin(), processCounter.end(), 0);
+    std::vector<std::vector<Mantid::Types::Event::TofEvent> *> &result,
+    const uint32_t numProcesses,
+    const EventLoader::EventFilter &filter) const {
+  std::vector<ip::managed_shared_memory> segments;
+  std::vector<const Chunks *> chunksPerSegment;
+  for (uint32_t segId = 0; segId < numProcesses; ++segId) {
+    segments.emplace_back(ip::open_read_only, m_segmentNames[segId].c_str());
+    chunksPerSegment.emplace_back(
+        segments.back().find<Chunks>(m_storageName.c_str()).first);
+  }
 
+  const bool filterTof = filter.tofMin != EventLoader::EventFilter().tofMin ||
+                         filter.tofMax != EventLoader::EventFilter().tofMax;
+  const bool filterPulseTime =
+      filter.pulseTimeMin != EventLoader::EventFilter().pulseTimeMin ||
+      filter.pulseTimeMax != EventLoader::EventFilter().pulseTimeMax;
+  const auto keep = [&filter](const TofEvent &event) {
+    const auto pulseTime = event.pulseTime().totalNanoseconds();
+    return event.tof() >= filter.tofMin && event.tof() <= filter.tofMax &&
+           pulseTime >= filter.pulseTimeMin && pulseTime <= filter.pulseTimeMax;
+  };
+
+  std::atomic<uint32_t> cnt{0};
   const unsigned portion{std::max<unsigned>(m_numPixels / m_numThreads / 3, 1)};
-
+  std::vector<std::thread> workers;
   for (unsigned i = 0; i < m_numThreads; ++i) {
     workers.emplace_back([&]() {
-      for (std::size_t segId = 0; segId < m_segmentNames.size(); ++segId) {
-        ip::managed_shared_memory segment{ip::open_read_only,
-                                          m_segmentNames[segId].c_str()};
-        auto chunks =
-            segment.find<Mantid::Parallel::IO::Chunks>(m_storageName.c_str())
-                .first;
-        auto &cnt = cnts[segId];
-        for (uint32_t startPixel = cnt.fetch_add(portion);
-             startPixel < m_numPixels; startPixel = cnt.fetch_add(portion)) {
-          auto toPixel = std::min(startPixel + portion, m_numPixels);
-          for (uint32_t pixel = startPixel; pixel < toPixel; ++pixel) {
-            auto &res = result[pixel];
-            for (auto &ch : *chunks) {
-              res->insert(res->end(), ch[pixel].begin(), ch[pixel].end());
+      for (uint32_t startPixel = cnt.fetch_add(portion);
+           startPixel < m_numPixels; startPixel = cnt.fetch_add(portion)) {
+        auto toPixel = std::min(startPixel + portion, m_numPixels);
+        for (uint32_t pixel = startPixel; pixel < toPixel; ++pixel) {
+          auto &res = *result[pixel];
+          std::size_t size = res.size();
+          for (const auto chunks : chunksPerSegment)
+            for (const auto &ch : *chunks)
+              size += ch[pixel].size();
+          res.reserve(size);
+          for (const auto chunks : chunksPerSegment) {
+            for (const auto &ch : *chunks) {
+              if (filterTof || filterPulseTime)
+                std::copy_if(ch[pixel].begin(), ch[pixel].end(),
+                             std::back_inserter(res), keep);
+              else
+                res.insert(res.end(), ch[pixel].begin(), ch[pixel].end());
             }
           }
+          if (filterTof || filterPulseTime)
+            res.shrink_to_fit();
         }
-        ++processCounter[segId];
-        if (processCounter[segId] == m_numThreads)
-          ip::shared_memory_object::remove(m_segmentNames[segId].c_str());
-
-        while (processCounter[segId] != m_numThreads)
-          ;
       }
     });
   }
@@ -258,13 +279,26 @@ void MultiProcessEventLoader::fillFromFile(
         type, storage, instrument, bankNames, bankOffsets, from, to);
 }
 
+/// Number of child processes used to load the given number of events: at most
+/// the requested number, but few enough to give every process a reasonable
+/// amount of events, since launching a process has a fixed cost.
+uint32_t MultiProcessEventLoader::numberOfProcesses(
+    const std::size_t eventCount) const {
+  constexpr std::size_t minEventsPerProcess{1 << 20};
+  const auto wanted =
+      std::max<std::size_t>(eventCount / minEventsPerProcess, 1);
+  return static_cast<uint32_t>(
+      std::min<std::size_t>(wanted, std::max<uint32_t>(m_numProcesses, 1)));
+}
+
 // Estimates the memory amount for shared memory segments
 // vector representing each pixel allocated only once, so we have allocationFee
 // bytes extra overhead
-size_t MultiProcessEventLoader::estimateShmemAmount(size_t eventCount) const {
+size_t MultiProcessEventLoader::estimateShmemAmount(
+    size_t eventCount, const uint32_t numProcesses) const {
   // 8 bytes pointer to allocator + 8 bytes pointer to metadata
   auto allocationFee = 8 + 8 + generateStoragename().length();
-  std::size_t len{(eventCount / m_numProcesses + eventCount % m_numProcesses) *
+  std::size_t len{(eventCount / numProcesses + eventCount % numProcesses) *
                       sizeof(TofEvent) +
                   m_numPixels * (sizeof(EventLists) + allocationFee) +
                   sizeof(Chunks) + allocationFee};
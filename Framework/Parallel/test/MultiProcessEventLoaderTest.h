@@ -0,0 +1,165 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2021 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidParallel/IO/EventsListsShmemStorage.h"
+#include "MantidParallel/IO/MultiProcessEventLoader.h"
+#include "MantidTypes/Event/TofEvent.h"
+
+using namespace Mantid::Parallel::IO;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+/// Gives access to the assembly from shared memory without child processes
+class TestableMultiProcessEventLoader : public MultiProcessEventLoader {
+public:
+  TestableMultiProcessEventLoader(uint32_t numPixels, uint32_t numProcesses)
+      : MultiProcessEventLoader(numPixels, numProcesses, 2, "") {}
+  using MultiProcessEventLoader::assembleFromShared;
+  using MultiProcessEventLoader::numberOfProcesses;
+
+  /// Fills the shared memory segment of every process with the given events,
+  /// i.e. events[process][chunk][pixel]
+  void fillSegments(
+      const std::vector<std::vector<std::vector<std::vector<TofEvent>>>>
+          &events) const {
+    for (size_t process = 0; process < events.size(); ++process) {
+      const auto numChunks = events[process].size();
+      const auto numPixels = events[process][0].size();
+      ip::shared_memory_object::remove(m_segmentNames[process].c_str());
+      EventsListsShmemStorage storage(m_segmentNames[process], m_storageName,
+                                      1 << 16, numChunks, numPixels);
+      for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+        for (size_t pixel = 0; pixel < numPixels; ++pixel) {
+          const auto &pixelEvents = events[process][chunk][pixel];
+          storage.appendEvent(chunk, pixel, pixelEvents.cbegin(),
+                              pixelEvents.cend());
+        }
+      }
+    }
+  }
+
+  void removeSegments() const {
+    for (const auto &name : m_segmentNames)
+      ip::shared_memory_object::remove(name.c_str());
+  }
+};
+
+std::vector<double> tofs(const std::vector<TofEvent> &events) {
+  std::vector<double> result;
+  for (const auto &event : events)
+    result.emplace_back(event.tof());
+  return result;
+}
+
+std::vector<int64_t> pulseTimes(const std::vector<TofEvent> &events) {
+  std::vector<int64_t> result;
+  for (const auto &event : events)
+    result.emplace_back(event.pulseTime().totalNanoseconds());
+  return result;
+}
+} // namespace
+
+class MultiProcessEventLoaderTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MultiProcessEventLoaderTest *createSuite() {
+    return new MultiProcessEventLoaderTest();
+  }
+  static void destroySuite(MultiProcessEventLoaderTest *suite) {
+    delete suite;
+  }
+
+  void test_numberOfProcesses_is_reduced_for_small_files() {
+    TestableMultiProcessEventLoader loader(1, 8);
+    TS_ASSERT_EQUALS(loader.numberOfProcesses(0), 1);
+    TS_ASSERT_EQUALS(loader.numberOfProcesses(1000), 1);
+    TS_ASSERT_EQUALS(loader.numberOfProcesses((1 << 20) - 1), 1);
+    TS_ASSERT_EQUALS(loader.numberOfProcesses(3 << 20), 3);
+  }
+
+  void test_numberOfProcesses_does_not_exceed_requested_number() {
+    TestableMultiProcessEventLoader loader(1, 8);
+    TS_ASSERT_EQUALS(loader.numberOfProcesses(size_t{100} << 20), 8);
+  }
+
+  void test_numberOfProcesses_is_at_least_one() {
+    TestableMultiProcessEventLoader loader(1, 0);
+    TS_ASSERT_EQUALS(loader.numberOfProcesses(size_t{100} << 20), 1);
+  }
+
+  void test_assembleFromShared_without_filter_keeps_all_events() {
+    auto result = assemble(EventLoader::EventFilter());
+    TS_ASSERT_EQUALS(tofs(result[0]),
+                     (std::vector<double>{1.0, 5.0, 9.0, 2.0, 10.0}));
+    TS_ASSERT_EQUALS(tofs(result[1]),
+                     (std::vector<double>{3.0, 7.0, 11.0, 4.0, 8.0}));
+  }
+
+  void test_assembleFromShared_with_tof_filter() {
+    EventLoader::EventFilter filter;
+    filter.tofMin = 3.0;
+    filter.tofMax = 9.0;
+    auto result = assemble(filter);
+    // The bounds are inclusive
+    TS_ASSERT_EQUALS(tofs(result[0]), (std::vector<double>{5.0, 9.0}));
+    TS_ASSERT_EQUALS(tofs(result[1]),
+                     (std::vector<double>{3.0, 7.0, 4.0, 8.0}));
+  }
+
+  void test_assembleFromShared_with_pulse_time_filter() {
+    EventLoader::EventFilter filter;
+    filter.pulseTimeMin = 20;
+    filter.pulseTimeMax = 70;
+    auto result = assemble(filter);
+    // The bounds are inclusive
+    TS_ASSERT_EQUALS(pulseTimes(result[0]),
+                     (std::vector<int64_t>{20, 30, 70}));
+    TS_ASSERT_EQUALS(pulseTimes(result[1]),
+                     (std::vector<int64_t>{40, 50, 60}));
+  }
+
+  void test_assembleFromShared_with_tof_and_pulse_time_filter() {
+    EventLoader::EventFilter filter;
+    filter.tofMin = 4.0;
+    filter.pulseTimeMax = 60;
+    auto result = assemble(filter);
+    TS_ASSERT_EQUALS(tofs(result[0]), (std::vector<double>{5.0, 9.0}));
+    TS_ASSERT_EQUALS(tofs(result[1]), (std::vector<double>{7.0, 11.0}));
+  }
+
+  void test_assembleFromShared_empty_filter_range_drops_all_events() {
+    EventLoader::EventFilter filter;
+    filter.tofMin = 20.0;
+    auto result = assemble(filter);
+    TS_ASSERT(result[0].empty());
+    TS_ASSERT(result[1].empty());
+  }
+
+private:
+  /// Assembles 2 pixels from the segments of 2 processes with 2 chunks each
+  std::vector<std::vector<TofEvent>>
+  assemble(const EventLoader::EventFilter &filter) {
+    TestableMultiProcessEventLoader loader(2, 2);
+    loader.fillSegments({{{{TofEvent(1.0, 10), TofEvent(5.0, 20)},
+                           {TofEvent(3.0, 40)}},
+                          {{TofEvent(9.0, 30)},
+                           {TofEvent(7.0, 50), TofEvent(11.0, 60)}}},
+                         {{{TofEvent(2.0, 80)}, {TofEvent(4.0, 90)}},
+                          {{TofEvent(10.0, 70)}, {TofEvent(8.0, 100)}}}});
+    std::vector<std::vector<TofEvent>> result(2);
+    std::vector<std::vector<TofEvent> *> resultPointers{&result[0],
+                                                        &result[1]};
+    TS_ASSERT_THROWS_NOTHING(
+        loader.assembleFromShared(resultPointers, 2, filter));
+    loader.removeSegments();
+    return result;
+  }
+};
@@ -24,6 +24,7 @@
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup_fwd.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/FloatWorkspace2D.h"
 #include "MantidDataObjects/RebinnedOutput.h"
 #include "MantidDataObjects/TableWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
@@ -186,6 +187,12 @@ create2DWorkspaceNonUniformlyBinned(int nhist, const int numBoundaries,
                                     const double xBoundaries[],
                                     bool hasDx = false);
 
+/** Create a FloatWorkspace2D holding a single precision copy of the data of
+ * the given workspace. The instrument and logs are copied as well.
+ */
+Mantid::DataObjects::FloatWorkspace2D_sptr
+createFloatWorkspace2D(const Mantid::API::MatrixWorkspace &parent);
+
 struct ReturnOne {
   double operator()(const double, std::size_t) { return 1.0; };
 };
@@ -359,6 +359,16 @@ Workspace2D_sptr create2DWorkspaceNonUniformlyBinned(int nhist,
   return retVal;
 }
 
+/** Create a FloatWorkspace2D holding a single precision copy of the data of
+ * the given workspace. The instrument and logs are copied as well.
+ */
+FloatWorkspace2D_sptr createFloatWorkspace2D(const MatrixWorkspace &parent) {
+  FloatWorkspace2D_sptr ws = create<FloatWorkspace2D>(parent);
+  for (size_t i = 0; i < parent.getNumberHistograms(); ++i)
+    ws->setHistogram(i, parent.histogram(i));
+  return ws;
+}
+
 /**
  * Add random noise to the signal
  * @param ws :: The workspace to add the noise to